@@ -0,0 +1,163 @@
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <rainy/collections/concurrency/mpmc_queue.hpp>
+#include <rainy/collections/concurrency/spsc_queue.hpp>
+#include <thread>
+#include <vector>
+
+static constexpr std::size_t queue_capacity = 1024;
+static constexpr std::size_t items_per_producer = 1u << 16;
+
+/*
+ * 作为基准的 std::queue + std::mutex，容量与无锁队列相同，满或空时让出时间片
+ */
+class locked_queue {
+public:
+    bool try_push(const std::uint64_t value) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (queue_.size() == queue_capacity) {
+            return false;
+        }
+        queue_.push(value);
+        return true;
+    }
+
+    bool try_pop(std::uint64_t &out) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (queue_.empty()) {
+            return false;
+        }
+        out = queue_.front();
+        queue_.pop();
+        return true;
+    }
+
+private:
+    std::mutex mutex_;
+    std::queue<std::uint64_t> queue_;
+};
+
+struct locked_adapter {
+    using queue_type = locked_queue;
+
+    static queue_type *make() {
+        return new queue_type();
+    }
+
+    static void push(queue_type &queue, const std::uint64_t value) {
+        while (!queue.try_push(value)) {
+            std::this_thread::yield();
+        }
+    }
+
+    static void pop(queue_type &queue, std::uint64_t &out) {
+        while (!queue.try_pop(out)) {
+            std::this_thread::yield();
+        }
+    }
+};
+
+struct spsc_adapter {
+    using queue_type = rainy::collections::concurrency::spsc_queue<std::uint64_t, queue_capacity>;
+
+    static queue_type *make() {
+        return new queue_type();
+    }
+
+    static void push(queue_type &queue, const std::uint64_t value) {
+        queue.push(value);
+    }
+
+    static void pop(queue_type &queue, std::uint64_t &out) {
+        queue.pop(out);
+    }
+};
+
+struct mpmc_adapter {
+    using queue_type = rainy::collections::concurrency::mpmc_queue<std::uint64_t>;
+
+    static queue_type *make() {
+        return new queue_type(queue_capacity);
+    }
+
+    static void push(queue_type &queue, const std::uint64_t value) {
+        queue.push(value);
+    }
+
+    static void pop(queue_type &queue, std::uint64_t &out) {
+        queue.pop(out);
+    }
+};
+
+/*
+ * range(0) 个生产者与同样数量的消费者逐个传递元素
+ */
+template <typename Adapter>
+static void queue_handoff(benchmark::State &state) {
+    const auto threads = static_cast<std::size_t>(state.range(0));
+    for (auto _: state) {
+        const auto queue = std::unique_ptr<typename Adapter::queue_type>(Adapter::make());
+        std::vector<std::thread> workers;
+        for (std::size_t index = 0; index < threads; ++index) {
+            workers.emplace_back([&] {
+                for (std::size_t i = 0; i < items_per_producer; ++i) {
+                    Adapter::push(*queue, i);
+                }
+            });
+            workers.emplace_back([&] {
+                std::uint64_t value = 0;
+                std::uint64_t sum = 0;
+                for (std::size_t i = 0; i < items_per_producer; ++i) {
+                    Adapter::pop(*queue, value);
+                    sum += value;
+                }
+                benchmark::DoNotOptimize(sum);
+            });
+        }
+        for (auto &worker: workers) {
+            worker.join();
+        }
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * threads * items_per_producer));
+}
+
+/*
+ * 以 range(0) 为批大小的批量传递，比较整批发布与逐个发布的开销
+ */
+template <typename Queue>
+static void queue_batch_handoff(benchmark::State &state) {
+    const auto batch = static_cast<std::size_t>(state.range(0));
+    for (auto _: state) {
+        Queue queue(queue_capacity);
+        std::thread producer([&] {
+            std::vector<std::uint64_t> values(batch, 1);
+            for (std::size_t sent = 0; sent < items_per_producer; sent += batch) {
+                queue.push_n_wait(values.begin(), batch);
+            }
+        });
+        std::vector<std::uint64_t> buffer(batch);
+        std::uint64_t sum = 0;
+        for (std::size_t received = 0; received < items_per_producer;) {
+            const auto popped = queue.pop_n_wait(buffer.begin(), buffer.size());
+            for (std::size_t i = 0; i < popped; ++i) {
+                sum += buffer[i];
+            }
+            received += popped;
+        }
+        producer.join();
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * items_per_producer));
+}
+
+BENCHMARK_TEMPLATE(queue_handoff, locked_adapter)->Arg(1)->Arg(2)->Arg(4)->UseRealTime();
+BENCHMARK_TEMPLATE(queue_handoff, spsc_adapter)->Arg(1)->UseRealTime();
+BENCHMARK_TEMPLATE(queue_handoff, mpmc_adapter)->Arg(1)->Arg(2)->Arg(4)->UseRealTime();
+
+BENCHMARK_TEMPLATE(queue_batch_handoff, rainy::collections::concurrency::spsc_queue<std::uint64_t>)->Arg(1)->Arg(16)->Arg(64)->UseRealTime();
+BENCHMARK_TEMPLATE(queue_batch_handoff, rainy::collections::concurrency::mpmc_queue<std::uint64_t>)->Arg(1)->Arg(16)->Arg(64)->UseRealTime();
+
+BENCHMARK_MAIN();
@@ -0,0 +1,141 @@
+#include <algorithm>
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <random>
+#include <rainy/collections/dense_map.hpp>
+#include <rainy/collections/flat_hash_map.hpp>
+#include <rainy/collections/unordered_map.hpp>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+template <typename Key>
+static std::vector<Key> make_keys(std::size_t count, std::uint64_t seed);
+
+template <>
+std::vector<std::uint64_t> make_keys<std::uint64_t>(const std::size_t count, const std::uint64_t seed) {
+    std::mt19937_64 engine(seed);
+    std::vector<std::uint64_t> keys(count);
+    for (auto &key: keys) {
+        key = engine();
+    }
+    return keys;
+}
+
+template <>
+std::vector<std::string> make_keys<std::string>(const std::size_t count, const std::uint64_t seed) {
+    std::mt19937_64 engine(seed);
+    std::vector<std::string> keys(count);
+    for (auto &key: keys) {
+        // 超出短字符串优化的长度，贴近实际的标识符或路径类键
+        key = "rainy-toolkit/key/" + std::to_string(engine());
+    }
+    return keys;
+}
+
+template <typename Map>
+static void hash_map_insert(benchmark::State &state) {
+    using key_type = typename Map::key_type;
+    const auto keys = make_keys<key_type>(static_cast<std::size_t>(state.range(0)), 1);
+    for (auto _: state) {
+        Map map;
+        for (const auto &key: keys) {
+            map.emplace(key, 0);
+        }
+        benchmark::DoNotOptimize(map);
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) * state.range(0));
+}
+
+template <typename Map>
+static void hash_map_find_hit(benchmark::State &state) {
+    using key_type = typename Map::key_type;
+    const auto keys = make_keys<key_type>(static_cast<std::size_t>(state.range(0)), 1);
+    Map map;
+    for (const auto &key: keys) {
+        map.emplace(key, 0);
+    }
+    std::vector<key_type> probes = keys;
+    std::shuffle(probes.begin(), probes.end(), std::mt19937_64{2});
+    for (auto _: state) {
+        std::size_t found = 0;
+        for (const auto &key: probes) {
+            found += map.find(key) != map.end();
+        }
+        benchmark::DoNotOptimize(found);
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) * state.range(0));
+}
+
+template <typename Map>
+static void hash_map_find_miss(benchmark::State &state) {
+    using key_type = typename Map::key_type;
+    const auto keys = make_keys<key_type>(static_cast<std::size_t>(state.range(0)), 1);
+    const auto probes = make_keys<key_type>(static_cast<std::size_t>(state.range(0)), 3);
+    Map map;
+    for (const auto &key: keys) {
+        map.emplace(key, 0);
+    }
+    for (auto _: state) {
+        std::size_t found = 0;
+        for (const auto &key: probes) {
+            found += map.find(key) != map.end();
+        }
+        benchmark::DoNotOptimize(found);
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) * state.range(0));
+}
+
+template <typename Map>
+static void hash_map_erase(benchmark::State &state) {
+    using key_type = typename Map::key_type;
+    const auto keys = make_keys<key_type>(static_cast<std::size_t>(state.range(0)), 1);
+    for (auto _: state) {
+        state.PauseTiming();
+        Map map;
+        for (const auto &key: keys) {
+            map.emplace(key, 0);
+        }
+        state.ResumeTiming();
+        for (const auto &key: keys) {
+            map.erase(key);
+        }
+        benchmark::DoNotOptimize(map);
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) * state.range(0));
+}
+
+using flat_int = rainy::collections::flat_hash_map<std::uint64_t, int>;
+using node_int = rainy::collections::node_hash_map<std::uint64_t, int>;
+using dense_int = rainy::collections::dense_map<std::uint64_t, int>;
+using rainy_unordered_int = rainy::collections::unordered_map<std::uint64_t, int>;
+using std_unordered_int = std::unordered_map<std::uint64_t, int>;
+
+using flat_string = rainy::collections::flat_hash_map<std::string, int>;
+using node_string = rainy::collections::node_hash_map<std::string, int>;
+using dense_string = rainy::collections::dense_map<std::string, int>;
+using rainy_unordered_string = rainy::collections::unordered_map<std::string, int>;
+using std_unordered_string = std::unordered_map<std::string, int>;
+
+#define RAINY_HASH_MAP_BENCHMARK(func, map)                                                                                               \
+    BENCHMARK_TEMPLATE(func, map)->RangeMultiplier(10)->Range(1000, 10000000)->Unit(benchmark::kMillisecond)
+
+#define RAINY_HASH_MAP_BENCHMARK_ALL(map)                                                                                                 \
+    RAINY_HASH_MAP_BENCHMARK(hash_map_insert, map);                                                                                       \
+    RAINY_HASH_MAP_BENCHMARK(hash_map_find_hit, map);                                                                                     \
+    RAINY_HASH_MAP_BENCHMARK(hash_map_find_miss, map);                                                                                    \
+    RAINY_HASH_MAP_BENCHMARK(hash_map_erase, map)
+
+RAINY_HASH_MAP_BENCHMARK_ALL(flat_int);
+RAINY_HASH_MAP_BENCHMARK_ALL(node_int);
+RAINY_HASH_MAP_BENCHMARK_ALL(dense_int);
+RAINY_HASH_MAP_BENCHMARK_ALL(rainy_unordered_int);
+RAINY_HASH_MAP_BENCHMARK_ALL(std_unordered_int);
+
+RAINY_HASH_MAP_BENCHMARK_ALL(flat_string);
+RAINY_HASH_MAP_BENCHMARK_ALL(node_string);
+RAINY_HASH_MAP_BENCHMARK_ALL(dense_string);
+RAINY_HASH_MAP_BENCHMARK_ALL(rainy_unordered_string);
+RAINY_HASH_MAP_BENCHMARK_ALL(std_unordered_string);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,69 @@
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <functional>
+#include <random>
+#include <rainy/core/core.hpp>
+#include <string>
+#include <string_view>
+#include <vector>
+
+static std::vector<std::string> make_keys(const std::size_t length) {
+    std::mt19937_64 engine(length);
+    std::vector<std::string> keys(1024);
+    for (auto &key: keys) {
+        // 以 URL 字符集填充，贴近实际的标识符与路径类键
+        static constexpr char alphabet[] = "abcdefghijklmnopqrstuvwxyz0123456789/-_.";
+        key.resize(length);
+        for (auto &ch: key) {
+            ch = alphabet[engine() % (sizeof(alphabet) - 1)];
+        }
+    }
+    return keys;
+}
+
+template <typename Hasher>
+static void string_hash(benchmark::State &state) {
+    const auto length = static_cast<std::size_t>(state.range(0));
+    const auto keys = make_keys(length);
+    Hasher hasher{};
+    for (auto _: state) {
+        std::uint64_t sum = 0;
+        for (const auto &key: keys) {
+            sum += hasher(key);
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * keys.size() * length));
+}
+
+struct fnv1a_hasher {
+    std::size_t operator()(const std::string &key) const noexcept {
+        return rainy::utility::implements::fnv1a_append_bytes(rainy::utility::implements::fnv_offset_basis,
+                                                              reinterpret_cast<const unsigned char *>(key.data()), key.size());
+    }
+};
+
+struct rapidhash_hasher {
+    std::size_t operator()(const std::string &key) const noexcept {
+        return static_cast<std::size_t>(rainy::utility::implements::rapidhash_bytes(key.data(), key.size()));
+    }
+};
+
+struct rapidhash_constexpr_hasher {
+    std::size_t operator()(const std::string &key) const noexcept {
+        return static_cast<std::size_t>(rainy::utility::implements::rapidhash_chars(key.data(), key.size()));
+    }
+};
+
+using rainy_hasher = rainy::utility::hash<std::string>;
+using std_hasher = std::hash<std::string>;
+
+#define RAINY_STRING_HASH_BENCHMARK(hasher) BENCHMARK_TEMPLATE(string_hash, hasher)->RangeMultiplier(2)->Range(8, 256)
+
+RAINY_STRING_HASH_BENCHMARK(fnv1a_hasher);
+RAINY_STRING_HASH_BENCHMARK(rapidhash_hasher);
+RAINY_STRING_HASH_BENCHMARK(rapidhash_constexpr_hasher);
+RAINY_STRING_HASH_BENCHMARK(rainy_hasher);
+RAINY_STRING_HASH_BENCHMARK(std_hasher);
+
+BENCHMARK_MAIN();
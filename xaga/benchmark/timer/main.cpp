@@ -0,0 +1,82 @@
+#include <benchmark/benchmark.h>
+#include <rainy/foundation/io/executor/implements/timer_queue.hpp>
+#include <rainy/foundation/io/timer.hpp>
+#include <memory>
+#include <vector>
+
+using namespace rainy::foundation::io;
+
+// 只测时间轮本身：挂入 N 个分布在 0 ~ 60s 内的节点，再全部摘除
+static void timer_wheel_schedule_remove(benchmark::State &state) {
+    const auto count = static_cast<std::size_t>(state.range(0));
+    std::vector<implements::timer_entry> entries(count);
+    implements::timer_wheel wheel;
+    const std::uint64_t now = implements::timer_wheel::steady_now_ns();
+    for (auto _: state) {
+        for (std::size_t i = 0; i < count; ++i) {
+            wheel.schedule(entries[i], now + (i % 60'000 + 1) * implements::timer_wheel::tick_ns);
+        }
+        for (std::size_t i = 0; i < count; ++i) {
+            wheel.remove(entries[i]);
+        }
+        benchmark::DoNotOptimize(wheel.size());
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * count));
+}
+BENCHMARK(timer_wheel_schedule_remove)->Arg(1'000'000)->Unit(benchmark::kMillisecond);
+
+// 通过 steady_timer 发起 N 个异步等待并全部取消，再由 poll() 执行被取消的处理器
+static void steady_timer_arm_cancel(benchmark::State &state) {
+    const auto count = static_cast<std::size_t>(state.range(0));
+    io_context ctx;
+    std::vector<std::unique_ptr<steady_timer>> timers;
+    timers.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        timers.push_back(std::make_unique<steady_timer>(ctx));
+    }
+    std::size_t fired = 0;
+    for (auto _: state) {
+        for (std::size_t i = 0; i < count; ++i) {
+            timers[i]->expires_after(std::chrono::milliseconds(i % 60'000 + 1'000));
+            timers[i]->async_wait([&fired](std::error_code) { ++fired; });
+        }
+        for (auto &timer: timers) {
+            timer->cancel();
+        }
+        ctx.restart();
+        ctx.poll();
+    }
+    benchmark::DoNotOptimize(fired);
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * count));
+}
+BENCHMARK(steady_timer_arm_cancel)->Arg(1'000'000)->Unit(benchmark::kMillisecond);
+
+// 反复重新设置同一批定时器的到期时间（expires_after 会取消旧的等待）
+static void steady_timer_rearm(benchmark::State &state) {
+    const auto count = static_cast<std::size_t>(state.range(0));
+    io_context ctx;
+    std::vector<std::unique_ptr<steady_timer>> timers;
+    timers.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        timers.push_back(std::make_unique<steady_timer>(ctx));
+        timers.back()->expires_after(std::chrono::seconds(30));
+        timers.back()->async_wait([](std::error_code) {});
+    }
+    for (auto _: state) {
+        for (std::size_t i = 0; i < count; ++i) {
+            timers[i]->expires_after(std::chrono::milliseconds(i % 60'000 + 1'000));
+            timers[i]->async_wait([](std::error_code) {});
+        }
+        ctx.restart();
+        ctx.poll();
+    }
+    for (auto &timer: timers) {
+        timer->cancel();
+    }
+    ctx.restart();
+    ctx.poll();
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * count));
+}
+BENCHMARK(steady_timer_rearm)->Arg(1'000'000)->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
@@ -4,6 +4,7 @@
 
 #if RAINY_HAS_CXX20
 #include <rainy/async/concepts/coro.hpp>
+#include <rainy/foundation/memory/recycling_allocator.hpp>
 #include <condition_variable>
 #include <coroutine>
 #include <stdexcept>
@@ -19,7 +20,26 @@ namespace rainy::async {
 }
 
 namespace rainy::async::implements {
-    struct promise_base {
+    /**
+     * @brief 协程帧经线程本地的回收缓存分配（awaitable_frame_tag 槽位）
+     *
+     * 在同一线程上反复创建、销毁同等大小的协程时，帧内存直接复用上一次释放的块，不进入全局堆。
+     */
+    struct recycled_frame {
+        static void *operator new(const std::size_t size) {
+            return frame_allocator{}.allocate(size);
+        }
+
+        static void operator delete(void *pointer, const std::size_t size) noexcept {
+            frame_allocator{}.deallocate(static_cast<unsigned char *>(pointer), size);
+        }
+
+    private:
+        using frame_allocator =
+            foundation::memory::recycling_allocator<unsigned char, foundation::concurrency::implements::thread_info_base::awaitable_frame_tag>;
+    };
+
+    struct promise_base : recycled_frame {
         friend struct final_awaitable;
         struct final_awaitable {
             static bool await_ready() noexcept {
@@ -98,7 +118,7 @@ namespace rainy::async {
         std::atomic<bool> set_{false};
     };
 
-    class sync_wait_task_promise_base {
+    class sync_wait_task_promise_base : public implements::recycled_frame {
     public:
         sync_wait_task_promise_base() noexcept = default;
 
@@ -166,6 +186,10 @@ namespace rainy::async {
             }
         }
 
+        auto unhandled_exception() -> void {
+            storage.template emplace<std::exception_ptr>(std::current_exception());
+        }
+
         auto final_suspend() const noexcept {
             struct completion_notifier {
                 static bool await_ready() noexcept {
@@ -316,7 +340,7 @@ namespace rainy::async {
     class coroutine_task {
     public:
         using task_type = coroutine_task;
-        using promise_type = promise<return_type>;
+        using promise_type = async::promise<return_type>;
         using coroutine_handle = std::coroutine_handle<promise_type>;
 
         struct awaitable {
@@ -549,7 +573,7 @@ namespace rainy::async {
 
 namespace rainy::async::implements {
     template <typename T>
-    class generator_promise {
+    class generator_promise : public recycled_frame {
     public:
         using value_type = std::remove_reference_t<T>;
         using reference_type = std::conditional_t<std::is_reference_v<T>, T, T &>;
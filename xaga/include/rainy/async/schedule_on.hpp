@@ -0,0 +1,44 @@
+#ifndef RAINY_ASYNC_SCHEDULE_ON_HPP
+#define RAINY_ASYNC_SCHEDULE_ON_HPP
+#include <rainy/core/core.hpp>
+
+#if RAINY_HAS_CXX20
+#include <coroutine>
+#include <rainy/foundation/concurrency/basic/scheduler.hpp>
+
+namespace rainy::async::implements {
+    class scheduler_awaitable {
+    public:
+        explicit scheduler_awaitable(foundation::concurrency::task_scheduler &scheduler) noexcept : scheduler_(&scheduler) {
+        }
+
+        static constexpr bool await_ready() noexcept {
+            return false;
+        }
+
+        void await_suspend(const std::coroutine_handle<> waiter) const {
+            scheduler_->submit([waiter] { waiter.resume(); });
+        }
+
+        static constexpr void await_resume() noexcept {
+        }
+
+    private:
+        foundation::concurrency::task_scheduler *scheduler_;
+    };
+}
+
+namespace rainy::async {
+    /**
+     * @brief co_await schedule_on(pool) 之后，协程的剩余部分作为一个任务在 pool 的工作线程上继续执行
+     *
+     * 恢复句柄只占一个指针，提交给调度器时不会为闭包单独分配内存。
+     */
+    inline implements::scheduler_awaitable schedule_on(foundation::concurrency::task_scheduler &scheduler) noexcept {
+        return implements::scheduler_awaitable{scheduler};
+    }
+}
+
+#endif
+
+#endif
@@ -0,0 +1,315 @@
+#ifndef RAINY_ASYNC_WHEN_ALL_HPP
+#define RAINY_ASYNC_WHEN_ALL_HPP
+#include <rainy/core/core.hpp>
+
+#if RAINY_HAS_CXX20
+#include <atomic>
+#include <coroutine>
+#include <exception>
+#include <tuple>
+#include <variant>
+#include <vector>
+#include <rainy/async/coro.hpp>
+#include <rainy/foundation/diagnostics/contract.hpp>
+
+namespace rainy::async::implements {
+    /**
+     * @brief 立即开始执行、结束后自行销毁的协程，用来驱动子任务并在其结束时发出通知
+     */
+    struct detached_task {
+        struct promise_type : recycled_frame {
+            static detached_task get_return_object() noexcept {
+                return {};
+            }
+
+            static std::suspend_never initial_suspend() noexcept {
+                return {};
+            }
+
+            static std::suspend_never final_suspend() noexcept {
+                return {};
+            }
+
+            static void return_void() noexcept {
+            }
+
+            static void unhandled_exception() noexcept {
+                std::terminate();
+            }
+        };
+    };
+
+    /**
+     * @brief 等待子任务结束但不取出结果，结果与异常留在子任务的 promise 中
+     */
+    template <typename Ty>
+    struct completion_awaiter {
+        bool await_ready() const noexcept {
+            return !coro || coro.done();
+        }
+
+        std::coroutine_handle<> await_suspend(const std::coroutine_handle<> waiter) noexcept {
+            coro.promise().continuation(waiter);
+            return coro;
+        }
+
+        static void await_resume() noexcept {
+        }
+
+        std::coroutine_handle<promise<Ty>> coro;
+    };
+
+    /**
+     * @brief 计数为子任务数加一，多出的一次由等待方在挂起前扣除，因此最后一个到达者总能看到等待方的句柄
+     */
+    class when_all_latch {
+    public:
+        explicit when_all_latch(const std::size_t count) noexcept : count_(count + 1) {
+        }
+
+        void arrive() noexcept {
+            if (count_.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                waiter_.resume();
+            }
+        }
+
+        /**
+         * @return 仍有子任务未结束、等待方应挂起时返回 true
+         */
+        bool try_await(const std::coroutine_handle<> waiter) noexcept {
+            waiter_ = waiter;
+            return count_.fetch_sub(1, std::memory_order_acq_rel) > 1;
+        }
+
+    private:
+        std::atomic<std::size_t> count_;
+        std::coroutine_handle<> waiter_;
+    };
+
+    template <typename Ty>
+    detached_task drive_when_all(coroutine_task<Ty> &task, when_all_latch &latch) {
+        co_await completion_awaiter<Ty>{task.handle()};
+        latch.arrive();
+    }
+
+    template <typename Tasks>
+    class when_all_awaiter {
+    public:
+        when_all_awaiter(Tasks &tasks, const std::size_t count) noexcept : tasks_(tasks), latch_(count) {
+        }
+
+        static constexpr bool await_ready() noexcept {
+            return false;
+        }
+
+        bool await_suspend(const std::coroutine_handle<> waiter) noexcept {
+            if constexpr (requires(Tasks &t) { t.begin(); }) {
+                for (auto &task: tasks_) {
+                    drive_when_all(task, latch_);
+                }
+            } else {
+                std::apply([this](auto &...task) { (drive_when_all(task, latch_), ...); }, tasks_);
+            }
+            return latch_.try_await(waiter);
+        }
+
+        static void await_resume() noexcept {
+        }
+
+    private:
+        Tasks &tasks_;
+        when_all_latch latch_;
+    };
+
+    template <typename Ty>
+    using when_all_value_t = type_traits::other_trans::conditional_t<type_traits::primary_types::is_void_v<Ty>, std::monostate, Ty>;
+
+    template <typename Ty>
+    when_all_value_t<Ty> take_result(coroutine_task<Ty> &task) {
+        if constexpr (type_traits::primary_types::is_void_v<Ty>) {
+            task.promise().result();
+            return {};
+        } else {
+            return task.promise().result();
+        }
+    }
+
+    /**
+     * @brief when_any 的共享状态：子任务被移入其中，由等待方与每个驱动协程各持有一个引用，
+     *        落选的子任务因此可以在等待方返回后继续运行至结束
+     */
+    template <typename Ty>
+    class when_any_state {
+    public:
+        explicit when_any_state(std::vector<coroutine_task<Ty>> tasks) :
+            tasks_(utility::move(tasks)), refs_(tasks_.size() + 1) {
+        }
+
+        void release() noexcept {
+            if (refs_.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                delete this;
+            }
+        }
+
+        void arrive(const std::size_t index) noexcept {
+            if (!decided_.exchange(true, std::memory_order_acq_rel)) {
+                winner_ = index;
+                if (phase_.exchange(completed, std::memory_order_acq_rel) == suspended) {
+                    waiter_.resume();
+                }
+            }
+        }
+
+        bool try_await(const std::coroutine_handle<> waiter) noexcept {
+            waiter_ = waiter;
+            int expected = pending;
+            return phase_.compare_exchange_strong(expected, suspended, std::memory_order_acq_rel, std::memory_order_acquire);
+        }
+
+        std::vector<coroutine_task<Ty>> &tasks() noexcept {
+            return tasks_;
+        }
+
+        RAINY_NODISCARD std::size_t winner() const noexcept {
+            return winner_;
+        }
+
+    private:
+        enum : int {
+            pending,
+            suspended,
+            completed
+        };
+
+        std::vector<coroutine_task<Ty>> tasks_;
+        std::atomic<std::size_t> refs_;
+        std::atomic<bool> decided_{false};
+        std::atomic<int> phase_{pending};
+        std::size_t winner_{0};
+        std::coroutine_handle<> waiter_;
+    };
+
+    template <typename Ty>
+    detached_task drive_when_any(when_any_state<Ty> *state, const std::size_t index) {
+        co_await completion_awaiter<Ty>{state->tasks()[index].handle()};
+        state->arrive(index);
+        state->release();
+    }
+
+    template <typename Ty>
+    class when_any_awaiter {
+    public:
+        explicit when_any_awaiter(when_any_state<Ty> *state) noexcept : state_(state) {
+        }
+
+        static constexpr bool await_ready() noexcept {
+            return false;
+        }
+
+        bool await_suspend(const std::coroutine_handle<> waiter) noexcept {
+            for (std::size_t i = 0; i < state_->tasks().size(); ++i) {
+                drive_when_any(state_, i);
+            }
+            return state_->try_await(waiter);
+        }
+
+        static void await_resume() noexcept {
+        }
+
+    private:
+        when_any_state<Ty> *state_;
+    };
+}
+
+namespace rainy::async {
+    /**
+     * @brief when_any 的结果：最先结束的子任务下标及其返回值
+     */
+    template <typename Ty>
+    struct when_any_result {
+        std::size_t index;
+        Ty value;
+    };
+
+    template <>
+    struct when_any_result<void> {
+        std::size_t index;
+    };
+
+    /**
+     * @brief 并发启动全部子任务，全部结束后以 std::tuple 返回各自的结果，void 任务对应 std::monostate
+     *
+     * 子任务在调用 co_await 的线程上依次启动，直到各自首次挂起；最后一个结束的子任务所在线程恢复等待方。
+     * 有子任务抛出异常时，按参数顺序重新抛出第一个。
+     */
+    template <typename... Ts>
+    coroutine_task<std::tuple<implements::when_all_value_t<Ts>...>> when_all(coroutine_task<Ts>... tasks) {
+        auto refs = std::tie(tasks...);
+        co_await implements::when_all_awaiter<decltype(refs)>{refs, sizeof...(Ts)};
+        co_return std::tuple<implements::when_all_value_t<Ts>...>{implements::take_result(tasks)...};
+    }
+
+    /**
+     * @brief 动态数量的 when_all，结果按输入顺序排列
+     */
+    template <typename Ty>
+    auto when_all(std::vector<coroutine_task<Ty>> tasks)
+        -> coroutine_task<type_traits::other_trans::conditional_t<type_traits::primary_types::is_void_v<Ty>, void, std::vector<Ty>>> {
+        if (!tasks.empty()) {
+            co_await implements::when_all_awaiter<std::vector<coroutine_task<Ty>>>{tasks, tasks.size()};
+        }
+        if constexpr (type_traits::primary_types::is_void_v<Ty>) {
+            for (auto &task: tasks) {
+                task.promise().result();
+            }
+        } else {
+            std::vector<Ty> results;
+            results.reserve(tasks.size());
+            for (auto &task: tasks) {
+                results.push_back(task.promise().result());
+            }
+            co_return results;
+        }
+    }
+
+    /**
+     * @brief 并发启动全部子任务，最先结束的一个决定结果
+     *
+     * 其余子任务不会被取消，它们在后台继续运行至结束后随共享状态一起释放。最先结束的子任务抛出异常时重新抛出。
+     */
+    template <typename Ty>
+    coroutine_task<when_any_result<Ty>> when_any(std::vector<coroutine_task<Ty>> tasks) {
+        utility::expects(!tasks.empty(), "when_any requires at least one task");
+        auto *state = new implements::when_any_state<Ty>(utility::move(tasks));
+        co_await implements::when_any_awaiter<Ty>{state};
+        const std::size_t index = state->winner();
+        try {
+            if constexpr (type_traits::primary_types::is_void_v<Ty>) {
+                state->tasks()[index].promise().result();
+                state->release();
+                co_return when_any_result<void>{index};
+            } else {
+                when_any_result<Ty> result{index, state->tasks()[index].promise().result()};
+                state->release();
+                co_return result;
+            }
+        } catch (...) {
+            state->release();
+            throw;
+        }
+    }
+
+    template <typename Ty, typename... Rest>
+        requires(type_traits::type_relations::is_same_v<Ty, Rest> && ...)
+    coroutine_task<when_any_result<Ty>> when_any(coroutine_task<Ty> first, coroutine_task<Rest>... rest) {
+        std::vector<coroutine_task<Ty>> tasks;
+        tasks.reserve(1 + sizeof...(Rest));
+        tasks.push_back(utility::move(first));
+        (tasks.push_back(utility::move(rest)), ...);
+        co_return co_await when_any(utility::move(tasks));
+    }
+}
+
+#endif
+
+#endif
@@ -2,9 +2,12 @@
 #define RAINY_ALGORITHM_PRE_H
 
 #include <rainy/core/core.hpp>
-#include <rainy/collections/array.hpp>
+#include <rainy/core/yesod/collections/array.hpp>
 #include <vector>
-#include <future>
+
+namespace rainy::foundation::concurrency {
+    class pooled_actor_pool;
+}
 
 namespace rainy::collections::algorithm::execution {
     enum policy {
@@ -12,6 +15,38 @@ namespace rainy::collections::algorithm::execution {
         seq,
         max_par
     };
+
+    /**
+     * @brief 并行算法的执行参数
+     *
+     * grain 为单个任务处理的最少元素数，0 表示由算法按元素数与线程数自动选择；
+     * pool 为空时使用 foundation::concurrency::shared_pooled_pool()。可由 policy 隐式构造。
+     */
+    struct parallel_policy {
+        constexpr parallel_policy(const policy mode = par, const std::size_t grain = 0, // NOLINT
+                                  foundation::concurrency::pooled_actor_pool *pool = nullptr) noexcept :
+            mode(mode), grain(grain), pool(pool) {
+        }
+
+        policy mode;
+        std::size_t grain;
+        foundation::concurrency::pooled_actor_pool *pool;
+    };
+
+    /**
+     * @brief 以指定粒度执行，例如 copy(with_grain(par, 4096), ...)
+     */
+    constexpr parallel_policy with_grain(const policy mode, const std::size_t grain) noexcept {
+        return {mode, grain};
+    }
+
+    /**
+     * @brief 在指定 pool 上执行
+     */
+    constexpr parallel_policy on(foundation::concurrency::pooled_actor_pool &pool, const policy mode = par,
+                                 const std::size_t grain = 0) noexcept {
+        return {mode, grain, &pool};
+    }
 }
 
 namespace rainy::collections::algorithm::implements {
@@ -1,102 +1,318 @@
 #ifndef RAINY_MODIFY_ALGORITHM_OPERATOR
 #define RAINY_MODIFY_ALGORITHM_OPERATOR
-#include <rainy/algorithm/execution.h>
+#include <algorithm>
+#include <functional>
+#include <optional>
+#include <vector>
+#include <rainy/core/core.hpp>
+#include <rainy/collections/algorithm/execution.h>
+#include <rainy/foundation/concurrency/basic/fork_join.hpp>
 
+namespace rainy::collections::algorithm::implements {
+    template <typename... Iters>
+    RAINY_CONSTEXPR_BOOL parallelizable_v = (type_traits::extras::iterators::is_random_access_iterator_v<Iters> && ...);
+
+    struct parallel_plan {
+        foundation::concurrency::pooled_actor_pool *pool;
+        std::size_t grain;
+        bool parallel;
+    };
+
+    /**
+     * @brief 根据执行参数与元素数决定是否并行及粒度
+     *
+     * max_par 把区间均分为 concurrency 段；par 使用 default_grain，每段足够大以摊薄派生与窃取的开销。
+     * 元素数不超过粒度或 pool 只有一个线程时退化为顺序执行。
+     */
+    inline parallel_plan make_parallel_plan(const execution::parallel_policy &policy, const std::size_t count) {
+        if (policy.mode == execution::seq || count < 2) {
+            return {nullptr, count, false};
+        }
+        foundation::concurrency::pooled_actor_pool *pool = policy.pool ? policy.pool : &foundation::concurrency::shared_pooled_pool();
+        const std::size_t concurrency = (core::max) (pool->traits().concurrency, std::size_t{1});
+        std::size_t grain = policy.grain;
+        if (grain == 0) {
+            grain = policy.mode == execution::max_par ? (count + concurrency - 1) / concurrency
+                                                      : foundation::concurrency::default_grain(count, concurrency);
+        }
+        return {pool, grain, concurrency > 1 && count > grain};
+    }
+
+    /**
+     * @brief 把 [0, count) 按 grain 切成固定的连续块
+     *
+     * 块边界只取决于 count 与 grain，与哪个线程以何种顺序执行无关，reduce/scan 的合并顺序因此可复现。
+     */
+    struct fixed_chunks {
+        fixed_chunks(const std::size_t count, const std::size_t grain) noexcept :
+            count(count), chunks((count + grain - 1) / grain) {
+        }
+
+        RAINY_NODISCARD std::size_t begin(const std::size_t k) const noexcept {
+            return count * k / chunks;
+        }
+
+        RAINY_NODISCARD std::size_t end(const std::size_t k) const noexcept {
+            return count * (k + 1) / chunks;
+        }
+
+        std::size_t count;
+        std::size_t chunks;
+    };
+
+    template <typename Iter, typename Compare>
+    void parallel_merge_sort(foundation::concurrency::pooled_actor_pool &pool, Iter first, Iter last, const std::size_t grain,
+                             Compare &comp) {
+        const std::size_t count = static_cast<std::size_t>(last - first);
+        if (count <= grain) {
+            std::sort(first, last, comp);
+            return;
+        }
+        Iter mid = first + static_cast<std::ptrdiff_t>(count / 2);
+        foundation::concurrency::parallel_invoke(
+            pool, [&] { parallel_merge_sort(pool, first, mid, grain, comp); },
+            [&] { parallel_merge_sort(pool, mid, last, grain, comp); });
+        std::inplace_merge(first, mid, last, comp);
+    }
+}
+
+/*
+ * 并行算法：随机访问迭代器上递归二分区间，子区间经 fork_join_group 派生到共享的 pooled_actor_pool，
+ * 不再为每一段创建 std::async 线程。其余迭代器类别、seq 策略或元素数不足一个粒度时调用顺序版本。
+ * 子任务抛出的异常会在调用线程重新抛出。
+ */
 namespace rainy::collections::algorithm::container_operater {
-    template <typename InputIter, typename OutIter>
-    RAINY_CONSTEXPR20 OutIter copy(execution::policy policy, InputIter begin, InputIter end, OutIter dest) {
-        using value_type = typename utility::iterator_traits<InputIter>::value_type;
-        if (policy == execution::seq) {
-            return copy(begin, end, dest);
+    template <typename Iter, typename Fx>
+    void for_each(const execution::parallel_policy &policy, Iter first, Iter last, Fx func) {
+        if constexpr (implements::parallelizable_v<Iter>) {
+            const std::size_t count = static_cast<std::size_t>(last - first);
+            if (const auto plan = implements::make_parallel_plan(policy, count); plan.parallel) {
+                foundation::concurrency::parallel_for(*plan.pool, 0, count, plan.grain, [&](const std::size_t b, const std::size_t e) {
+                    for (Iter it = first + static_cast<std::ptrdiff_t>(b), end = first + static_cast<std::ptrdiff_t>(e); it != end; ++it) {
+                        func(*it);
+                    }
+                });
+                return;
+            }
         }
-#if RAINY_HAS_CXX20
-        if (std::is_constant_evaluated()) {
-            return copy(begin, end, dest);
+        for (; first != last; ++first) {
+            func(*first);
         }
-#endif
+    }
 
-        auto input_begin = utility::addressof(*begin);
-        const std::size_t count = utility::distance(begin, end);
-        std::size_t threads = implements::get_paralells(count);
-        if (policy == execution::max_par) {
-            threads = core::max_threads;
-        } else {
-            if (threads == 1) {
-                return copy(begin, end, dest);
+    template <typename InputIter, typename OutIter, typename Fx>
+    OutIter transform(const execution::parallel_policy &policy, InputIter first, InputIter last, OutIter dest, Fx func) {
+        if constexpr (implements::parallelizable_v<InputIter, OutIter>) {
+            const std::size_t count = static_cast<std::size_t>(last - first);
+            if (const auto plan = implements::make_parallel_plan(policy, count); plan.parallel) {
+                foundation::concurrency::parallel_for(*plan.pool, 0, count, plan.grain, [&](const std::size_t b, const std::size_t e) {
+                    core::algorithm::transform(first + static_cast<std::ptrdiff_t>(b), first + static_cast<std::ptrdiff_t>(e),
+                                               dest + static_cast<std::ptrdiff_t>(b), func);
+                });
+                return dest + static_cast<std::ptrdiff_t>(count);
             }
         }
-        std::size_t chunk_size = count / threads;
-        std::size_t remainder = count % threads;
-        std::vector<std::future<void>> tasks(threads);
-        InputIter chunk_start = begin;
-        OutIter chunk_dest = dest;
-        for (std::size_t i = 0; i < threads; ++i) {
-            std::size_t current_chunk_size = chunk_size + (i < remainder ? 1 : 0);
-            tasks.emplace_back(std::async(std::launch::async, [chunk_start, chunk_dest, current_chunk_size]() {
-                copy_n(chunk_start, current_chunk_size, chunk_dest);
-            }));
-            std::advance(chunk_start, current_chunk_size);
-            std::advance(chunk_dest, current_chunk_size);
+        return core::algorithm::transform(first, last, dest, func);
+    }
+
+    template <typename InputIter1, typename InputIter2, typename OutIter, typename Fx>
+    OutIter transform(const execution::parallel_policy &policy, InputIter1 first1, InputIter1 last1, InputIter2 first2, OutIter dest,
+                      Fx func) {
+        if constexpr (implements::parallelizable_v<InputIter1, InputIter2, OutIter>) {
+            const std::size_t count = static_cast<std::size_t>(last1 - first1);
+            if (const auto plan = implements::make_parallel_plan(policy, count); plan.parallel) {
+                foundation::concurrency::parallel_for(*plan.pool, 0, count, plan.grain, [&](const std::size_t b, const std::size_t e) {
+                    for (std::size_t i = b; i < e; ++i) {
+                        const auto off = static_cast<std::ptrdiff_t>(i);
+                        dest[off] = func(first1[off], first2[off]);
+                    }
+                });
+                return dest + static_cast<std::ptrdiff_t>(count);
+            }
         }
-        for (auto &task: tasks) {
-            task.get();
+        for (; first1 != last1; ++first1, ++first2, ++dest) {
+            *dest = func(*first1, *first2);
         }
-        return chunk_dest;
+        return dest;
     }
 
     template <typename InputIter, typename OutIter>
-    RAINY_CONSTEXPR20 OutIter copy_n(execution::policy policy, InputIter begin, const std::size_t count, OutIter dest) {
-        using value_type = typename InputIter::value_type;
-        if (policy == execution::seq) {
-            return copy_n(begin, count, dest);
+    OutIter copy_n(const execution::parallel_policy &policy, InputIter begin, const std::size_t count, OutIter dest) {
+        if constexpr (implements::parallelizable_v<InputIter, OutIter>) {
+            if (const auto plan = implements::make_parallel_plan(policy, count); plan.parallel) {
+                foundation::concurrency::parallel_for(*plan.pool, 0, count, plan.grain, [&](const std::size_t b, const std::size_t e) {
+                    core::algorithm::copy_n(begin + static_cast<std::ptrdiff_t>(b), e - b, dest + static_cast<std::ptrdiff_t>(b));
+                });
+                return dest + static_cast<std::ptrdiff_t>(count);
+            }
         }
-#if RAINY_HAS_CXX20
-        if (std::is_constant_evaluated()) {
-            return copy_n(begin, count, dest);
+        for (std::size_t i = 0; i < count; ++i, ++begin, ++dest) {
+            *dest = *begin;
         }
-#endif
-        auto input_begin = utility::addressof(*begin);
-        std::size_t threads = implements::get_paralells(count); // 获取可能的规模并计算出可能适合的线程数量（考虑最大线程数）
-        if (policy == execution::max_par) {
-            threads = core::max_threads;
+        return dest;
+    }
+
+    template <typename InputIter, typename OutIter>
+    OutIter copy(const execution::parallel_policy &policy, InputIter begin, InputIter end, OutIter dest) {
+        if constexpr (implements::parallelizable_v<InputIter, OutIter>) {
+            return container_operater::copy_n(policy, begin, static_cast<std::size_t>(end - begin), dest);
+        } else {
+            for (; begin != end; ++begin, ++dest) {
+                *dest = *begin;
+            }
+            return dest;
+        }
+    }
+
+    template <typename Iter, typename Ty>
+    Iter fill_n(const execution::parallel_policy &policy, Iter first, const std::size_t count, const Ty &value) {
+        if constexpr (implements::parallelizable_v<Iter>) {
+            if (const auto plan = implements::make_parallel_plan(policy, count); plan.parallel) {
+                foundation::concurrency::parallel_for(*plan.pool, 0, count, plan.grain, [&](const std::size_t b, const std::size_t e) {
+                    core::algorithm::fill_n(first + static_cast<std::ptrdiff_t>(b), e - b, value);
+                });
+                return first + static_cast<std::ptrdiff_t>(count);
+            }
+        }
+        return core::algorithm::fill_n(first, count, value);
+    }
+
+    template <typename Iter, typename Ty>
+    void fill(const execution::parallel_policy &policy, Iter first, Iter last, const Ty &value) {
+        if constexpr (implements::parallelizable_v<Iter>) {
+            container_operater::fill_n(policy, first, static_cast<std::size_t>(last - first), value);
         } else {
-            if (threads == 1) {
-                // 线程数若为1，则只调用单线程版本
-                return copy_n(begin, count, dest);
+            core::algorithm::fill(first, last, value);
+        }
+    }
+
+    /**
+     * @brief 并行 transform_reduce
+     *
+     * 每个固定块先从块首元素开始顺序归约，再按块的顺序与 init 合并。reduce_op 需满足结合律，
+     * 但不要求交换律：元素参与运算的相对顺序与顺序版本一致。
+     */
+    template <typename Iter, typename Ty, typename ReduceOp, typename TransformOp>
+    Ty transform_reduce(const execution::parallel_policy &policy, Iter first, Iter last, Ty init, ReduceOp reduce_op,
+                        TransformOp transform_op) {
+        if constexpr (implements::parallelizable_v<Iter>) {
+            const std::size_t count = static_cast<std::size_t>(last - first);
+            if (const auto plan = implements::make_parallel_plan(policy, count); plan.parallel) {
+                const implements::fixed_chunks chunks(count, plan.grain);
+                std::vector<std::optional<Ty>> partial(chunks.chunks);
+                foundation::concurrency::parallel_for(*plan.pool, 0, chunks.chunks, 1, [&](const std::size_t b, const std::size_t e) {
+                    for (std::size_t k = b; k < e; ++k) {
+                        Iter it = first + static_cast<std::ptrdiff_t>(chunks.begin(k));
+                        const Iter end = first + static_cast<std::ptrdiff_t>(chunks.end(k));
+                        Ty acc = transform_op(*it);
+                        for (++it; it != end; ++it) {
+                            acc = reduce_op(utility::move(acc), transform_op(*it));
+                        }
+                        partial[k].emplace(utility::move(acc));
+                    }
+                });
+                for (auto &value: partial) {
+                    init = reduce_op(utility::move(init), utility::move(*value));
+                }
+                return init;
+            }
+        }
+        for (; first != last; ++first) {
+            init = reduce_op(utility::move(init), transform_op(*first));
+        }
+        return init;
+    }
+
+    template <typename Iter, typename Ty, typename ReduceOp = std::plus<>>
+    Ty reduce(const execution::parallel_policy &policy, Iter first, Iter last, Ty init, ReduceOp reduce_op = {}) {
+        return container_operater::transform_reduce(policy, first, last, utility::move(init), reduce_op,
+                                                    [](const auto &value) -> decltype(auto) { return value; });
+    }
+
+    template <typename Iter>
+    typename utility::iterator_traits<Iter>::value_type reduce(const execution::parallel_policy &policy, Iter first, Iter last) {
+        return container_operater::reduce(policy, first, last, typename utility::iterator_traits<Iter>::value_type{});
+    }
+
+    /**
+     * @brief 并行 inclusive_scan，允许 dest == first 原地执行
+     *
+     * 两趟完成：第一趟并行求各固定块的部分和，顺序求出各块的前缀偏移，第二趟并行以偏移为起点写出结果。
+     * op 需满足结合律。
+     */
+    template <typename InputIter, typename OutIter, typename BinaryOp = std::plus<>>
+    OutIter inclusive_scan(const execution::parallel_policy &policy, InputIter first, InputIter last, OutIter dest, BinaryOp op = {}) {
+        using value_type = typename utility::iterator_traits<InputIter>::value_type;
+        if constexpr (implements::parallelizable_v<InputIter, OutIter>) {
+            const std::size_t count = static_cast<std::size_t>(last - first);
+            if (const auto plan = implements::make_parallel_plan(policy, count); plan.parallel) {
+                const implements::fixed_chunks chunks(count, plan.grain);
+                std::vector<std::optional<value_type>> offsets(chunks.chunks);
+                foundation::concurrency::parallel_for(*plan.pool, 0, chunks.chunks - 1, 1, [&](const std::size_t b, const std::size_t e) {
+                    for (std::size_t k = b; k < e; ++k) {
+                        const std::size_t end = chunks.end(k);
+                        value_type acc = first[static_cast<std::ptrdiff_t>(chunks.begin(k))];
+                        for (std::size_t i = chunks.begin(k) + 1; i < end; ++i) {
+                            acc = op(utility::move(acc), first[static_cast<std::ptrdiff_t>(i)]);
+                        }
+                        offsets[k + 1].emplace(utility::move(acc));
+                    }
+                });
+                for (std::size_t k = 2; k < chunks.chunks; ++k) {
+                    offsets[k].emplace(op(*offsets[k - 1], utility::move(*offsets[k])));
+                }
+                foundation::concurrency::parallel_for(*plan.pool, 0, chunks.chunks, 1, [&](const std::size_t b, const std::size_t e) {
+                    for (std::size_t k = b; k < e; ++k) {
+                        std::size_t i = chunks.begin(k);
+                        const std::size_t end = chunks.end(k);
+                        value_type acc = offsets[k] ? op(*offsets[k], first[static_cast<std::ptrdiff_t>(i)])
+                                                    : value_type(first[static_cast<std::ptrdiff_t>(i)]);
+                        dest[static_cast<std::ptrdiff_t>(i)] = acc;
+                        for (++i; i < end; ++i) {
+                            acc = op(utility::move(acc), first[static_cast<std::ptrdiff_t>(i)]);
+                            dest[static_cast<std::ptrdiff_t>(i)] = acc;
+                        }
+                    }
+                });
+                return dest + static_cast<std::ptrdiff_t>(count);
             }
         }
-        std::size_t chunk_size = count / threads;
-        std::size_t remainder = count % threads;
-        std::vector<std::future<void>> tasks(threads); // 创建task表
-        InputIter chunk_start = begin;
-        OutIter chunk_dest = dest;
-        for (std::size_t i = 0; i < threads; ++i) {
-            std::size_t current_chunk_size = chunk_size + (i < remainder ? 1 : 0);
-            tasks.emplace_back(std::async(std::launch::async, [chunk_start, chunk_dest, current_chunk_size]() {
-                copy_n(chunk_start, current_chunk_size, chunk_dest);
-            }));
-            // 让std::async为我们分配工作线程（不考虑返回值）
-            std::advance(chunk_start, current_chunk_size);
-            std::advance(chunk_dest, current_chunk_size);
+        if (first == last) {
+            return dest;
         }
-        for (auto &task: tasks) {
-            task.get();
+        value_type acc = *first;
+        *dest = acc;
+        for (++first, ++dest; first != last; ++first, ++dest) {
+            acc = op(utility::move(acc), *first);
+            *dest = acc;
         }
-        return chunk_dest;
+        return dest;
     }
 
+    /**
+     * @brief 并行排序：两半并发递归排序后 inplace_merge，子区间不超过粒度时使用 std::sort，不保证稳定
+     */
+    template <typename Iter, typename Compare = std::less<>>
+    void sort(const execution::parallel_policy &policy, Iter first, Iter last, Compare comp = {}) {
+        const std::size_t count = static_cast<std::size_t>(last - first);
+        if (const auto plan = implements::make_parallel_plan(policy, count); plan.parallel) {
+            implements::parallel_merge_sort(*plan.pool, first, last, plan.grain, comp);
+            return;
+        }
+        std::sort(first, last, comp);
+    }
 }
 
 namespace rainy::component::ranges::container_operater {
     template <typename Rng, typename OutIter>
-    RAINY_CONSTEXPR20 OutIter copy(algorithm::execution::policy policy, Rng &&rng, OutIter dest) {
-        return algorithm::container_operater::copy(policy, utility::begin(rng), std::end(rng), dest);
+    OutIter copy(const collections::algorithm::execution::parallel_policy &policy, Rng &&rng, OutIter dest) {
+        return collections::algorithm::container_operater::copy(policy, utility::begin(rng), std::end(rng), dest);
     }
 
     template <typename Rng, typename OutIter>
-    RAINY_CONSTEXPR20 OutIter copy_n(algorithm::execution::policy policy, Rng &&rng, std::size_t count, OutIter dest) {
-        return algorithm::container_operater::copy_n(policy, utility::begin(rng), count, dest);
+    OutIter copy_n(const collections::algorithm::execution::parallel_policy &policy, Rng &&rng, std::size_t count, OutIter dest) {
+        return collections::algorithm::container_operater::copy_n(policy, utility::begin(rng), count, dest);
     }
 }
 
-#endif
\ No newline at end of file
+#endif
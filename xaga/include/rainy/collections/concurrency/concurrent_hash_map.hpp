@@ -0,0 +1,670 @@
+/*
+ * Copyright 2026 rainy-juzixiao
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef RAINY_COLLECTIONS_CONCURRENCY_CONCURRENT_HASH_MAP_HPP
+#define RAINY_COLLECTIONS_CONCURRENCY_CONCURRENT_HASH_MAP_HPP
+#include <atomic>
+#include <cstdint>
+#include <new>
+#include <tuple>
+#include <rainy/core/core.hpp>
+#include <rainy/foundation/concurrency/mutex.hpp>
+#include <rainy/foundation/functional/functor.hpp>
+#include <rainy/foundation/memory/epoch.hpp>
+#include <rainy/foundation/memory/hazard_pointer.hpp>
+
+/*
+ * 分片（lock striping）并发哈希表。
+ *
+ * 哈希值的高位选择分片，低位选择分片内的桶。写操作只持有所在分片的互斥量；读操作完全不加锁，
+ * 依次通过回收策略保护分片的桶表、桶以及节点，因此读方之间不会在任何共享缓存行上产生写竞争。
+ *
+ * 每个桶是一个只读的 {哈希值, 节点指针} 数组，写方复制并替换整个数组（copy-on-write），旧数组与被替换的节点交由回收域延迟释放。
+ * 数组中内联的哈希值让读方在比较键之前就能排除绝大多数候选，且无需逐节点追踪 next 指针。
+ *
+ * 扩容按分片独立、渐进地进行：分片负载超过阈值时分配两倍大小的新表并挂在旧表的 forward 上，
+ * 此后该分片的每次写操作迁移少量桶，被迁移的旧桶标记为 moved，读方遇到 moved 时转到 forward 表中查找。
+ * 全部桶迁移完成后才把新表发布为当前表，整个过程既不阻塞读方，也不会阻塞其他分片的写方。
+ */
+namespace rainy::collections::concurrency {
+    /**
+     * @brief 读操作无锁、写操作按分片加锁的并发哈希表
+     * @attention 节点、桶与桶表均由回收策略的域以 delete 释放，因此不支持自定义分配器
+     * @attention visit、for_each 的回调在保护或分片锁下执行，回调中不应再访问同一个容器
+     * @tparam Key 键类型
+     * @tparam Ty 映射类型，find 与 compute_if_absent 以副本形式返回，要求可复制构造
+     * @tparam Hash 哈希函数对象
+     * @tparam KeyEqual 键比较函数对象
+     * @tparam Reclamation 回收方案，可选 hazard_pointer_reclamation（默认）或 epoch_reclamation（每次读取只需进入一次临界区，读多写少时开销更低）
+     */
+    template <typename Key, typename Ty, typename Hash = utility::hash<Key>, typename KeyEqual = foundation::functional::equal<Key>,
+              typename Reclamation = foundation::memory::hazard_pointer_reclamation>
+    class concurrent_hash_map {
+    public:
+        using key_type = Key;
+        using mapped_type = Ty;
+        using value_type = utility::pair<const Key, Ty>;
+        using size_type = std::size_t;
+        using hasher = Hash;
+        using key_equal = KeyEqual;
+        using reclamation_type = Reclamation;
+        using guard_type = typename Reclamation::guard_type;
+
+        static constexpr size_type default_shard_count = 64;
+        static constexpr size_type default_bucket_count = 16;
+
+        /**
+         * @brief 迁移进行中时，每次写操作额外搬迁的桶数
+         */
+        static constexpr size_type migration_step = 8;
+
+        explicit concurrent_hash_map(const size_type shard_count = default_shard_count,
+                                     const size_type bucket_count_per_shard = default_bucket_count, const hasher &hash = hasher{},
+                                     const key_equal &equal = key_equal{}) :
+            shard_count_(core::builtin::next_power_of_two(shard_count == 0 ? size_type{1} : shard_count)),
+            shard_shift_(size_bits - (core::builtin::bit_width(shard_count_) - 1)), hasher_(hash),
+            equal_(equal) {
+            const size_type buckets = core::builtin::next_power_of_two(bucket_count_per_shard < 2 ? size_type{2} : bucket_count_per_shard);
+            shards_ = new shard[shard_count_];
+            for (size_type index = 0; index < shard_count_; ++index) {
+                shards_[index].current.store(new table(buckets), std::memory_order_relaxed);
+            }
+        }
+
+        concurrent_hash_map(const concurrent_hash_map &) = delete;
+        concurrent_hash_map &operator=(const concurrent_hash_map &) = delete;
+
+        ~concurrent_hash_map() {
+            // 析构时不再有并发访问者，直接释放而不经过回收域
+            for (size_type index = 0; index < shard_count_; ++index) {
+                table *tab = shards_[index].current.load(std::memory_order_relaxed);
+                if (table *next = tab->forward.load(std::memory_order_relaxed)) {
+                    destroy_table(next);
+                }
+                destroy_table(tab);
+            }
+            delete[] shards_;
+        }
+
+        /**
+         * @brief 查找 key 并在受保护的状态下以 const value_type & 调用 func
+         * @return 是否找到
+         */
+        template <typename Func>
+        bool visit(const key_type &key, Func &&func) const {
+            const size_type hash = hash_of(key);
+            const shard &target = shard_for(hash);
+            read_guards guards;
+            for (;;) {
+                table *tab = protect_load(guards.table, target.current);
+                const std::atomic<bucket *> *slot = &tab->slot(hash);
+                bucket *items = protect_load(guards.bucket, *slot);
+                if (items == moved_marker()) {
+                    // 桶已迁移到 forward 表；只要当前表仍是 tab 或其 forward，forward 表就不会被回收。
+                    // 校验期间暂借桶的槽位保护 forward 表，tab 仍由桶表槽位保护，避免比较到已被复用的地址
+                    table *next = tab->forward.load(std::memory_order_acquire);
+                    guards.bucket.protect(next);
+                    publish_protection();
+                    const table *now = target.current.load(std::memory_order_acquire);
+                    if (now != tab && now != next) {
+                        continue;
+                    }
+                    guards.table.protect(next);
+                    slot = &next->slot(hash);
+                    items = protect_load(guards.bucket, *slot);
+                    if (items == moved_marker()) {
+                        continue;
+                    }
+                }
+                if (!items) {
+                    return false;
+                }
+                bool restart = false;
+                const entry *entries = items->entries();
+                for (size_type index = 0; index < items->count; ++index) {
+                    if (entries[index].hash != hash) {
+                        continue;
+                    }
+                    node *candidate = entries[index].ptr;
+                    guards.node.protect(candidate);
+                    publish_protection();
+                    if (slot->load(std::memory_order_acquire) != items) {
+                        // 桶已被替换，节点可能已被回收
+                        restart = true;
+                        break;
+                    }
+                    if (equal_(candidate->value.first, key)) {
+                        utility::forward<Func>(func)(static_cast<const value_type &>(candidate->value));
+                        return true;
+                    }
+                }
+                if (!restart) {
+                    return false;
+                }
+            }
+        }
+
+        /**
+         * @brief 无锁查找
+         * @return 找到时返回映射值的副本
+         */
+        foundation::container::optional<mapped_type> find(const key_type &key) const {
+            foundation::container::optional<mapped_type> result;
+            visit(key, [&result](const value_type &value) { result.emplace(value.second); });
+            return result;
+        }
+
+        bool contains(const key_type &key) const {
+            return visit(key, [](const value_type &) {});
+        }
+
+        /**
+         * @brief 插入或覆盖 key 对应的值，覆盖时以新节点替换旧节点，正在读取旧节点的线程不受影响
+         * @return 是否插入了新键
+         */
+        template <typename Mapped>
+        bool insert_or_assign(const key_type &key, Mapped &&obj) {
+            return assign_impl(key, utility::forward<Mapped>(obj));
+        }
+
+        template <typename Mapped>
+        bool insert_or_assign(key_type &&key, Mapped &&obj) {
+            return assign_impl(utility::move(key), utility::forward<Mapped>(obj));
+        }
+
+        /**
+         * @brief 删除 key
+         * @return 删除的元素数量（0 或 1）
+         */
+        size_type erase(const key_type &key) {
+            const size_type hash = hash_of(key);
+            shard &target = shard_for(hash);
+            foundation::concurrency::lock_guard<foundation::concurrency::mutex> lock(target.lock);
+            table *tab = writable_table(target, hash);
+            auto &slot = tab->slot(hash);
+            bucket *items = slot.load(std::memory_order_relaxed);
+            const size_type index = locate(items, hash, key);
+            if (index == count_of(items)) {
+                return 0;
+            }
+            node *removed = items->entries()[index].ptr;
+            publish(slot, items, index, hash, nullptr);
+            node_domain().retire(removed);
+            target.size.fetch_sub(1, std::memory_order_relaxed);
+            return 1;
+        }
+
+        /**
+         * @brief key 不存在时以 factory() 的结果插入，返回最终的映射值副本
+         *
+         * 已存在时走无锁路径，不获取分片锁；factory 在分片锁内调用，因此同一个键最多只会被构造一次
+         */
+        template <typename Factory>
+        mapped_type compute_if_absent(const key_type &key, Factory &&factory) {
+            if (foundation::container::optional<mapped_type> found = find(key)) {
+                return *found;
+            }
+            const size_type hash = hash_of(key);
+            shard &target = shard_for(hash);
+            foundation::concurrency::lock_guard<foundation::concurrency::mutex> lock(target.lock);
+            grow_if_needed(target);
+            table *tab = writable_table(target, hash);
+            auto &slot = tab->slot(hash);
+            bucket *items = slot.load(std::memory_order_relaxed);
+            const size_type index = locate(items, hash, key);
+            if (index != count_of(items)) {
+                return items->entries()[index].ptr->value.second;
+            }
+            node *fresh = new node(key, utility::forward<Factory>(factory)());
+            try {
+                publish(slot, items, index, hash, fresh);
+            } catch (...) {
+                delete fresh;
+                throw;
+            }
+            target.size.fetch_add(1, std::memory_order_relaxed);
+            return fresh->value.second;
+        }
+
+        /**
+         * @brief 持有分片锁遍历单个分片，遍历期间该分片的写操作被阻塞，其他分片与所有读操作不受影响
+         */
+        template <typename Func>
+        void for_each_in_shard(const size_type shard_index, Func &&func) const {
+            shard &target = shards_[shard_index];
+            foundation::concurrency::lock_guard<foundation::concurrency::mutex> lock(target.lock);
+            // 迁移进行中时，未迁移的元素在旧表，已迁移的元素在 forward 表，两边恰好不重不漏
+            const table *tab = target.current.load(std::memory_order_relaxed);
+            const table *tables[2] = {tab, tab->forward.load(std::memory_order_relaxed)};
+            for (const table *each: tables) {
+                if (!each) {
+                    continue;
+                }
+                for (size_type index = 0; index <= each->mask; ++index) {
+                    const bucket *items = each->buckets[index].load(std::memory_order_relaxed);
+                    if (!items || items == moved_marker()) {
+                        continue;
+                    }
+                    for (size_type pos = 0; pos < items->count; ++pos) {
+                        func(static_cast<const value_type &>(items->entries()[pos].ptr->value));
+                    }
+                }
+            }
+        }
+
+        /**
+         * @brief 逐个分片遍历，每个分片内部是一致的快照，分片之间不是
+         */
+        template <typename Func>
+        void for_each(Func &&func) const {
+            for (size_type index = 0; index < shard_count_; ++index) {
+                for_each_in_shard(index, func);
+            }
+        }
+
+        void clear() {
+            for (size_type index = 0; index < shard_count_; ++index) {
+                shard &target = shards_[index];
+                foundation::concurrency::lock_guard<foundation::concurrency::mutex> lock(target.lock);
+                table *tab = target.current.load(std::memory_order_relaxed);
+                table *tables[2] = {tab, tab->forward.load(std::memory_order_relaxed)};
+                for (table *each: tables) {
+                    if (!each) {
+                        continue;
+                    }
+                    for (size_type pos = 0; pos <= each->mask; ++pos) {
+                        bucket *items = each->buckets[pos].load(std::memory_order_relaxed);
+                        if (!items || items == moved_marker()) {
+                            continue;
+                        }
+                        each->buckets[pos].store(nullptr, std::memory_order_release);
+                        for (size_type item = 0; item < items->count; ++item) {
+                            node_domain().retire(items->entries()[item].ptr);
+                        }
+                        bucket_domain().retire(items);
+                    }
+                }
+                target.size.store(0, std::memory_order_relaxed);
+            }
+        }
+
+        RAINY_NODISCARD size_type size() const noexcept {
+            size_type total = 0;
+            for (size_type index = 0; index < shard_count_; ++index) {
+                total += shards_[index].size.load(std::memory_order_relaxed);
+            }
+            return total;
+        }
+
+        RAINY_NODISCARD bool empty() const noexcept {
+            return size() == 0;
+        }
+
+        RAINY_NODISCARD size_type shard_count() const noexcept {
+            return shard_count_;
+        }
+
+        /**
+         * @brief 分片当前发布的桶数量，迁移完成前不包含 forward 表
+         */
+        RAINY_NODISCARD size_type bucket_count(const size_type shard_index) const noexcept {
+            return shards_[shard_index].current.load(std::memory_order_acquire)->mask + 1;
+        }
+
+        RAINY_NODISCARD size_type shard_index(const key_type &key) const {
+            return shard_index_of(hash_of(key));
+        }
+
+        RAINY_NODISCARD hasher hash_function() const {
+            return hasher_;
+        }
+
+        RAINY_NODISCARD key_equal key_eq() const {
+            return equal_;
+        }
+
+    private:
+        struct node {
+            template <typename KeyArg, typename... Args>
+            explicit node(KeyArg &&key, Args &&...args) :
+                value(std::piecewise_construct, std::forward_as_tuple(utility::forward<KeyArg>(key)),
+                      std::forward_as_tuple(utility::forward<Args>(args)...)) {
+            }
+
+            value_type value;
+        };
+
+        struct entry {
+            size_type hash;
+            node *ptr;
+        };
+
+        /**
+         * @brief 只读的桶数组，头部之后紧跟 count 个 entry，一次分配完成
+         */
+        struct bucket {
+            static bucket *create(const size_type count) {
+                void *memory = ::operator new(sizeof(bucket) + count * sizeof(entry));
+                return ::new (memory) bucket{count};
+            }
+
+            static void operator delete(void *ptr) noexcept {
+                ::operator delete(ptr);
+            }
+
+            entry *entries() noexcept {
+                return reinterpret_cast<entry *>(this + 1);
+            }
+
+            const entry *entries() const noexcept {
+                return reinterpret_cast<const entry *>(this + 1);
+            }
+
+            size_type count;
+        };
+
+        static_assert(alignof(entry) <= alignof(bucket), "entries must be suitably aligned after the bucket header");
+
+        struct table {
+            explicit table(const size_type bucket_count) :
+                mask(bucket_count - 1), buckets(new std::atomic<bucket *>[bucket_count]) {
+                for (size_type index = 0; index < bucket_count; ++index) {
+                    buckets[index].store(nullptr, std::memory_order_relaxed);
+                }
+            }
+
+            table(const table &) = delete;
+            table &operator=(const table &) = delete;
+
+            ~table() {
+                delete[] buckets;
+            }
+
+            std::atomic<bucket *> &slot(const size_type hash) const noexcept {
+                return buckets[hash & mask];
+            }
+
+            size_type mask;
+            std::atomic<bucket *> *buckets;
+            std::atomic<table *> forward{nullptr};
+        };
+
+        /**
+         * @brief 每个分片独占缓存行，避免相邻分片的锁字与计数互相干扰
+         */
+        struct alignas(64) shard {
+            foundation::concurrency::mutex lock;
+            std::atomic<table *> current{nullptr};
+            std::atomic<size_type> size{0};
+            size_type migrate_index{0};
+        };
+
+        static constexpr int size_bits = static_cast<int>(sizeof(size_type) * 8);
+
+        /**
+         * @brief hazard pointer 需要在发布保护后重新校验来源；epoch 守卫覆盖整个临界区，无需校验
+         */
+        static constexpr bool requires_validation =
+            !type_traits::type_relations::is_same_v<guard_type, foundation::memory::epoch_guard>;
+
+        /**
+         * @brief 读操作所需的保护：hazard pointer 为桶表、桶、节点各占一个槽位，epoch 守卫只需进入一次临界区
+         */
+        struct hazard_read_guards {
+            guard_type table;
+            guard_type bucket;
+            guard_type node;
+        };
+
+        struct pinned_read_guards {
+            guard_type pin;
+            guard_type &table = pin;
+            guard_type &bucket = pin;
+            guard_type &node = pin;
+        };
+
+        using read_guards = type_traits::other_trans::conditional_t<requires_validation, hazard_read_guards, pinned_read_guards>;
+
+        static auto &node_domain() {
+            return Reclamation::template domain_type<node>::global();
+        }
+
+        static auto &bucket_domain() {
+            return Reclamation::template domain_type<bucket>::global();
+        }
+
+        static auto &table_domain() {
+            return Reclamation::template domain_type<table>::global();
+        }
+
+        static bucket *moved_marker() noexcept {
+            return reinterpret_cast<bucket *>(static_cast<std::uintptr_t>(1));
+        }
+
+        static size_type count_of(const bucket *items) noexcept {
+            return items ? items->count : 0;
+        }
+
+        static void publish_protection() noexcept {
+            if constexpr (requires_validation) {
+                // 保护的写入必须先于对来源的重新读取对其他线程可见
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+            }
+        }
+
+        template <typename Pointer>
+        static Pointer *protect_load(guard_type &guard, const std::atomic<Pointer *> &source) noexcept {
+            Pointer *ptr = source.load(std::memory_order_acquire);
+            for (;;) {
+                if (!ptr) {
+                    return ptr;
+                }
+                guard.protect(ptr);
+                if constexpr (!requires_validation) {
+                    return ptr;
+                } else {
+                    publish_protection();
+                    Pointer *again = source.load(std::memory_order_acquire);
+                    if (again == ptr) {
+                        return ptr;
+                    }
+                    ptr = again;
+                }
+            }
+        }
+
+        static void destroy_table(table *tab) noexcept {
+            for (size_type index = 0; index <= tab->mask; ++index) {
+                bucket *items = tab->buckets[index].load(std::memory_order_relaxed);
+                if (!items || items == moved_marker()) {
+                    continue;
+                }
+                for (size_type pos = 0; pos < items->count; ++pos) {
+                    delete items->entries()[pos].ptr;
+                }
+                delete items;
+            }
+            delete tab;
+        }
+
+        size_type hash_of(const key_type &key) const {
+            return static_cast<size_type>(hasher_(key));
+        }
+
+        size_type shard_index_of(const size_type hash) const noexcept {
+            return shard_shift_ == size_bits ? 0 : hash >> shard_shift_;
+        }
+
+        shard &shard_for(const size_type hash) const noexcept {
+            return shards_[shard_index_of(hash)];
+        }
+
+        /**
+         * @brief 持锁查找 key 在桶中的下标，未找到时返回桶的元素数量
+         */
+        size_type locate(const bucket *items, const size_type hash, const key_type &key) const {
+            const size_type count = count_of(items);
+            for (size_type index = 0; index < count; ++index) {
+                const entry &each = items->entries()[index];
+                if (each.hash == hash && equal_(each.ptr->value.first, key)) {
+                    return index;
+                }
+            }
+            return count;
+        }
+
+        /**
+         * @brief 以新数组替换 slot 中的桶：index 等于元素数量表示追加，replacement 为空表示删除
+         */
+        static void publish(std::atomic<bucket *> &slot, bucket *items, const size_type index, const size_type hash,
+                            node *replacement) {
+            const size_type count = count_of(items);
+            const size_type new_count = !replacement ? count - 1 : (index == count ? count + 1 : count);
+            bucket *fresh = nullptr;
+            if (new_count != 0) {
+                fresh = bucket::create(new_count);
+                entry *out = fresh->entries();
+                for (size_type pos = 0; pos < count; ++pos) {
+                    if (pos == index) {
+                        if (replacement) {
+                            *out++ = entry{hash, replacement};
+                        }
+                    } else {
+                        *out++ = items->entries()[pos];
+                    }
+                }
+                if (index == count) {
+                    *out = entry{hash, replacement};
+                }
+            }
+            slot.store(fresh, std::memory_order_release);
+            if (items) {
+                bucket_domain().retire(items);
+            }
+        }
+
+        template <typename KeyArg, typename Mapped>
+        bool assign_impl(KeyArg &&key, Mapped &&obj) {
+            const size_type hash = hash_of(key);
+            shard &target = shard_for(hash);
+            foundation::concurrency::lock_guard<foundation::concurrency::mutex> lock(target.lock);
+            grow_if_needed(target);
+            table *tab = writable_table(target, hash);
+            auto &slot = tab->slot(hash);
+            bucket *items = slot.load(std::memory_order_relaxed);
+            const size_type index = locate(items, hash, key);
+            const bool inserted = index == count_of(items);
+            node *replaced = inserted ? nullptr : items->entries()[index].ptr;
+            node *fresh = new node(utility::forward<KeyArg>(key), utility::forward<Mapped>(obj));
+            try {
+                publish(slot, items, index, hash, fresh);
+            } catch (...) {
+                delete fresh;
+                throw;
+            }
+            if (inserted) {
+                target.size.fetch_add(1, std::memory_order_relaxed);
+            } else {
+                node_domain().retire(replaced);
+            }
+            return inserted;
+        }
+
+        /**
+         * @brief 持锁调用：分片平均每桶超过一个元素且当前没有迁移时，挂上两倍大小的 forward 表
+         */
+        void grow_if_needed(shard &target) {
+            table *tab = target.current.load(std::memory_order_relaxed);
+            if (tab->forward.load(std::memory_order_relaxed) ||
+                target.size.load(std::memory_order_relaxed) < tab->mask + 1) {
+                return;
+            }
+            target.migrate_index = 0;
+            tab->forward.store(new table((tab->mask + 1) * 2), std::memory_order_release);
+        }
+
+        /**
+         * @brief 持锁调用：返回写操作应使用的桶表，迁移进行中时顺带推进迁移
+         */
+        table *writable_table(shard &target, const size_type hash) {
+            table *tab = target.current.load(std::memory_order_relaxed);
+            table *next = tab->forward.load(std::memory_order_relaxed);
+            if (!next) {
+                return tab;
+            }
+            // 先迁移目标键所在的桶，保证随后在 forward 表中看到的桶是完整的
+            migrate_bucket(tab, next, hash & tab->mask);
+            for (size_type step = 0; step < migration_step && target.migrate_index <= tab->mask; ++step) {
+                migrate_bucket(tab, next, target.migrate_index++);
+            }
+            if (target.migrate_index > tab->mask) {
+                target.current.store(next, std::memory_order_release);
+                target.migrate_index = 0;
+                table_domain().retire(tab);
+            }
+            return next;
+        }
+
+        /**
+         * @brief 旧表第 index 个桶拆分到新表的 index 与 index + 旧桶数 两个位置，节点本身不复制
+         */
+        static void migrate_bucket(table *from, table *to, const size_type index) {
+            bucket *items = from->buckets[index].load(std::memory_order_relaxed);
+            if (items == moved_marker()) {
+                return;
+            }
+            if (items) {
+                const size_type split_bit = from->mask + 1;
+                size_type high_count = 0;
+                for (size_type pos = 0; pos < items->count; ++pos) {
+                    high_count += (items->entries()[pos].hash & split_bit) != 0;
+                }
+                const size_type low_count = items->count - high_count;
+                bucket *low = low_count ? bucket::create(low_count) : nullptr;
+                bucket *high = nullptr;
+                try {
+                    high = high_count ? bucket::create(high_count) : nullptr;
+                } catch (...) {
+                    delete low;
+                    throw;
+                }
+                entry *low_out = low ? low->entries() : nullptr;
+                entry *high_out = high ? high->entries() : nullptr;
+                for (size_type pos = 0; pos < items->count; ++pos) {
+                    const entry &each = items->entries()[pos];
+                    if (each.hash & split_bit) {
+                        *high_out++ = each;
+                    } else {
+                        *low_out++ = each;
+                    }
+                }
+                to->buckets[index].store(low, std::memory_order_release);
+                to->buckets[index + split_bit].store(high, std::memory_order_release);
+            }
+            from->buckets[index].store(moved_marker(), std::memory_order_release);
+            if (items) {
+                bucket_domain().retire(items);
+            }
+        }
+
+        shard *shards_{nullptr};
+        size_type shard_count_;
+        int shard_shift_;
+        hasher hasher_;
+        key_equal equal_;
+    };
+}
+
+#endif
@@ -18,6 +18,7 @@
 #include <rainy/core/core.hpp>
 #include <rainy/foundation/functional/functor.hpp>
 #include <rainy/foundation/memory/allocator.hpp>
+#include <rainy/foundation/memory/epoch.hpp>
 #include <rainy/foundation/memory/hazard_pointer.hpp>
 #include <rainy/foundation/concurrency/atomic.hpp>
 
@@ -33,12 +34,18 @@ namespace rainy::collections::concurrency {
      * @attention 在插入或弹出时，可能产生乱序，仅保证操作是原子性的（x86 only）
      * @tparam Ty 值类型
      * @tparam Allocator 需要该分配器能安全分配内存的，不应出现如下情况：内存复用、使用非线程安全的池化分配器
+     * @tparam Reclamation 被移除节点的回收方案，可选 hazard_pointer_reclamation（默认）或 epoch_reclamation（读多写少时开销更低）
      */
-    template <typename Ty, typename Allocator = foundation::memory::allocator<Ty>>
+    template <typename Ty, typename Allocator = foundation::memory::allocator<Ty>,
+              typename Reclamation = foundation::memory::hazard_pointer_reclamation>
     class forward_list {
     public:
         struct node;
 
+        using reclamation_type = Reclamation;
+        using guard_type = typename Reclamation::guard_type;
+        using domain_type = typename Reclamation::template domain_type<node>;
+
         using node_allocator_type = foundation::memory::allocator<node>;
 
         struct node_deleter {
@@ -339,7 +346,7 @@ namespace rainy::collections::concurrency {
         }
 
         void pop_front() noexcept {
-            auto hp = foundation::memory::make_hazard_pointer();
+            guard_type hp;
             node *first;
 
             do {
@@ -350,7 +357,7 @@ namespace rainy::collections::concurrency {
                                                           foundation::concurrency::memory_order_release, foundation::concurrency::memory_order_acquire));
             hp.reset_protection();
             // 使用自定义删除器
-            foundation::memory::hazard_pointer_domain<node>::global().retire(first);
+            domain_type::global().retire(first);
             size_.fetch_sub(1, foundation::concurrency::memory_order_relaxed);
         }
 
@@ -359,7 +366,7 @@ namespace rainy::collections::concurrency {
             node *new_node = allocate_node(utility::forward<Args>(args)...);
             node *pos = const_cast<node *>(position.node_ptr);
 
-            auto hp = foundation::memory::make_hazard_pointer();
+            guard_type hp;
             node *next = nullptr;
             do {
                 next = hp.protect(pos->next.load());
@@ -400,7 +407,7 @@ namespace rainy::collections::concurrency {
 
         iterator erase_after(const_iterator position) noexcept {
             node *pos = const_cast<node *>(position.node_ptr);
-            auto hp = foundation::memory::make_hazard_pointer();
+            guard_type hp;
             node *to_erase;
 
             do {
@@ -411,7 +418,7 @@ namespace rainy::collections::concurrency {
                                                       foundation::concurrency::memory_order_release, foundation::concurrency::memory_order_acquire));
 
             hp.reset_protection();
-            foundation::memory::hazard_pointer_domain<node>::global().retire(to_erase);
+            domain_type::global().retire(to_erase);
             size_.fetch_sub(1, foundation::concurrency::memory_order_relaxed);
             return iterator(pos->next.load(foundation::concurrency::memory_order_acquire));
         }
@@ -426,7 +433,7 @@ namespace rainy::collections::concurrency {
             while (to_erase && to_erase != l) {
                 node *next = to_erase->next.load(foundation::concurrency::memory_order_acquire);
                 // 使用自定义删除器
-                foundation::memory::hazard_pointer_domain<node>::global().retire(to_erase);
+                domain_type::global().retire(to_erase);
                 to_erase = next;
                 ++count;
             }
@@ -471,11 +478,11 @@ namespace rainy::collections::concurrency {
             while (curr) {
                 node *next = curr->next.load(foundation::concurrency::memory_order_acquire);
                 // 使用自定义删除器
-                foundation::memory::hazard_pointer_domain<node>::global().retire(curr);
+                domain_type::global().retire(curr);
                 curr = next;
             }
             size_.store(0, foundation::concurrency::memory_order_relaxed);
-            foundation::memory::hazard_pointer_domain<node>::global().reclaim();
+            domain_type::global().reclaim();
         }
 
         void splice_after(const_iterator position, forward_list &x) {
@@ -700,13 +707,13 @@ namespace rainy::collections::concurrency {
         foundation::concurrency::atomic<size_t> size_;
     };
 
-    template <typename Ty, typename Allocator>
-    void swap(forward_list<Ty, Allocator> &left, forward_list<Ty, Allocator> &right) noexcept {
+    template <typename Ty, typename Allocator, typename Reclamation>
+    void swap(forward_list<Ty, Allocator, Reclamation> &left, forward_list<Ty, Allocator, Reclamation> &right) noexcept {
         left.swap(right);
     }
 
-    template <typename Ty, typename Allocator>
-    bool operator==(const forward_list<Ty, Allocator> &x, const forward_list<Ty, Allocator> &y) {
+    template <typename Ty, typename Allocator, typename Reclamation>
+    bool operator==(const forward_list<Ty, Allocator, Reclamation> &x, const forward_list<Ty, Allocator, Reclamation> &y) {
         auto ix = x.begin();
         auto iy = y.begin();
         while (ix != x.end() && iy != y.end()) {
@@ -719,28 +726,28 @@ namespace rainy::collections::concurrency {
         return ix == x.end() && iy == y.end();
     }
 
-    template <typename Ty, typename Allocator>
-    bool operator!=(const forward_list<Ty, Allocator> &x, const forward_list<Ty, Allocator> &y) {
+    template <typename Ty, typename Allocator, typename Reclamation>
+    bool operator!=(const forward_list<Ty, Allocator, Reclamation> &x, const forward_list<Ty, Allocator, Reclamation> &y) {
         return !(x == y);
     }
 
-    template <typename Ty, typename Allocator>
-    bool operator<(const forward_list<Ty, Allocator> &x, const forward_list<Ty, Allocator> &y) {
+    template <typename Ty, typename Allocator, typename Reclamation>
+    bool operator<(const forward_list<Ty, Allocator, Reclamation> &x, const forward_list<Ty, Allocator, Reclamation> &y) {
         return std::lexicographical_compare(x.begin(), x.end(), y.begin(), y.end());
     }
 
-    template <typename Ty, typename Allocator>
-    bool operator>(const forward_list<Ty, Allocator> &x, const forward_list<Ty, Allocator> &y) {
+    template <typename Ty, typename Allocator, typename Reclamation>
+    bool operator>(const forward_list<Ty, Allocator, Reclamation> &x, const forward_list<Ty, Allocator, Reclamation> &y) {
         return y < x;
     }
 
-    template <typename Ty, typename Allocator>
-    bool operator<=(const forward_list<Ty, Allocator> &x, const forward_list<Ty, Allocator> &y) {
+    template <typename Ty, typename Allocator, typename Reclamation>
+    bool operator<=(const forward_list<Ty, Allocator, Reclamation> &x, const forward_list<Ty, Allocator, Reclamation> &y) {
         return !(y < x);
     }
 
-    template <typename Ty, typename Allocator>
-    bool operator>=(const forward_list<Ty, Allocator> &x, const forward_list<Ty, Allocator> &y) {
+    template <typename Ty, typename Allocator, typename Reclamation>
+    bool operator>=(const forward_list<Ty, Allocator, Reclamation> &x, const forward_list<Ty, Allocator, Reclamation> &y) {
         return !(x < y);
     }
 
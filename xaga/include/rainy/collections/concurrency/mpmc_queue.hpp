@@ -0,0 +1,377 @@
+/*
+ * Copyright 2026 rainy-juzixiao
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef RAINY_COLLECTIONS_CONCURRENCY_MPMC_QUEUE_HPP
+#define RAINY_COLLECTIONS_CONCURRENCY_MPMC_QUEUE_HPP
+#include <atomic>
+#include <cstddef>
+#include <iterator>
+#include <rainy/collections/implements/ring_buffer.hpp>
+#include <rainy/core/core.hpp>
+
+namespace rainy::collections::concurrency {
+    /**
+     * @brief 多生产者多消费者的有界环形队列（Vyukov 序号槽设计）
+     *
+     * 每个槽位携带一个序号：序号等于入队位置时可写，等于入队位置加一时可读，出队后序号前进一圈。
+     * 生产者与消费者只在各自的位置计数上竞争一次 CAS，槽位的交接通过序号完成。
+     * 批量操作先扫描连续就绪的槽位，再以一次 CAS 一并占用，最后只唤醒一次等待方。
+     *
+     * @attention 占用槽位后不能失败，因此要求 Ty 的移动构造不抛出异常；
+     *            可能抛出的构造会先在队列外完成，再移动进槽位
+     * @tparam Ty 元素类型
+     * @tparam Capacity 为 0 时容量在构造时指定，否则为编译期容量，须为 2 的幂
+     */
+    template <typename Ty, std::size_t Capacity = 0>
+    class mpmc_queue {
+    public:
+        static_assert(type_traits::type_properties::is_nothrow_move_constructible_v<Ty>,
+                      "mpmc_queue requires a nothrow move constructible value type");
+
+        using value_type = Ty;
+        using size_type = std::size_t;
+        using reference = value_type &;
+        using const_reference = const value_type &;
+
+        template <std::size_t Cap = Capacity, type_traits::other_trans::enable_if_t<Cap != 0, int> = 0>
+        mpmc_queue() {
+            init_sequences();
+        }
+
+        /**
+         * @param capacity 期望容量，向上取整到 2 的幂
+         */
+        template <std::size_t Cap = Capacity, type_traits::other_trans::enable_if_t<Cap == 0, int> = 0>
+        explicit mpmc_queue(const size_type capacity) : cells_(capacity) {
+            init_sequences();
+        }
+
+        mpmc_queue(const mpmc_queue &) = delete;
+        mpmc_queue &operator=(const mpmc_queue &) = delete;
+
+        ~mpmc_queue() {
+            const size_type tail = enqueue_pos_.load(std::memory_order_relaxed);
+            for (size_type head = dequeue_pos_.load(std::memory_order_relaxed); head != tail; ++head) {
+                cells_[head].slot.value()->~Ty();
+            }
+        }
+
+        /**
+         * @brief 构造可能抛出异常时，参数先用于构造临时对象，即使随后因队列已满而失败，参数也已被消耗
+         */
+        template <typename... Args>
+        bool try_emplace(Args &&...args) {
+            if constexpr (type_traits::type_properties::is_nothrow_constructible_v<Ty, Args &&...>) {
+                size_type pos{};
+                cell *target = claim_enqueue(pos);
+                if (!target) {
+                    return false;
+                }
+                ::new (static_cast<void *>(target->slot.value())) Ty(utility::forward<Args>(args)...);
+                target->sequence.store(pos + 1, std::memory_order_release);
+                not_empty_.notify();
+                return true;
+            } else {
+                if (looks_full()) {
+                    return false;
+                }
+                Ty temp(utility::forward<Args>(args)...);
+                return try_emplace(utility::move(temp));
+            }
+        }
+
+        bool try_push(const value_type &value) {
+            return try_emplace(value);
+        }
+
+        bool try_push(value_type &&value) {
+            return try_emplace(utility::move(value));
+        }
+
+        bool try_pop(value_type &out) {
+            size_type pos{};
+            cell *source = claim_dequeue(pos);
+            if (!source) {
+                return false;
+            }
+            // 赋值抛出异常时同样要归还槽位，否则生产者会在该槽位上永久停滞
+            try {
+                const cell_release release{*source, pos + cells_.capacity()};
+                out = utility::move(*source->slot.value());
+            } catch (...) {
+                not_full_.notify();
+                throw;
+            }
+            not_full_.notify();
+            return true;
+        }
+
+        /**
+         * @brief 从 first 起最多推入 count 个元素，以一次 CAS 占用全部槽位
+         * @return 实际推入的数量
+         */
+        template <typename InputIter>
+        size_type push_n(InputIter first, const size_type count) {
+            if constexpr (type_traits::type_properties::is_nothrow_constructible_v<Ty, decltype(*first)>) {
+                if (count == 0) {
+                    return 0;
+                }
+                size_type pos = enqueue_pos_.load(std::memory_order_relaxed);
+                size_type ready = 0;
+                for (;;) {
+                    ready = 0;
+                    std::ptrdiff_t diff = 0;
+                    while (ready < count) {
+                        const size_type sequence = cells_[pos + ready].sequence.load(std::memory_order_acquire);
+                        diff = static_cast<std::ptrdiff_t>(sequence - (pos + ready));
+                        if (diff != 0) {
+                            break;
+                        }
+                        ++ready;
+                    }
+                    if (ready != 0) {
+                        if (enqueue_pos_.compare_exchange_weak(pos, pos + ready, std::memory_order_relaxed)) {
+                            break;
+                        }
+                    } else if (diff < 0) {
+                        return 0;
+                    } else {
+                        pos = enqueue_pos_.load(std::memory_order_relaxed);
+                    }
+                }
+                for (size_type index = 0; index < ready; ++index, ++first) {
+                    cell &target = cells_[pos + index];
+                    ::new (static_cast<void *>(target.slot.value())) Ty(*first);
+                    target.sequence.store(pos + index + 1, std::memory_order_release);
+                }
+                not_empty_.notify();
+                return ready;
+            } else {
+                size_type done = 0;
+                for (; done < count; ++done, ++first) {
+                    if (!try_emplace(*first)) {
+                        break;
+                    }
+                }
+                return done;
+            }
+        }
+
+        /**
+         * @brief 最多弹出 max_count 个元素写入 out，以一次 CAS 占用全部槽位
+         * @attention 写入 out 抛出异常时，本批剩余的元素会被丢弃
+         * @return 实际弹出的数量
+         */
+        template <typename OutputIter>
+        size_type pop_n(OutputIter out, const size_type max_count) {
+            if (max_count == 0) {
+                return 0;
+            }
+            size_type pos = dequeue_pos_.load(std::memory_order_relaxed);
+            size_type ready = 0;
+            for (;;) {
+                ready = 0;
+                std::ptrdiff_t diff = 0;
+                while (ready < max_count) {
+                    const size_type sequence = cells_[pos + ready].sequence.load(std::memory_order_acquire);
+                    diff = static_cast<std::ptrdiff_t>(sequence - (pos + ready + 1));
+                    if (diff != 0) {
+                        break;
+                    }
+                    ++ready;
+                }
+                if (ready != 0) {
+                    if (dequeue_pos_.compare_exchange_weak(pos, pos + ready, std::memory_order_relaxed)) {
+                        break;
+                    }
+                } else if (diff < 0) {
+                    return 0;
+                } else {
+                    pos = dequeue_pos_.load(std::memory_order_relaxed);
+                }
+            }
+            const size_type round = cells_.capacity();
+            size_type index = 0;
+            try {
+                for (; index < ready; ++index, ++out) {
+                    const cell_release release{cells_[pos + index], pos + index + round};
+                    *out = utility::move(*cells_[pos + index].slot.value());
+                }
+            } catch (...) {
+                for (++index; index < ready; ++index) {
+                    const cell_release release{cells_[pos + index], pos + index + round};
+                }
+                not_full_.notify();
+                throw;
+            }
+            not_full_.notify();
+            return ready;
+        }
+
+        /**
+         * @brief 队列满时阻塞直到推入成功
+         */
+        void push(const value_type &value) {
+            emplace(value);
+        }
+
+        void push(value_type &&value) {
+            emplace(utility::move(value));
+        }
+
+        template <typename... Args>
+        void emplace(Args &&...args) {
+            if constexpr (type_traits::type_properties::is_nothrow_constructible_v<Ty, Args &&...>) {
+                not_full_.wait_until([&] { return try_emplace(utility::forward<Args>(args)...); });
+            } else {
+                // 只构造一次临时对象，重试时只做不抛出的移动
+                Ty temp(utility::forward<Args>(args)...);
+                not_full_.wait_until([&] { return try_emplace(utility::move(temp)); });
+            }
+        }
+
+        /**
+         * @brief 队列空时阻塞直到弹出成功
+         */
+        void pop(value_type &out) {
+            not_empty_.wait_until([&] { return try_pop(out); });
+        }
+
+        /**
+         * @brief 阻塞直到全部 count 个元素推入
+         */
+        template <typename InputIter>
+        void push_n_wait(InputIter first, size_type count) {
+            while (count != 0) {
+                size_type pushed = 0;
+                not_full_.wait_until([&] { return (pushed = push_n(first, count)) != 0; });
+                std::advance(first, static_cast<std::ptrdiff_t>(pushed));
+                count -= pushed;
+            }
+        }
+
+        /**
+         * @brief 阻塞直到至少弹出一个元素，最多弹出 max_count 个
+         * @return 实际弹出的数量
+         */
+        template <typename OutputIter>
+        size_type pop_n_wait(OutputIter out, const size_type max_count) {
+            size_type popped = 0;
+            if (max_count != 0) {
+                not_empty_.wait_until([&] { return (popped = pop_n(out, max_count)) != 0; });
+            }
+            return popped;
+        }
+
+        /**
+         * @brief 近似的元素数量，包含已占用但尚未发布的槽位
+         */
+        RAINY_NODISCARD size_type size_approx() const noexcept {
+            const size_type head = dequeue_pos_.load(std::memory_order_acquire);
+            const size_type tail = enqueue_pos_.load(std::memory_order_acquire);
+            const auto diff = static_cast<std::ptrdiff_t>(tail - head);
+            return diff > 0 ? static_cast<size_type>(diff) : 0;
+        }
+
+        RAINY_NODISCARD bool empty() const noexcept {
+            return size_approx() == 0;
+        }
+
+        RAINY_NODISCARD size_type capacity() const noexcept {
+            return cells_.capacity();
+        }
+
+    private:
+        struct cell {
+            std::atomic<size_type> sequence{0};
+            implements::ring_slot<Ty> slot;
+        };
+
+        /**
+         * @brief 析构槽中的元素并把序号推进到下一圈
+         */
+        struct cell_release {
+            cell_release(cell &target, const size_type next) noexcept : target(target), next(next) {
+            }
+
+            cell_release(const cell_release &) = delete;
+            cell_release &operator=(const cell_release &) = delete;
+
+            ~cell_release() {
+                target.slot.value()->~Ty();
+                target.sequence.store(next, std::memory_order_release);
+            }
+
+            cell &target;
+            size_type next;
+        };
+
+        void init_sequences() noexcept {
+            for (size_type index = 0; index < cells_.capacity(); ++index) {
+                cells_[index].sequence.store(index, std::memory_order_relaxed);
+            }
+        }
+
+        bool looks_full() noexcept {
+            const size_type pos = enqueue_pos_.load(std::memory_order_relaxed);
+            const size_type sequence = cells_[pos].sequence.load(std::memory_order_acquire);
+            return static_cast<std::ptrdiff_t>(sequence - pos) < 0;
+        }
+
+        cell *claim_enqueue(size_type &pos) noexcept {
+            pos = enqueue_pos_.load(std::memory_order_relaxed);
+            for (;;) {
+                cell &target = cells_[pos];
+                const size_type sequence = target.sequence.load(std::memory_order_acquire);
+                const auto diff = static_cast<std::ptrdiff_t>(sequence - pos);
+                if (diff == 0) {
+                    if (enqueue_pos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                        return &target;
+                    }
+                } else if (diff < 0) {
+                    return nullptr;
+                } else {
+                    pos = enqueue_pos_.load(std::memory_order_relaxed);
+                }
+            }
+        }
+
+        cell *claim_dequeue(size_type &pos) noexcept {
+            pos = dequeue_pos_.load(std::memory_order_relaxed);
+            for (;;) {
+                cell &source = cells_[pos];
+                const size_type sequence = source.sequence.load(std::memory_order_acquire);
+                const auto diff = static_cast<std::ptrdiff_t>(sequence - (pos + 1));
+                if (diff == 0) {
+                    if (dequeue_pos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                        return &source;
+                    }
+                } else if (diff < 0) {
+                    return nullptr;
+                } else {
+                    pos = dequeue_pos_.load(std::memory_order_relaxed);
+                }
+            }
+        }
+
+        alignas(core::hardware_destructive_interference_size) std::atomic<size_type> enqueue_pos_{0};
+        alignas(core::hardware_destructive_interference_size) std::atomic<size_type> dequeue_pos_{0};
+        alignas(core::hardware_destructive_interference_size) implements::ring_waiter not_empty_;
+        alignas(core::hardware_destructive_interference_size) implements::ring_waiter not_full_;
+        alignas(core::hardware_destructive_interference_size) implements::ring_cells<cell, Capacity> cells_;
+    };
+}
+
+#endif
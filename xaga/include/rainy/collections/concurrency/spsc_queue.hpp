@@ -0,0 +1,253 @@
+/*
+ * Copyright 2026 rainy-juzixiao
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef RAINY_COLLECTIONS_CONCURRENCY_SPSC_QUEUE_HPP
+#define RAINY_COLLECTIONS_CONCURRENCY_SPSC_QUEUE_HPP
+#include <atomic>
+#include <iterator>
+#include <rainy/collections/implements/ring_buffer.hpp>
+#include <rainy/core/core.hpp>
+
+namespace rainy::collections::concurrency {
+    /**
+     * @brief 单生产者单消费者的有界环形队列
+     *
+     * 生产者与消费者各自独占一条缓存行，并缓存对方的下标，只有在看起来已满或已空时才读取对方的缓存行。
+     * 批量操作只发布一次下标，适合在流水线相邻阶段之间成批传递数据。
+     *
+     * @attention 任意时刻只能有一个线程调用生产方法（push 系列），一个线程调用消费方法（pop 系列）
+     * @tparam Ty 元素类型
+     * @tparam Capacity 为 0 时容量在构造时指定，否则为编译期容量，须为 2 的幂
+     */
+    template <typename Ty, std::size_t Capacity = 0>
+    class spsc_queue {
+    public:
+        using value_type = Ty;
+        using size_type = std::size_t;
+        using reference = value_type &;
+        using const_reference = const value_type &;
+
+        template <std::size_t Cap = Capacity, type_traits::other_trans::enable_if_t<Cap != 0, int> = 0>
+        spsc_queue() {
+        }
+
+        /**
+         * @param capacity 期望容量，向上取整到 2 的幂
+         */
+        template <std::size_t Cap = Capacity, type_traits::other_trans::enable_if_t<Cap == 0, int> = 0>
+        explicit spsc_queue(const size_type capacity) : cells_(capacity) {
+        }
+
+        spsc_queue(const spsc_queue &) = delete;
+        spsc_queue &operator=(const spsc_queue &) = delete;
+
+        ~spsc_queue() {
+            const size_type tail = tail_.load(std::memory_order_relaxed);
+            for (size_type head = head_.load(std::memory_order_relaxed); head != tail; ++head) {
+                cells_[head].value()->~Ty();
+            }
+        }
+
+        template <typename... Args>
+        bool try_emplace(Args &&...args) {
+            const size_type tail = tail_.load(std::memory_order_relaxed);
+            if (tail - cached_head_ == cells_.capacity()) {
+                cached_head_ = head_.load(std::memory_order_acquire);
+                if (tail - cached_head_ == cells_.capacity()) {
+                    return false;
+                }
+            }
+            ::new (static_cast<void *>(cells_[tail].value())) Ty(utility::forward<Args>(args)...);
+            tail_.store(tail + 1, std::memory_order_release);
+            not_empty_.notify();
+            return true;
+        }
+
+        bool try_push(const value_type &value) {
+            return try_emplace(value);
+        }
+
+        bool try_push(value_type &&value) {
+            return try_emplace(utility::move(value));
+        }
+
+        bool try_pop(value_type &out) {
+            const size_type head = head_.load(std::memory_order_relaxed);
+            if (head == cached_tail_) {
+                cached_tail_ = tail_.load(std::memory_order_acquire);
+                if (head == cached_tail_) {
+                    return false;
+                }
+            }
+            Ty *slot = cells_[head].value();
+            out = utility::move(*slot);
+            slot->~Ty();
+            head_.store(head + 1, std::memory_order_release);
+            not_full_.notify();
+            return true;
+        }
+
+        /**
+         * @brief 从 first 起最多推入 count 个元素，只发布一次下标
+         * @return 实际推入的数量
+         */
+        template <typename InputIter>
+        size_type push_n(InputIter first, const size_type count) {
+            const size_type tail = tail_.load(std::memory_order_relaxed);
+            size_type space = cells_.capacity() - (tail - cached_head_);
+            if (space < count) {
+                cached_head_ = head_.load(std::memory_order_acquire);
+                space = cells_.capacity() - (tail - cached_head_);
+            }
+            const size_type amount = count < space ? count : space;
+            size_type done = 0;
+            try {
+                for (; done < amount; ++done, ++first) {
+                    ::new (static_cast<void *>(cells_[tail + done].value())) Ty(*first);
+                }
+            } catch (...) {
+                // 已构造的元素照常发布
+                publish_tail(tail, done);
+                throw;
+            }
+            publish_tail(tail, done);
+            return done;
+        }
+
+        /**
+         * @brief 最多弹出 max_count 个元素写入 out，只发布一次下标
+         * @return 实际弹出的数量
+         */
+        template <typename OutputIter>
+        size_type pop_n(OutputIter out, const size_type max_count) {
+            const size_type head = head_.load(std::memory_order_relaxed);
+            size_type available = cached_tail_ - head;
+            if (available < max_count) {
+                cached_tail_ = tail_.load(std::memory_order_acquire);
+                available = cached_tail_ - head;
+            }
+            const size_type amount = max_count < available ? max_count : available;
+            size_type done = 0;
+            try {
+                for (; done < amount; ++done, ++out) {
+                    Ty *slot = cells_[head + done].value();
+                    *out = utility::move(*slot);
+                    slot->~Ty();
+                }
+            } catch (...) {
+                // 赋值失败的元素同样丢弃，保持下标与存储一致
+                cells_[head + done].value()->~Ty();
+                publish_head(head, done + 1);
+                throw;
+            }
+            publish_head(head, done);
+            return done;
+        }
+
+        /**
+         * @brief 队列满时阻塞直到推入成功
+         */
+        void push(const value_type &value) {
+            not_full_.wait_until([&] { return try_push(value); });
+        }
+
+        void push(value_type &&value) {
+            not_full_.wait_until([&] { return try_push(utility::move(value)); });
+        }
+
+        template <typename... Args>
+        void emplace(Args &&...args) {
+            // try_emplace 只在确有空位时才使用参数，失败重试不会重复消耗参数
+            not_full_.wait_until([&] { return try_emplace(utility::forward<Args>(args)...); });
+        }
+
+        /**
+         * @brief 队列空时阻塞直到弹出成功
+         */
+        void pop(value_type &out) {
+            not_empty_.wait_until([&] { return try_pop(out); });
+        }
+
+        /**
+         * @brief 阻塞直到全部 count 个元素推入
+         */
+        template <typename InputIter>
+        void push_n_wait(InputIter first, size_type count) {
+            while (count != 0) {
+                size_type pushed = 0;
+                not_full_.wait_until([&] { return (pushed = push_n(first, count)) != 0; });
+                std::advance(first, static_cast<std::ptrdiff_t>(pushed));
+                count -= pushed;
+            }
+        }
+
+        /**
+         * @brief 阻塞直到至少弹出一个元素，最多弹出 max_count 个
+         * @return 实际弹出的数量
+         */
+        template <typename OutputIter>
+        size_type pop_n_wait(OutputIter out, const size_type max_count) {
+            size_type popped = 0;
+            if (max_count != 0) {
+                not_empty_.wait_until([&] { return (popped = pop_n(out, max_count)) != 0; });
+            }
+            return popped;
+        }
+
+        /**
+         * @brief 近似的元素数量，仅在没有并发操作时精确
+         */
+        RAINY_NODISCARD size_type size_approx() const noexcept {
+            const size_type head = head_.load(std::memory_order_acquire);
+            const size_type tail = tail_.load(std::memory_order_acquire);
+            return tail - head;
+        }
+
+        RAINY_NODISCARD bool empty() const noexcept {
+            return size_approx() == 0;
+        }
+
+        RAINY_NODISCARD size_type capacity() const noexcept {
+            return cells_.capacity();
+        }
+
+    private:
+        void publish_tail(const size_type tail, const size_type count) noexcept {
+            if (count != 0) {
+                tail_.store(tail + count, std::memory_order_release);
+                not_empty_.notify();
+            }
+        }
+
+        void publish_head(const size_type head, const size_type count) noexcept {
+            if (count != 0) {
+                head_.store(head + count, std::memory_order_release);
+                not_full_.notify();
+            }
+        }
+
+        // 生产者独占
+        alignas(core::hardware_destructive_interference_size) std::atomic<size_type> tail_{0};
+        size_type cached_head_{0};
+        // 消费者独占
+        alignas(core::hardware_destructive_interference_size) std::atomic<size_type> head_{0};
+        size_type cached_tail_{0};
+        alignas(core::hardware_destructive_interference_size) implements::ring_waiter not_empty_;
+        alignas(core::hardware_destructive_interference_size) implements::ring_waiter not_full_;
+        alignas(core::hardware_destructive_interference_size) implements::ring_cells<implements::ring_slot<Ty>, Capacity> cells_;
+    };
+}
+
+#endif
@@ -15,36 +15,44 @@
  */
 #ifndef RAINY_COLLECTIONS_DENSE_MAP_HPP
 #define RAINY_COLLECTIONS_DENSE_MAP_HPP
+#include <rainy/collections/implements/dense_hash.hpp>
 #include <rainy/foundation/functional/functor.hpp>
 #include <rainy/foundation/memory/allocator.hpp>
 #include <rainy/utility.hpp>
 #include <rainy/utility/iterator.hpp>
 
 namespace rainy::collections::implements {
+    /**
+     * @brief dense_map 的节点，紧凑存放桶链后继下标、键的完整哈希值与元素
+     *
+     * 缓存的哈希值作为指纹：查找时先比较指纹，不相等即可跳过，不必访问键本身；扩容与删除时也无需重新计算哈希
+     */
     template <typename Key, typename Mapped>
     struct dense_map_node final {
         using value_type = utility::pair<Key, Mapped>;
 
         template <typename... Args>
-        dense_map_node(const std::size_t pos, Args &&...args) : next{pos}, elem{utility::forward<Args>(args)...} {
+        dense_map_node(const std::size_t pos, const std::size_t hash, Args &&...args) :
+            next{pos}, hash{hash}, elem{utility::forward<Args>(args)...} {
         }
 
         template <typename Allocator, typename... Args>
-        dense_map_node(std::allocator_arg_t, const Allocator &allocator, const std::size_t pos, Args &&...args) :
-            next{pos}, elem{utility::make_obj_using_allocator<value_type>(allocator, utility::forward<Args>(args)...)} {
+        dense_map_node(std::allocator_arg_t, const Allocator &allocator, const std::size_t pos, const std::size_t hash, Args &&...args) :
+            next{pos}, hash{hash}, elem{utility::make_obj_using_allocator<value_type>(allocator, utility::forward<Args>(args)...)} {
         }
 
         template <typename Allocator>
         dense_map_node(std::allocator_arg_t, const Allocator &allocator, const dense_map_node &other) :
-            next{other.next}, elem{utility::make_obj_using_allocator<value_type>(allocator, other.elem)} {
+            next{other.next}, hash{other.hash}, elem{utility::make_obj_using_allocator<value_type>(allocator, other.elem)} {
         }
 
         template <typename Allocator>
         dense_map_node(std::allocator_arg_t, const Allocator &allocator, dense_map_node &&other) :
-            next{other.next}, elem{utility::make_obj_using_allocator<value_type>(allocator, utility::move(other.elem))} {
+            next{other.next}, hash{other.hash}, elem{utility::make_obj_using_allocator<value_type>(allocator, utility::move(other.elem))} {
         }
 
         std::size_t next;
+        std::size_t hash;
         value_type elem;
     };
 
@@ -294,7 +302,7 @@ namespace rainy::collections {
         dense_map(const dense_map &right, const allocator_type &allocator) :
             storage{node_container_t(right.storage.first, typename alloc_traits::template rebind_alloc<node_type>(allocator)),
                     sparse_container_t(right.storage.second, typename alloc_traits::template rebind_alloc<node_type>(allocator))},
-            tools{right.tools}, load_factor_{right.load_factor_} {
+            tools{right.tools}, load_factor_{right.load_factor_}, bucket_shift_{right.bucket_shift_} {
         }
 
         dense_map(dense_map &&right, const allocator_type &allocator) :
@@ -303,10 +311,10 @@ namespace rainy::collections {
                     sparse_container_t(utility::move(right.storage.second),
                                        typename alloc_traits::template rebind_alloc<node_type>(allocator))},
             tools{utility::move(right.tools)},
-            load_factor_{right.load_factor_} {
+            load_factor_{right.load_factor_}, bucket_shift_{right.bucket_shift_} {
         }
 
-        dense_map(std::initializer_list<utility::pair<const key_type, mapped_type>> ilist) {
+        dense_map(std::initializer_list<utility::pair<const key_type, mapped_type>> ilist) : dense_map{minimum_capacity} {
             reserve(static_cast<std::size_t>(ilist.size()));
             for (const auto &item: ilist) {
                 insert(item);
@@ -330,6 +338,7 @@ namespace rainy::collections {
             using std::swap;
             swap(storage, other.storage);
             swap(load_factor_, other.load_factor_);
+            swap(bucket_shift_, other.bucket_shift_);
         }
 
         RAINY_NODISCARD allocator_type get_allocator() const noexcept {
@@ -394,6 +403,10 @@ namespace rainy::collections {
 
         template <typename Iter>
         void insert(Iter first, Iter last) {
+            if constexpr (type_traits::type_relations::is_base_of_v<std::forward_iterator_tag,
+                                                                    typename std::iterator_traits<Iter>::iterator_category>) {
+                reserve(size() + static_cast<size_type>(std::distance(first, last)));
+            }
             for (; first != last; ++first) {
                 insert(*first);
             }
@@ -421,13 +434,13 @@ namespace rainy::collections {
                 return insert_or_do_nothing(utility::forward<Args>(args)...);
 
             } else {
-                auto &node = storage.first.emplace_back(storage.first.size(), utility::forward<Args>(args)...);
-                const auto index = key_to_bucket(node.elem.first);
-                if (auto it = constrained_find(node.elem.first, index); it != end()) {
+                auto &node = storage.first.emplace_back(storage.first.size(), 0u, utility::forward<Args>(args)...);
+                node.hash = hash_of(node.elem.first);
+                if (auto it = constrained_find(node.elem.first, node.hash); it != end()) {
                     storage.first.pop_back();
                     return utility::make_pair(it, false);
                 }
-                std::swap(node.next, storage.second[index]);
+                std::swap(node.next, storage.second[hash_to_bucket(node.hash)]);
                 rehash_if_required();
                 return utility::make_pair(--end(), true);
             }
@@ -465,9 +478,10 @@ namespace rainy::collections {
 
         size_type erase(const key_type &keyval) {
             const auto &equal = tools.get_first();
-            for (size_type *curr = &storage.second[key_to_bucket(keyval)]; *curr != (utility::numeric_limits<size_type>::max)();
+            const auto hash = hash_of(keyval);
+            for (size_type *curr = &storage.second[hash_to_bucket(hash)]; *curr != (utility::numeric_limits<size_type>::max)();
                  curr = &storage.first[*curr].next) {
-                if (equal(storage.first[*curr].elem.first, keyval)) {
+                if (storage.first[*curr].hash == hash && equal(storage.first[*curr].elem.first, keyval)) {
                     const auto index = *curr;
                     *curr = storage.first[*curr].next;
                     move_and_pop(index);
@@ -510,11 +524,11 @@ namespace rainy::collections {
         }
 
         RAINY_NODISCARD iterator find(utility::in<key_type> keyval) {
-            return constrained_find(keyval, key_to_bucket(keyval));
+            return constrained_find(keyval, hash_of(keyval));
         }
 
         RAINY_NODISCARD const_iterator find(utility::in<key_type> keyval) const {
-            return constrained_find(keyval, key_to_bucket(keyval));
+            return constrained_find(keyval, hash_of(keyval));
         }
 
         template <typename Uty>
@@ -522,7 +536,7 @@ namespace rainy::collections {
                                                                   type_traits::type_properties::is_transparent_v<key_equal>,
                                                               std::conditional_t<false, Uty, iterator>>
         find(const Uty &keyval) {
-            return constrained_find(keyval, key_to_bucket(keyval));
+            return constrained_find(keyval, hash_of(keyval));
         }
 
         template <typename Uty>
@@ -530,7 +544,7 @@ namespace rainy::collections {
                                                                   type_traits::type_properties::is_transparent_v<key_equal>,
                                                               std::conditional_t<false, Uty, const_iterator>>
         find(const Uty &keyval) const {
-            return constrained_find(keyval, key_to_bucket(keyval));
+            return constrained_find(keyval, hash_of(keyval));
         }
 
         RAINY_NODISCARD utility::pair<iterator, iterator> equal_range(const key_type &keyval) {
@@ -632,21 +646,27 @@ namespace rainy::collections {
             const auto cap = static_cast<size_type>(static_cast<float>(size()) / max_load_factor());
             value = value > cap ? value : cap;
             if (const auto sz = core::builtin::next_power_of_two(value); sz != bucket_count()) {
-                storage.second.resize(sz);
-                for (auto &&elem: storage.second) {
-                    elem = (utility::numeric_limits<size_type>::max)();
-                }
+                // 节点中缓存了哈希值，重建桶链只需一次乘法与移位，不会再调用 hasher
+                storage.second.assign(sz, (utility::numeric_limits<size_type>::max)());
+                bucket_shift_ = implements::dense_bucket_shift(sz);
                 for (size_type pos{}, last = size(); pos < last; ++pos) {
-                    const auto index = key_to_bucket(storage.first[pos].elem.first);
+                    const auto index = hash_to_bucket(storage.first[pos].hash);
                     storage.first[pos].next = std::exchange(storage.second[index], pos);
                 }
             }
         }
 
+        /**
+         * @brief 预留至少容纳 count 个元素的空间，之后插入不超过 count 个元素都不会再触发重哈希
+         *
+         * 桶数组只会一次性扩大到目标大小，已满足要求时不做任何事，也不会缩小
+         */
         void reserve(const size_type count) {
             storage.first.reserve(count);
-            storage.second.reserve(count);
-            rehash(static_cast<size_type>(std::ceil(static_cast<float>(count) / max_load_factor())));
+            if (const auto required = static_cast<size_type>(std::ceil(static_cast<float>(count) / max_load_factor()));
+                required > bucket_count()) {
+                rehash(required);
+            }
         }
 
         RAINY_NODISCARD key_equal key_eq() const {
@@ -658,6 +678,7 @@ namespace rainy::collections {
         }
 
         void merge(dense_map &right) {
+            reserve(size() + right.size());
             for (value_type &&item: right) {
                 insert(item);
             }
@@ -665,6 +686,7 @@ namespace rainy::collections {
         }
 
         void merge(dense_map &&right) {
+            reserve(size() + right.size());
             for (value_type &&item: right) {
                 insert(utility::move(item));
             }
@@ -696,41 +718,55 @@ namespace rainy::collections {
         }
 
     private:
+        template <typename Uty>
+        RAINY_NODISCARD size_type hash_of(const Uty &keyval) const {
+            return static_cast<size_type>(tools.get_second()(keyval));
+        }
+
+        RAINY_NODISCARD size_type hash_to_bucket(const size_type hash) const noexcept {
+            return implements::dense_hash_to_bucket(hash, bucket_shift_);
+        }
+
         template <typename Uty>
         RAINY_NODISCARD std::size_t key_to_bucket(const Uty &keyval) const noexcept {
-            return core::builtin::mod(static_cast<size_type>(tools.get_second()(keyval)), bucket_count());
+            return hash_to_bucket(hash_of(keyval));
         }
 
+        /**
+         * @brief 沿桶链查找，指纹不同的节点直接跳过，只有指纹相同时才调用 key_equal
+         */
         template <typename Uty>
-        RAINY_NODISCARD auto constrained_find(const Uty &keyval, std::size_t bucket) {
+        RAINY_NODISCARD size_type constrained_find_index(const Uty &keyval, const size_type hash) const {
             const auto &equal = tools.get_first();
-            for (auto it = begin(bucket), last = end(bucket); it != last; ++it) {
-                if (equal(it->first, keyval)) {
-                    return begin() + static_cast<difference_type>(it.index());
+            for (size_type pos = storage.second[hash_to_bucket(hash)]; pos != (utility::numeric_limits<size_type>::max)();
+                 pos = storage.first[pos].next) {
+                if (const auto &node = storage.first[pos]; node.hash == hash && equal(node.elem.first, keyval)) {
+                    return pos;
                 }
             }
-            return end();
+            return (utility::numeric_limits<size_type>::max)();
         }
 
         template <typename Uty>
-        RAINY_NODISCARD auto constrained_find(const Uty &keyval, std::size_t bucket) const {
-            const auto &equal = tools.get_first();
-            for (auto it = cbegin(bucket), last = cend(bucket); it != last; ++it) {
-                if (equal(it->first, keyval)) {
-                    return cbegin() + static_cast<difference_type>(it.index());
-                }
-            }
+        RAINY_NODISCARD auto constrained_find(const Uty &keyval, const size_type hash) {
+            const auto pos = constrained_find_index(keyval, hash);
+            return pos == (utility::numeric_limits<size_type>::max)() ? end() : begin() + static_cast<difference_type>(pos);
+        }
 
-            return cend();
+        template <typename Uty>
+        RAINY_NODISCARD auto constrained_find(const Uty &keyval, const size_type hash) const {
+            const auto pos = constrained_find_index(keyval, hash);
+            return pos == (utility::numeric_limits<size_type>::max)() ? cend() : cbegin() + static_cast<difference_type>(pos);
         }
 
         template <typename Uty, typename... Args>
         RAINY_NODISCARD auto insert_or_do_nothing(Uty &&keyval, Args &&...args) {
-            const auto index = key_to_bucket(keyval);
-            if (auto it = constrained_find(keyval, index); it != end()) {
+            const auto hash = hash_of(keyval);
+            if (auto it = constrained_find(keyval, hash); it != end()) {
                 return utility::pair{it, false};
             }
-            storage.first.emplace_back(storage.second[index], std::piecewise_construct,
+            const auto index = hash_to_bucket(hash);
+            storage.first.emplace_back(storage.second[index], hash, std::piecewise_construct,
                                        std::forward_as_tuple(utility::forward<Uty>(keyval)),
                                        std::forward_as_tuple(utility::forward<Args>(args)...));
             storage.second[index] = storage.first.size() - 1u;
@@ -740,20 +776,21 @@ namespace rainy::collections {
 
         template <typename Uty, typename Arg>
         RAINY_NODISCARD auto insert_or_overwrite(Uty &&keyval, Arg &&value) {
-            const auto index = key_to_bucket(keyval);
-            if (auto it = constrained_find(keyval, index); it != end()) {
+            const auto hash = hash_of(keyval);
+            if (auto it = constrained_find(keyval, hash); it != end()) {
                 it->second = utility::forward<Arg>(value);
-                return std::make_pair(it, false);
+                return utility::pair{it, false};
             }
-            storage.first.emplace_back(storage.second[index], utility::forward<Uty>(keyval), utility::forward<Arg>(value));
+            const auto index = hash_to_bucket(hash);
+            storage.first.emplace_back(storage.second[index], hash, utility::forward<Uty>(keyval), utility::forward<Arg>(value));
             storage.second[index] = storage.first.size() - 1u;
             rehash_if_required();
-            return std::make_pair(--end(), true);
+            return utility::pair{--end(), true};
         }
 
         void move_and_pop(const std::size_t pos) {
             if (const auto last = size() - 1u; pos != last) {
-                size_type *curr = &storage.second[key_to_bucket(storage.first.back().elem.first)];
+                size_type *curr = &storage.second[hash_to_bucket(storage.first.back().hash)];
                 storage.first[pos] = utility::move(storage.first.back());
                 for (; *curr != last; curr = &storage.first[*curr].next) {
                 }
@@ -771,6 +808,7 @@ namespace rainy::collections {
         utility::pair<node_container_t, sparse_container_t> storage;
         utility::compressed_pair<key_equal, hasher> tools;
         float load_factor_{default_loadfactor};
+        int bucket_shift_{implements::dense_bucket_shift(minimum_capacity)};
     };
 }
 
@@ -1,5 +1,6 @@
 #ifndef RAINY_COLLECTIONS_DENSE_SET_HPP
 #define RAINY_COLLECTIONS_DENSE_SET_HPP
+#include <rainy/collections/implements/dense_hash.hpp>
 #include <rainy/core/core.hpp>
 #include <rainy/foundation/memory/allocator.hpp>
 #include <rainy/utility.hpp>
@@ -7,30 +8,35 @@
 #include <rainy/utility/iterator.hpp>
 
 namespace rainy::collections::implements {
+    /**
+     * @brief dense_set 的节点，hash 为元素的完整哈希值，用作查找时的指纹
+     */
     template <typename Key>
     struct dense_set_node final {
         using value_type = Key;
 
         template <typename... Args>
-        dense_set_node(const std::size_t pos, Args &&...args) : next{pos}, elem{utility::forward<Args>(args)...} {
+        dense_set_node(const std::size_t pos, const std::size_t hash, Args &&...args) :
+            next{pos}, hash{hash}, elem{utility::forward<Args>(args)...} {
         }
 
         template <typename Allocator, typename... Args>
-        dense_set_node(std::allocator_arg_t, const Allocator &allocator, const std::size_t pos, Args &&...args) :
-            next{pos}, elem{utility::make_obj_using_allocator<value_type>(allocator, utility::forward<Args>(args)...)} {
+        dense_set_node(std::allocator_arg_t, const Allocator &allocator, const std::size_t pos, const std::size_t hash, Args &&...args) :
+            next{pos}, hash{hash}, elem{utility::make_obj_using_allocator<value_type>(allocator, utility::forward<Args>(args)...)} {
         }
 
         template <typename Allocator>
         dense_set_node(std::allocator_arg_t, const Allocator &allocator, const dense_set_node &other) :
-            next{other.next}, elem{utility::make_obj_using_allocator<value_type>(allocator, other.elem)} {
+            next{other.next}, hash{other.hash}, elem{utility::make_obj_using_allocator<value_type>(allocator, other.elem)} {
         }
 
         template <typename Allocator>
         dense_set_node(std::allocator_arg_t, const Allocator &allocator, dense_set_node &&other) :
-            next{other.next}, elem{utility::make_obj_using_allocator<value_type>(allocator, utility::move(other.elem))} {
+            next{other.next}, hash{other.hash}, elem{utility::make_obj_using_allocator<value_type>(allocator, utility::move(other.elem))} {
         }
 
         std::size_t next;
+        std::size_t hash;
         value_type elem;
     };
 
@@ -251,7 +257,7 @@ namespace rainy::collections {
         using local_iterator = implements::dense_set_local_iterator<typename node_container_t::iterator>;
         using const_local_iterator = implements::dense_set_local_iterator<typename node_container_t::const_iterator>;
 
-        dense_set() : dense_set{minimum_capacity} {
+        dense_set() : dense_set(minimum_capacity) {
         }
 
         explicit dense_set(const allocator_type &allocator) : dense_set{minimum_capacity, hasher{}, key_equal{}, allocator} {
@@ -272,16 +278,17 @@ namespace rainy::collections {
 
         dense_set(const dense_set &) = default;
 
-        dense_set(const dense_set &other, const allocator_type &allocator) : storage{other.storage}, load_factor_{other.load_factor_} {
+        dense_set(const dense_set &other, const allocator_type &allocator) :
+            storage{other.storage}, load_factor_{other.load_factor_}, bucket_shift_{other.bucket_shift_} {
         }
 
         dense_set(dense_set &&) noexcept = default;
 
         dense_set(dense_set &&other, const allocator_type &allocator) :
-            storage{utility::move(other.storage)}, load_factor_{other.load_factor_} {
+            storage{utility::move(other.storage)}, load_factor_{other.load_factor_}, bucket_shift_{other.bucket_shift_} {
         }
 
-        dense_set(std::initializer_list<value_type> ilist) {
+        dense_set(std::initializer_list<value_type> ilist) : dense_set(minimum_capacity) {
             reserve(static_cast<std::size_t>(ilist.size()));
             for (const auto &item: ilist) {
                 insert(item);
@@ -306,6 +313,7 @@ namespace rainy::collections {
             using std::swap;
             swap(storage, other.storage);
             swap(load_factor_, other.load_factor_);
+            swap(bucket_shift_, other.bucket_shift_);
         }
 
         RAINY_NODISCARD constexpr allocator_type get_allocator() const noexcept {
@@ -364,6 +372,10 @@ namespace rainy::collections {
 
         template <typename Iter>
         void insert(Iter first, Iter last) {
+            if constexpr (type_traits::type_relations::is_base_of_v<std::forward_iterator_tag,
+                                                                    typename std::iterator_traits<Iter>::iterator_category>) {
+                reserve(size() + static_cast<size_type>(std::distance(first, last)));
+            }
             for (; first != last; ++first) {
                 insert(*first);
             }
@@ -398,9 +410,10 @@ namespace rainy::collections {
 
         size_type erase(const key_type &keyval) {
             const auto &equal = tools.get_first();
-            for (size_type *curr = &storage.second[key_to_bucket(keyval)]; *curr != (utility::numeric_limits<size_type>::max)();
+            const auto hash = hash_of(keyval);
+            for (size_type *curr = &storage.second[hash_to_bucket(hash)]; *curr != (utility::numeric_limits<size_type>::max)();
                  curr = &storage.first[*curr].next) {
-                if (equal(storage.first[*curr].elem, keyval)) {
+                if (storage.first[*curr].hash == hash && equal(storage.first[*curr].elem, keyval)) {
                     const auto index = *curr;
                     *curr = storage.first[*curr].next;
                     move_and_pop(index);
@@ -423,11 +436,11 @@ namespace rainy::collections {
         }
 
         RAINY_NODISCARD iterator find(const key_type &keyval) {
-            return constrained_find(keyval, key_to_bucket(keyval));
+            return constrained_find(keyval, hash_of(keyval));
         }
 
         RAINY_NODISCARD const_iterator find(const key_type &keyval) const {
-            return constrained_find(keyval, key_to_bucket(keyval));
+            return constrained_find(keyval, hash_of(keyval));
         }
 
         template <typename Uty>
@@ -435,7 +448,7 @@ namespace rainy::collections {
                                                                   type_traits::type_properties::is_transparent_v<key_equal>,
                                                               std::conditional_t<false, Uty, iterator>>
         find(const Uty &keyval) {
-            return constrained_find(keyval, key_to_bucket(keyval));
+            return constrained_find(keyval, hash_of(keyval));
         }
 
         template <typename Uty>
@@ -443,7 +456,7 @@ namespace rainy::collections {
                                                                   type_traits::type_properties::is_transparent_v<key_equal>,
                                                               std::conditional_t<false, Uty, const_iterator>>
         find(const Uty &keyval) const {
-            return constrained_find(keyval, key_to_bucket(keyval));
+            return constrained_find(keyval, hash_of(keyval));
         }
 
         RAINY_NODISCARD utility::pair<iterator, iterator> equal_range(const key_type &keyval) {
@@ -544,21 +557,24 @@ namespace rainy::collections {
             const auto cap = static_cast<size_type>(static_cast<float>(size()) / max_load_factor());
             value = value > cap ? value : cap;
             if (const auto sz = core::builtin::next_power_of_two(value); sz != bucket_count()) {
-                storage.second.resize(sz);
-                for (auto &&elem: storage.second) {
-                    elem = (utility::numeric_limits<size_type>::max)();
-                }
+                storage.second.assign(sz, (utility::numeric_limits<size_type>::max)());
+                bucket_shift_ = implements::dense_bucket_shift(sz);
                 for (size_type pos{}, last = size(); pos < last; ++pos) {
-                    const auto index = key_to_bucket(storage.first[pos].elem);
+                    const auto index = hash_to_bucket(storage.first[pos].hash);
                     storage.first[pos].next = std::exchange(storage.second[index], pos);
                 }
             }
         }
 
+        /**
+         * @brief 预留至少容纳 count 个元素的空间，桶数组一次性扩大到目标大小，且不会缩小
+         */
         void reserve(const size_type count) {
             storage.first.reserve(count);
-            storage.second.reserve(count);
-            rehash(static_cast<size_type>(std::ceil(static_cast<float>(count) / max_load_factor())));
+            if (const auto required = static_cast<size_type>(std::ceil(static_cast<float>(count) / max_load_factor()));
+                required > bucket_count()) {
+                rehash(required);
+            }
         }
 
         RAINY_NODISCARD key_equal key_eq() const {
@@ -570,41 +586,53 @@ namespace rainy::collections {
         }
 
     private:
+        template <typename Uty>
+        RAINY_NODISCARD size_type hash_of(const Uty &keyval) const {
+            return static_cast<size_type>(tools.get_second()(keyval));
+        }
+
+        RAINY_NODISCARD size_type hash_to_bucket(const size_type hash) const noexcept {
+            return implements::dense_hash_to_bucket(hash, bucket_shift_);
+        }
+
         template <typename Uty>
         RAINY_NODISCARD std::size_t key_to_bucket(const Uty &keyval) const noexcept {
-            return core::builtin::mod(static_cast<size_type>(tools.get_second()(keyval)), bucket_count());
+            return hash_to_bucket(hash_of(keyval));
         }
 
         template <typename Uty>
-        RAINY_NODISCARD auto constrained_find(const Uty &keyval, std::size_t bucket) {
+        RAINY_NODISCARD size_type constrained_find_index(const Uty &keyval, const size_type hash) const {
             const auto &equal = tools.get_first();
-            for (auto it = begin(bucket), last = end(bucket); it != last; ++it) {
-                if (equal(*it, keyval)) {
-                    return begin() + static_cast<difference_type>(it.index());
+            for (size_type pos = storage.second[hash_to_bucket(hash)]; pos != (utility::numeric_limits<size_type>::max)();
+                 pos = storage.first[pos].next) {
+                if (const auto &node = storage.first[pos]; node.hash == hash && equal(node.elem, keyval)) {
+                    return pos;
                 }
             }
-            return end();
+            return (utility::numeric_limits<size_type>::max)();
         }
 
         template <typename Uty>
-        RAINY_NODISCARD auto constrained_find(const Uty &keyval, std::size_t bucket) const {
-            const auto &equal = tools.get_first();
-            for (auto it = cbegin(bucket), last = cend(bucket); it != last; ++it) {
-                if (equal(*it, keyval)) {
-                    return cbegin() + static_cast<difference_type>(it.index());
-                }
-            }
-            return cend();
+        RAINY_NODISCARD auto constrained_find(const Uty &keyval, const size_type hash) {
+            const auto pos = constrained_find_index(keyval, hash);
+            return pos == (utility::numeric_limits<size_type>::max)() ? end() : begin() + static_cast<difference_type>(pos);
+        }
+
+        template <typename Uty>
+        RAINY_NODISCARD auto constrained_find(const Uty &keyval, const size_type hash) const {
+            const auto pos = constrained_find_index(keyval, hash);
+            return pos == (utility::numeric_limits<size_type>::max)() ? cend() : cbegin() + static_cast<difference_type>(pos);
         }
 
         template <typename... Args>
         RAINY_NODISCARD auto insert_or_do_nothing(Args &&...args) {
             auto elem = value_type{utility::forward<Args>(args)...};
-            const auto index = key_to_bucket(elem);
-            if (auto it = constrained_find(elem, index); it != end()) {
+            const auto hash = hash_of(elem);
+            if (auto it = constrained_find(elem, hash); it != end()) {
                 return utility::pair{it, false};
             }
-            storage.first.emplace_back(storage.second[index], utility::move(elem));
+            const auto index = hash_to_bucket(hash);
+            storage.first.emplace_back(storage.second[index], hash, utility::move(elem));
             storage.second[index] = storage.first.size() - 1u;
             rehash_if_required();
             return utility::pair{--end(), true};
@@ -612,7 +640,7 @@ namespace rainy::collections {
 
         void move_and_pop(const std::size_t pos) {
             if (const auto last = size() - 1u; pos != last) {
-                size_type *curr = &storage.second[key_to_bucket(storage.first.back().elem)];
+                size_type *curr = &storage.second[hash_to_bucket(storage.first.back().hash)];
                 storage.first[pos] = utility::move(storage.first.back());
                 for (; *curr != last; curr = &storage.first[*curr].next) {
                 }
@@ -630,6 +658,7 @@ namespace rainy::collections {
         utility::pair<node_container_t, sparse_container_t> storage;
         utility::compressed_pair<key_equal, hasher> tools;
         float load_factor_{default_loadfactor};
+        int bucket_shift_{implements::dense_bucket_shift(minimum_capacity)};
     };
 }
 
@@ -0,0 +1,216 @@
+/*
+ * Copyright 2026 rainy-juzixiao
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef RAINY_COLLECTIONS_FLAT_HASH_MAP_HPP
+#define RAINY_COLLECTIONS_FLAT_HASH_MAP_HPP
+#include <new>
+#include <rainy/collections/implements/raw_hash_map.hpp>
+
+namespace rainy::collections::implements::flat_hash {
+    /**
+     * @brief flat_hash_map 的槽位：元素直接存放在槽位数组中
+     *
+     * 对外以 pair<const Key, Mapped> 呈现，扩容搬移时则通过 pair<Key, Mapped> 视图移动键，避免复制
+     */
+    template <typename Key, typename Mapped>
+    union flat_map_slot {
+        using value_type = utility::pair<const Key, Mapped>;
+        using mutable_value_type = utility::pair<Key, Mapped>;
+
+        flat_map_slot() {
+        }
+
+        ~flat_map_slot() {
+        }
+
+        value_type value;
+        mutable_value_type mutable_value;
+    };
+
+    template <typename Key, typename Mapped>
+    struct flat_map_policy {
+        using slot_type = flat_map_slot<Key, Mapped>;
+        using key_type = Key;
+        using mapped_type = Mapped;
+        using value_type = utility::pair<const Key, Mapped>;
+        using mutable_value_type = utility::pair<Key, Mapped>;
+
+        static constexpr bool constant_iterators = false;
+
+        template <typename Allocator, typename... Args>
+        static void construct(Allocator &allocator, slot_type *slot, Args &&...args) {
+            std::allocator_traits<Allocator>::construct(allocator, &slot->value, utility::forward<Args>(args)...);
+        }
+
+        template <typename Allocator>
+        static void destroy(Allocator &allocator, slot_type *slot) noexcept {
+            std::allocator_traits<Allocator>::destroy(allocator, &slot->value);
+        }
+
+        template <typename Allocator>
+        static void transfer(Allocator &allocator, slot_type *new_slot, slot_type *old_slot) {
+            using mutable_allocator = typename std::allocator_traits<Allocator>::template rebind_alloc<mutable_value_type>;
+            mutable_allocator alloc(allocator);
+            std::allocator_traits<mutable_allocator>::construct(alloc, &new_slot->mutable_value,
+                                                                utility::move(*std::launder(&old_slot->mutable_value)));
+            destroy(allocator, old_slot);
+        }
+
+        static value_type &element(slot_type *slot) noexcept {
+            return slot->value;
+        }
+
+        static mutable_value_type &mutable_element(slot_type *slot) noexcept {
+            return *std::launder(&slot->mutable_value);
+        }
+
+        static const Key &key(const slot_type *slot) noexcept {
+            return slot->value.first;
+        }
+
+        static const Key &key_of(const value_type &value) noexcept {
+            return value.first;
+        }
+
+        static bool equal_elements(const value_type &left, const value_type &right) {
+            return left.second == right.second;
+        }
+    };
+
+    /**
+     * @brief node_hash_map 的策略：槽位只保存指向独立分配节点的指针，元素地址在扩容后保持不变
+     */
+    template <typename Key, typename Mapped>
+    struct node_map_policy {
+        using key_type = Key;
+        using mapped_type = Mapped;
+        using value_type = utility::pair<const Key, Mapped>;
+        using mutable_value_type = utility::pair<Key, Mapped>;
+        using slot_type = value_type *;
+
+        static constexpr bool constant_iterators = false;
+
+        template <typename Allocator, typename... Args>
+        static void construct(Allocator &allocator, slot_type *slot, Args &&...args) {
+            using node_allocator = typename std::allocator_traits<Allocator>::template rebind_alloc<value_type>;
+            using node_traits = std::allocator_traits<node_allocator>;
+            node_allocator alloc(allocator);
+            value_type *node = node_traits::allocate(alloc, 1);
+            try {
+                node_traits::construct(alloc, node, utility::forward<Args>(args)...);
+            } catch (...) {
+                node_traits::deallocate(alloc, node, 1);
+                throw;
+            }
+            *slot = node;
+        }
+
+        template <typename Allocator>
+        static void destroy(Allocator &allocator, slot_type *slot) noexcept {
+            using node_allocator = typename std::allocator_traits<Allocator>::template rebind_alloc<value_type>;
+            using node_traits = std::allocator_traits<node_allocator>;
+            node_allocator alloc(allocator);
+            node_traits::destroy(alloc, *slot);
+            node_traits::deallocate(alloc, *slot, 1);
+        }
+
+        template <typename Allocator>
+        static void transfer(Allocator &, slot_type *new_slot, slot_type *old_slot) noexcept {
+            *new_slot = *old_slot;
+        }
+
+        static value_type &element(slot_type *slot) noexcept {
+            return **slot;
+        }
+
+        static mutable_value_type &mutable_element(slot_type *slot) noexcept {
+            return reinterpret_cast<mutable_value_type &>(**slot);
+        }
+
+        static const Key &key(const slot_type *slot) noexcept {
+            return (*slot)->first;
+        }
+
+        static const Key &key_of(const value_type &value) noexcept {
+            return value.first;
+        }
+
+        static bool equal_elements(const value_type &left, const value_type &right) {
+            return left.second == right.second;
+        }
+    };
+}
+
+namespace rainy::collections {
+    /**
+     * @brief 基于开放寻址与 SIMD 分组探测的哈希表（Swiss table）
+     *
+     * 元素直接存放在连续的槽位数组中，每个槽位附带 1 字节控制字，一次查找通常只访问一条控制字缓存行和一个槽位。
+     * 相比 unordered_map 不再需要链表节点与桶数组的多次间接访问，但插入、删除或扩容后迭代器、指针和引用都会失效；
+     * 需要元素地址稳定时请使用 node_hash_map。
+     *
+     * 当 Hash 与 KeyEqual 都声明了 is_transparent 时，find、contains、count、erase、at、try_emplace 等接口接受可与 Key 比较的任意类型。
+     *
+     * @tparam Key 键类型
+     * @tparam Mapped 映射值类型
+     * @tparam Hash 哈希函数，结果会在内部再混合一次，因此恒等哈希也可以使用
+     * @tparam KeyEqual 键的相等比较
+     * @tparam Allocator 分配器
+     */
+    template <typename Key, typename Mapped, typename Hash = utility::hash<Key>,
+              typename KeyEqual = foundation::functional::equal<Key>,
+              typename Allocator = foundation::memory::allocator<utility::pair<const Key, Mapped>>>
+    class flat_hash_map
+        : public implements::flat_hash::raw_hash_map<implements::flat_hash::flat_map_policy<Key, Mapped>, Hash, KeyEqual, Allocator> {
+    public:
+        using base = implements::flat_hash::raw_hash_map<implements::flat_hash::flat_map_policy<Key, Mapped>, Hash, KeyEqual, Allocator>;
+
+        using base::base;
+
+        flat_hash_map() = default;
+    };
+
+    /**
+     * @brief 与 flat_hash_map 接口相同，但元素单独分配，槽位只保存指针
+     *
+     * 扩容与删除其他元素都不会移动已有元素，指向元素的指针和引用在元素被删除前始终有效
+     */
+    template <typename Key, typename Mapped, typename Hash = utility::hash<Key>,
+              typename KeyEqual = foundation::functional::equal<Key>,
+              typename Allocator = foundation::memory::allocator<utility::pair<const Key, Mapped>>>
+    class node_hash_map
+        : public implements::flat_hash::raw_hash_map<implements::flat_hash::node_map_policy<Key, Mapped>, Hash, KeyEqual, Allocator> {
+    public:
+        using base = implements::flat_hash::raw_hash_map<implements::flat_hash::node_map_policy<Key, Mapped>, Hash, KeyEqual, Allocator>;
+
+        using base::base;
+
+        node_hash_map() = default;
+    };
+
+    template <typename Key, typename Mapped, typename Hash, typename KeyEqual, typename Allocator>
+    void swap(flat_hash_map<Key, Mapped, Hash, KeyEqual, Allocator> &left,
+              flat_hash_map<Key, Mapped, Hash, KeyEqual, Allocator> &right) noexcept {
+        left.swap(right);
+    }
+
+    template <typename Key, typename Mapped, typename Hash, typename KeyEqual, typename Allocator>
+    void swap(node_hash_map<Key, Mapped, Hash, KeyEqual, Allocator> &left,
+              node_hash_map<Key, Mapped, Hash, KeyEqual, Allocator> &right) noexcept {
+        left.swap(right);
+    }
+}
+
+#endif
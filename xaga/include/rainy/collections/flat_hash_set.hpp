@@ -0,0 +1,255 @@
+/*
+ * Copyright 2026 rainy-juzixiao
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef RAINY_COLLECTIONS_FLAT_HASH_SET_HPP
+#define RAINY_COLLECTIONS_FLAT_HASH_SET_HPP
+#include <initializer_list>
+#include <rainy/collections/implements/raw_hash_set.hpp>
+
+namespace rainy::collections::implements::flat_hash {
+    template <typename Key>
+    struct flat_set_policy {
+        using slot_type = Key;
+        using key_type = Key;
+        using value_type = Key;
+
+        static constexpr bool constant_iterators = true;
+
+        template <typename Allocator, typename... Args>
+        static void construct(Allocator &allocator, slot_type *slot, Args &&...args) {
+            std::allocator_traits<Allocator>::construct(allocator, slot, utility::forward<Args>(args)...);
+        }
+
+        template <typename Allocator>
+        static void destroy(Allocator &allocator, slot_type *slot) noexcept {
+            std::allocator_traits<Allocator>::destroy(allocator, slot);
+        }
+
+        template <typename Allocator>
+        static void transfer(Allocator &allocator, slot_type *new_slot, slot_type *old_slot) {
+            construct(allocator, new_slot, utility::move(*old_slot));
+            destroy(allocator, old_slot);
+        }
+
+        static value_type &element(slot_type *slot) noexcept {
+            return *slot;
+        }
+
+        static value_type &mutable_element(slot_type *slot) noexcept {
+            return *slot;
+        }
+
+        static const Key &key(const slot_type *slot) noexcept {
+            return *slot;
+        }
+
+        static const Key &key_of(const value_type &value) noexcept {
+            return value;
+        }
+
+        static bool equal_elements(const value_type &, const value_type &) noexcept {
+            return true;
+        }
+    };
+
+    template <typename Key>
+    struct node_set_policy {
+        using key_type = Key;
+        using value_type = Key;
+        using slot_type = Key *;
+
+        static constexpr bool constant_iterators = true;
+
+        template <typename Allocator, typename... Args>
+        static void construct(Allocator &allocator, slot_type *slot, Args &&...args) {
+            using node_traits = std::allocator_traits<Allocator>;
+            Key *node = node_traits::allocate(allocator, 1);
+            try {
+                node_traits::construct(allocator, node, utility::forward<Args>(args)...);
+            } catch (...) {
+                node_traits::deallocate(allocator, node, 1);
+                throw;
+            }
+            *slot = node;
+        }
+
+        template <typename Allocator>
+        static void destroy(Allocator &allocator, slot_type *slot) noexcept {
+            std::allocator_traits<Allocator>::destroy(allocator, *slot);
+            std::allocator_traits<Allocator>::deallocate(allocator, *slot, 1);
+        }
+
+        template <typename Allocator>
+        static void transfer(Allocator &, slot_type *new_slot, slot_type *old_slot) noexcept {
+            *new_slot = *old_slot;
+        }
+
+        static value_type &element(slot_type *slot) noexcept {
+            return **slot;
+        }
+
+        static value_type &mutable_element(slot_type *slot) noexcept {
+            return **slot;
+        }
+
+        static const Key &key(const slot_type *slot) noexcept {
+            return **slot;
+        }
+
+        static const Key &key_of(const value_type &value) noexcept {
+            return value;
+        }
+
+        static bool equal_elements(const value_type &, const value_type &) noexcept {
+            return true;
+        }
+    };
+
+    /**
+     * @brief 集合类 Swiss table 的公共接口
+     */
+    template <typename Policy, typename Hash, typename KeyEqual, typename Allocator>
+    class raw_hash_set_facade : public raw_hash_set<Policy, Hash, KeyEqual, Allocator> {
+    public:
+        using base = raw_hash_set<Policy, Hash, KeyEqual, Allocator>;
+        using key_type = typename Policy::key_type;
+        using value_type = typename Policy::value_type;
+        using iterator = typename base::iterator;
+        using const_iterator = typename base::const_iterator;
+        using size_type = typename base::size_type;
+        using hasher = typename base::hasher;
+        using key_equal = typename base::key_equal;
+        using allocator_type = typename base::allocator_type;
+
+        using base::base;
+
+        raw_hash_set_facade() = default;
+
+        template <typename Iter>
+        raw_hash_set_facade(Iter first, Iter last, const size_type bucket_count = 0, const hasher &hash = hasher{},
+                            const key_equal &equal = key_equal{}, const allocator_type &allocator = allocator_type{}) :
+            base(bucket_count, hash, equal, allocator) {
+            insert(first, last);
+        }
+
+        raw_hash_set_facade(std::initializer_list<value_type> ilist, const size_type bucket_count = 0, const hasher &hash = hasher{},
+                            const key_equal &equal = key_equal{}, const allocator_type &allocator = allocator_type{}) :
+            base(bucket_count, hash, equal, allocator) {
+            insert(ilist);
+        }
+
+        raw_hash_set_facade(std::initializer_list<value_type> ilist, const allocator_type &allocator) :
+            raw_hash_set_facade(ilist, 0, hasher{}, key_equal{}, allocator) {
+        }
+
+        raw_hash_set_facade &operator=(std::initializer_list<value_type> ilist) {
+            this->clear();
+            insert(ilist);
+            return *this;
+        }
+
+        utility::pair<iterator, bool> insert(const value_type &value) {
+            return this->emplace_with_key(value, value);
+        }
+
+        utility::pair<iterator, bool> insert(value_type &&value) {
+            return this->emplace_with_key(value, utility::move(value));
+        }
+
+        iterator insert(const_iterator, const value_type &value) {
+            return insert(value).first;
+        }
+
+        iterator insert(const_iterator, value_type &&value) {
+            return insert(utility::move(value)).first;
+        }
+
+        template <typename Iter>
+        void insert(Iter first, Iter last) {
+            for (; first != last; ++first) {
+                emplace(*first);
+            }
+        }
+
+        void insert(std::initializer_list<value_type> ilist) {
+            insert(ilist.begin(), ilist.end());
+        }
+
+        /**
+         * @brief 参数恰为一个 key_type 时直接按其查找，否则先构造临时的键
+         */
+        template <typename... Args>
+        utility::pair<iterator, bool> emplace(Args &&...args) {
+            if constexpr (sizeof...(Args) == 1 &&
+                          (type_traits::type_relations::is_same_v<type_traits::other_trans::decay_t<Args>, key_type> && ...)) {
+                return this->emplace_with_key(args..., utility::forward<Args>(args)...);
+            } else {
+                key_type tmp(utility::forward<Args>(args)...);
+                return this->emplace_with_key(tmp, utility::move(tmp));
+            }
+        }
+
+        template <typename... Args>
+        iterator emplace_hint(const_iterator, Args &&...args) {
+            return emplace(utility::forward<Args>(args)...).first;
+        }
+    };
+}
+
+namespace rainy::collections {
+    /**
+     * @brief 基于开放寻址与 SIMD 分组探测的哈希集合，元素直接存放在槽位数组中
+     *
+     * 插入、删除或扩容后迭代器、指针和引用都会失效；需要元素地址稳定时请使用 node_hash_set
+     */
+    template <typename Key, typename Hash = utility::hash<Key>, typename KeyEqual = foundation::functional::equal<Key>,
+              typename Allocator = foundation::memory::allocator<Key>>
+    class flat_hash_set
+        : public implements::flat_hash::raw_hash_set_facade<implements::flat_hash::flat_set_policy<Key>, Hash, KeyEqual, Allocator> {
+    public:
+        using base = implements::flat_hash::raw_hash_set_facade<implements::flat_hash::flat_set_policy<Key>, Hash, KeyEqual, Allocator>;
+
+        using base::base;
+
+        flat_hash_set() = default;
+    };
+
+    /**
+     * @brief 与 flat_hash_set 接口相同，但元素单独分配，扩容后元素地址保持不变
+     */
+    template <typename Key, typename Hash = utility::hash<Key>, typename KeyEqual = foundation::functional::equal<Key>,
+              typename Allocator = foundation::memory::allocator<Key>>
+    class node_hash_set
+        : public implements::flat_hash::raw_hash_set_facade<implements::flat_hash::node_set_policy<Key>, Hash, KeyEqual, Allocator> {
+    public:
+        using base = implements::flat_hash::raw_hash_set_facade<implements::flat_hash::node_set_policy<Key>, Hash, KeyEqual, Allocator>;
+
+        using base::base;
+
+        node_hash_set() = default;
+    };
+
+    template <typename Key, typename Hash, typename KeyEqual, typename Allocator>
+    void swap(flat_hash_set<Key, Hash, KeyEqual, Allocator> &left, flat_hash_set<Key, Hash, KeyEqual, Allocator> &right) noexcept {
+        left.swap(right);
+    }
+
+    template <typename Key, typename Hash, typename KeyEqual, typename Allocator>
+    void swap(node_hash_set<Key, Hash, KeyEqual, Allocator> &left, node_hash_set<Key, Hash, KeyEqual, Allocator> &right) noexcept {
+        left.swap(right);
+    }
+}
+
+#endif
@@ -0,0 +1,46 @@
+/*
+ * Copyright 2026 rainy-juzixiao
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef RAINY_COLLECTIONS_IMPLEMENTS_DENSE_HASH_HPP
+#define RAINY_COLLECTIONS_IMPLEMENTS_DENSE_HASH_HPP
+#include <rainy/core/core.hpp>
+
+/*
+ * dense_map 与 dense_set 共用的桶下标计算。
+ *
+ * 桶数量始终为 2 的幂，下标取哈希值乘以黄金分割常数后的高位（fibonacci hashing），
+ * 因此恒等哈希的整数键或低位分布很差的哈希也能均匀落入各个桶，且整个过程只有一次乘法与一次移位。
+ */
+namespace rainy::collections::implements {
+    inline constexpr std::size_t dense_fibonacci_multiplier =
+        sizeof(std::size_t) == 8 ? static_cast<std::size_t>(0x9E3779B97F4A7C15ULL) : static_cast<std::size_t>(0x9E3779B9U);
+
+    /**
+     * @brief 根据桶数量（2 的幂）计算取高位时的右移位数
+     */
+    RAINY_NODISCARD constexpr int dense_bucket_shift(const std::size_t bucket_count) noexcept {
+        int log2 = 0;
+        for (std::size_t value = bucket_count; value > 1u; value >>= 1u) {
+            ++log2;
+        }
+        return static_cast<int>(sizeof(std::size_t) * 8) - log2;
+    }
+
+    RAINY_NODISCARD constexpr std::size_t dense_hash_to_bucket(const std::size_t hash, const int shift) noexcept {
+        return static_cast<std::size_t>(hash * dense_fibonacci_multiplier) >> shift;
+    }
+}
+
+#endif
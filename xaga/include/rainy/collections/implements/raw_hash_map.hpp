@@ -0,0 +1,214 @@
+/*
+ * Copyright 2026 rainy-juzixiao
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef RAINY_COLLECTIONS_IMPLEMENTS_RAW_HASH_MAP_HPP
+#define RAINY_COLLECTIONS_IMPLEMENTS_RAW_HASH_MAP_HPP
+#include <initializer_list>
+#include <rainy/collections/implements/raw_hash_set.hpp>
+
+namespace rainy::collections::implements::flat_hash {
+    /**
+     * @brief 映射类 Swiss table 的公共接口，在 raw_hash_set 之上补充 mapped_type 相关的操作
+     */
+    template <typename Policy, typename Hash, typename KeyEqual, typename Allocator>
+    class raw_hash_map : public raw_hash_set<Policy, Hash, KeyEqual, Allocator> {
+    public:
+        using base = raw_hash_set<Policy, Hash, KeyEqual, Allocator>;
+        using key_type = typename Policy::key_type;
+        using mapped_type = typename Policy::mapped_type;
+        using value_type = typename Policy::value_type;
+        using iterator = typename base::iterator;
+        using const_iterator = typename base::const_iterator;
+        using size_type = typename base::size_type;
+        using hasher = typename base::hasher;
+        using key_equal = typename base::key_equal;
+        using allocator_type = typename base::allocator_type;
+
+    protected:
+        template <typename Kty>
+        using key_arg = typename base::template key_arg<Kty>;
+
+    public:
+        using base::base;
+
+        raw_hash_map() = default;
+
+        template <typename Iter>
+        raw_hash_map(Iter first, Iter last, const size_type bucket_count = 0, const hasher &hash = hasher{},
+                     const key_equal &equal = key_equal{}, const allocator_type &allocator = allocator_type{}) :
+            base(bucket_count, hash, equal, allocator) {
+            insert(first, last);
+        }
+
+        raw_hash_map(std::initializer_list<value_type> ilist, const size_type bucket_count = 0, const hasher &hash = hasher{},
+                     const key_equal &equal = key_equal{}, const allocator_type &allocator = allocator_type{}) :
+            base(bucket_count, hash, equal, allocator) {
+            insert(ilist);
+        }
+
+        raw_hash_map(std::initializer_list<value_type> ilist, const allocator_type &allocator) : raw_hash_map(ilist, 0, hasher{}, key_equal{}, allocator) {
+        }
+
+        raw_hash_map &operator=(std::initializer_list<value_type> ilist) {
+            this->clear();
+            insert(ilist);
+            return *this;
+        }
+
+        utility::pair<iterator, bool> insert(const value_type &value) {
+            return this->emplace_with_key(value.first, value);
+        }
+
+        utility::pair<iterator, bool> insert(value_type &&value) {
+            return this->emplace_with_key(value.first, utility::move(value));
+        }
+
+        template <typename Pair, type_traits::other_trans::enable_if_t<
+                                     type_traits::type_properties::is_constructible_v<value_type, Pair &&>, int> = 0>
+        utility::pair<iterator, bool> insert(Pair &&value) {
+            return emplace(utility::forward<Pair>(value));
+        }
+
+        iterator insert(const_iterator, const value_type &value) {
+            return insert(value).first;
+        }
+
+        iterator insert(const_iterator, value_type &&value) {
+            return insert(utility::move(value)).first;
+        }
+
+        template <typename Iter>
+        void insert(Iter first, Iter last) {
+            for (; first != last; ++first) {
+                emplace(*first);
+            }
+        }
+
+        void insert(std::initializer_list<value_type> ilist) {
+            insert(ilist.begin(), ilist.end());
+        }
+
+        template <typename Kty = key_type, typename Mx>
+        utility::pair<iterator, bool> insert_or_assign(const key_arg<Kty> &keyval, Mx &&obj) {
+            return insert_or_assign_impl(keyval, utility::forward<Mx>(obj));
+        }
+
+        template <typename Mx>
+        utility::pair<iterator, bool> insert_or_assign(key_type &&keyval, Mx &&obj) {
+            return insert_or_assign_impl(utility::move(keyval), utility::forward<Mx>(obj));
+        }
+
+        template <typename Kty = key_type, typename... Args>
+        utility::pair<iterator, bool> try_emplace(const key_arg<Kty> &keyval, Args &&...args) {
+            return try_emplace_impl(keyval, utility::forward<Args>(args)...);
+        }
+
+        template <typename... Args>
+        utility::pair<iterator, bool> try_emplace(key_type &&keyval, Args &&...args) {
+            return try_emplace_impl(utility::move(keyval), utility::forward<Args>(args)...);
+        }
+
+        template <typename Kty = key_type, typename... Args>
+        iterator try_emplace(const_iterator, const key_arg<Kty> &keyval, Args &&...args) {
+            return try_emplace_impl(keyval, utility::forward<Args>(args)...).first;
+        }
+
+        /**
+         * @brief 能直接取得键时不构造临时元素，否则先构造元素再按其键插入
+         */
+        template <typename... Args>
+        utility::pair<iterator, bool> emplace(Args &&...args) {
+            if constexpr (sizeof...(Args) == 2) {
+                return emplace_two(utility::forward<Args>(args)...);
+            } else if constexpr (sizeof...(Args) == 1) {
+                return emplace_one(utility::forward<Args>(args)...);
+            } else {
+                value_type tmp(utility::forward<Args>(args)...);
+                return this->emplace_with_key(tmp.first, utility::move(tmp));
+            }
+        }
+
+        template <typename... Args>
+        iterator emplace_hint(const_iterator, Args &&...args) {
+            return emplace(utility::forward<Args>(args)...).first;
+        }
+
+        template <typename Kty = key_type>
+        RAINY_NODISCARD mapped_type &at(const key_arg<Kty> &keyval) {
+            const auto it = this->find(keyval);
+            if (it == this->end()) {
+                foundation::exceptions::logic::throw_out_of_range("flat_hash_map::at: key not found");
+            }
+            return it->second;
+        }
+
+        template <typename Kty = key_type>
+        RAINY_NODISCARD const mapped_type &at(const key_arg<Kty> &keyval) const {
+            const auto it = this->find(keyval);
+            if (it == this->end()) {
+                foundation::exceptions::logic::throw_out_of_range("flat_hash_map::at: key not found");
+            }
+            return it->second;
+        }
+
+        template <typename Kty = key_type>
+        mapped_type &operator[](const key_arg<Kty> &keyval) {
+            return try_emplace(keyval).first->second;
+        }
+
+        mapped_type &operator[](key_type &&keyval) {
+            return try_emplace(utility::move(keyval)).first->second;
+        }
+
+    private:
+        template <typename Kty, typename... Args>
+        utility::pair<iterator, bool> try_emplace_impl(Kty &&keyval, Args &&...args) {
+            return this->emplace_with_key(keyval, std::piecewise_construct, std::forward_as_tuple(utility::forward<Kty>(keyval)),
+                                          std::forward_as_tuple(utility::forward<Args>(args)...));
+        }
+
+        template <typename Kty, typename Mx>
+        utility::pair<iterator, bool> insert_or_assign_impl(Kty &&keyval, Mx &&obj) {
+            auto res = this->emplace_with_key(keyval, utility::forward<Kty>(keyval), utility::forward<Mx>(obj));
+            if (!res.second) {
+                res.first->second = utility::forward<Mx>(obj);
+            }
+            return res;
+        }
+
+        template <typename Kty, typename Mx>
+        utility::pair<iterator, bool> emplace_two(Kty &&keyval, Mx &&obj) {
+            if constexpr (type_traits::type_relations::is_same_v<type_traits::other_trans::decay_t<Kty>, key_type>) {
+                return this->emplace_with_key(keyval, utility::forward<Kty>(keyval), utility::forward<Mx>(obj));
+            } else {
+                value_type tmp(utility::forward<Kty>(keyval), utility::forward<Mx>(obj));
+                return this->emplace_with_key(tmp.first, utility::move(tmp));
+            }
+        }
+
+        template <typename Pair>
+        utility::pair<iterator, bool> emplace_one(Pair &&value) {
+            using first_type = type_traits::other_trans::decay_t<decltype(value.first)>;
+            if constexpr (type_traits::type_relations::is_same_v<first_type, key_type>) {
+                return this->emplace_with_key(value.first, utility::forward<Pair>(value));
+            } else {
+                value_type tmp(utility::forward<Pair>(value));
+                return this->emplace_with_key(tmp.first, utility::move(tmp));
+            }
+        }
+    };
+}
+
+#endif
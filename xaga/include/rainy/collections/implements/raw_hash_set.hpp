@@ -0,0 +1,1024 @@
+/*
+ * Copyright 2026 rainy-juzixiao
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef RAINY_COLLECTIONS_IMPLEMENTS_RAW_HASH_SET_HPP
+#define RAINY_COLLECTIONS_IMPLEMENTS_RAW_HASH_SET_HPP
+#include <cstdint>
+#include <cstring>
+#include <tuple>
+#include <rainy/core/core.hpp>
+#include <rainy/foundation/functional/functor.hpp>
+#include <rainy/foundation/memory/allocator.hpp>
+#include <rainy/utility.hpp>
+
+#if RAINY_USING_MSVC
+#include <intrin.h>
+#endif
+
+#if RAINY_USING_AVX2 && RAINY_IS_X86_PLATFORM
+#define RAINY_FLAT_HASH_GROUP_AVX2 1
+#elif RAINY_IS_X86_PLATFORM && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#define RAINY_FLAT_HASH_GROUP_SSE2 1
+#include <emmintrin.h>
+#endif
+
+/*
+ * 开放寻址的 Swiss table 实现，供 flat_hash_map / flat_hash_set / node_hash_map / node_hash_set 共用。
+ *
+ * 每个槽位对应一个 1 字节的控制字：最高位为 1 表示空、已删除或哨兵，为 0 时低 7 位保存哈希值的低 7 位（H2）。
+ * 查找时以哈希值的高位（H1）定位起始组，一次比较一组控制字（AVX2 为 32 个，SSE2 为 16 个，标量回退为 8 个），
+ * 只有 H2 命中的槽位才会调用 key_equal，遇到含空槽的组即可判定不存在。
+ * 控制字数组末尾复制了前 width - 1 个控制字，因此任意位置开始的组加载都不会越界，也无需回绕。
+ */
+namespace rainy::collections::implements::flat_hash {
+    using ctrl_t = std::int8_t;
+
+    enum : ctrl_t {
+        ctrl_empty = -128,
+        ctrl_deleted = -2,
+        ctrl_sentinel = -1
+    };
+
+    RAINY_NODISCARD inline bool is_full(const ctrl_t c) noexcept {
+        return c >= 0;
+    }
+
+    RAINY_NODISCARD inline bool is_empty(const ctrl_t c) noexcept {
+        return c == ctrl_empty;
+    }
+
+    RAINY_NODISCARD inline bool is_empty_or_deleted(const ctrl_t c) noexcept {
+        return c < ctrl_sentinel;
+    }
+
+    RAINY_NODISCARD inline int trailing_zeros(const std::uint32_t x) noexcept {
+#if RAINY_USING_MSVC
+        unsigned long index = 0;
+        _BitScanForward(&index, x);
+        return static_cast<int>(index);
+#else
+        return __builtin_ctz(x);
+#endif
+    }
+
+    RAINY_NODISCARD inline int trailing_zeros(const std::uint64_t x) noexcept {
+#if RAINY_USING_MSVC && RAINY_USING_64_BIT_PLATFORM
+        unsigned long index = 0;
+        _BitScanForward64(&index, x);
+        return static_cast<int>(index);
+#elif RAINY_USING_MSVC
+        return core::builtin::countr_zero(x);
+#else
+        return __builtin_ctzll(x);
+#endif
+    }
+
+    RAINY_NODISCARD inline int leading_zeros(const std::uint32_t x) noexcept {
+#if RAINY_USING_MSVC
+        unsigned long index = 0;
+        return _BitScanReverse(&index, x) ? 31 - static_cast<int>(index) : 32;
+#else
+        return x ? __builtin_clz(x) : 32;
+#endif
+    }
+
+    RAINY_NODISCARD inline int leading_zeros(const std::uint64_t x) noexcept {
+#if RAINY_USING_MSVC && RAINY_USING_64_BIT_PLATFORM
+        unsigned long index = 0;
+        return _BitScanReverse64(&index, x) ? 63 - static_cast<int>(index) : 64;
+#elif RAINY_USING_MSVC
+        return core::builtin::countl_zero(x);
+#else
+        return x ? __builtin_clzll(x) : 64;
+#endif
+    }
+
+    /**
+     * @brief 组匹配结果：每个槽位占 1 << Shift 位，遍历时依次给出命中槽位在组内的下标
+     */
+    template <typename Ty, int SignificantBits, int Shift = 0>
+    class bitmask {
+    public:
+        explicit bitmask(const Ty mask) noexcept : mask_(mask) {
+        }
+
+        bitmask &operator++() noexcept {
+            mask_ &= (mask_ - 1);
+            return *this;
+        }
+
+        explicit operator bool() const noexcept {
+            return mask_ != 0;
+        }
+
+        int operator*() const noexcept {
+            return lowest_bit_set();
+        }
+
+        RAINY_NODISCARD bitmask begin() const noexcept {
+            return *this;
+        }
+
+        RAINY_NODISCARD bitmask end() const noexcept {
+            return bitmask(0);
+        }
+
+        RAINY_NODISCARD int lowest_bit_set() const noexcept {
+            return flat_hash::trailing_zeros(mask_) >> Shift;
+        }
+
+        RAINY_NODISCARD int trailing_zeros() const noexcept {
+            return flat_hash::trailing_zeros(mask_) >> Shift;
+        }
+
+        RAINY_NODISCARD int leading_zeros() const noexcept {
+            constexpr int total_significant_bits = SignificantBits << Shift;
+            constexpr int extra_bits = static_cast<int>(sizeof(Ty) * 8) - total_significant_bits;
+            return flat_hash::leading_zeros(static_cast<Ty>(mask_ << extra_bits)) >> Shift;
+        }
+
+        friend bool operator==(const bitmask &left, const bitmask &right) noexcept {
+            return left.mask_ == right.mask_;
+        }
+
+        friend bool operator!=(const bitmask &left, const bitmask &right) noexcept {
+            return left.mask_ != right.mask_;
+        }
+
+    private:
+        Ty mask_;
+    };
+
+#if RAINY_FLAT_HASH_GROUP_AVX2
+    struct group {
+        static constexpr std::size_t width = 32;
+
+        explicit group(const ctrl_t *pos) noexcept : ctrl(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(pos))) {
+        }
+
+        RAINY_NODISCARD bitmask<std::uint32_t, 32> match(const std::uint8_t h2) const noexcept {
+            const __m256i target = _mm256_set1_epi8(static_cast<char>(h2));
+            return bitmask<std::uint32_t, 32>(static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(target, ctrl))));
+        }
+
+        RAINY_NODISCARD bitmask<std::uint32_t, 32> mask_empty() const noexcept {
+            const __m256i target = _mm256_set1_epi8(static_cast<char>(ctrl_empty));
+            return bitmask<std::uint32_t, 32>(static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(target, ctrl))));
+        }
+
+        RAINY_NODISCARD bitmask<std::uint32_t, 32> mask_empty_or_deleted() const noexcept {
+            const __m256i special = _mm256_set1_epi8(static_cast<char>(ctrl_sentinel));
+            return bitmask<std::uint32_t, 32>(static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_cmpgt_epi8(special, ctrl))));
+        }
+
+        RAINY_NODISCARD std::uint32_t count_leading_empty_or_deleted() const noexcept {
+            const __m256i special = _mm256_set1_epi8(static_cast<char>(ctrl_sentinel));
+            const auto mask = static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_cmpgt_epi8(special, ctrl)));
+            return static_cast<std::uint32_t>(trailing_zeros(static_cast<std::uint64_t>(mask) + 1));
+        }
+
+        __m256i ctrl;
+    };
+#elif RAINY_FLAT_HASH_GROUP_SSE2
+    struct group {
+        static constexpr std::size_t width = 16;
+
+        explicit group(const ctrl_t *pos) noexcept : ctrl(_mm_loadu_si128(reinterpret_cast<const __m128i *>(pos))) {
+        }
+
+        RAINY_NODISCARD bitmask<std::uint32_t, 16> match(const std::uint8_t h2) const noexcept {
+            const __m128i target = _mm_set1_epi8(static_cast<char>(h2));
+            return bitmask<std::uint32_t, 16>(static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(target, ctrl))));
+        }
+
+        RAINY_NODISCARD bitmask<std::uint32_t, 16> mask_empty() const noexcept {
+            const __m128i target = _mm_set1_epi8(static_cast<char>(ctrl_empty));
+            return bitmask<std::uint32_t, 16>(static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(target, ctrl))));
+        }
+
+        RAINY_NODISCARD bitmask<std::uint32_t, 16> mask_empty_or_deleted() const noexcept {
+            const __m128i special = _mm_set1_epi8(static_cast<char>(ctrl_sentinel));
+            return bitmask<std::uint32_t, 16>(static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpgt_epi8(special, ctrl))));
+        }
+
+        RAINY_NODISCARD std::uint32_t count_leading_empty_or_deleted() const noexcept {
+            const __m128i special = _mm_set1_epi8(static_cast<char>(ctrl_sentinel));
+            const auto mask = static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpgt_epi8(special, ctrl)));
+            return static_cast<std::uint32_t>(trailing_zeros(mask + 1));
+        }
+
+        __m128i ctrl;
+    };
+#else
+    /**
+     * @brief 无 SIMD 时的回退实现：把 8 个控制字装入一个 64 位整数，用位运算并行比较（假定小端序）
+     */
+    struct group {
+        static constexpr std::size_t width = 8;
+
+        static constexpr std::uint64_t msbs = 0x8080808080808080ULL;
+        static constexpr std::uint64_t lsbs = 0x0101010101010101ULL;
+
+        explicit group(const ctrl_t *pos) noexcept {
+            std::memcpy(&ctrl, pos, sizeof(ctrl));
+        }
+
+        /*
+         * 可能产生假阳性（紧跟在真实命中之后、值为 h2 ^ 1 的槽位），由于该槽位同样是已占用状态，由 key_equal 再次确认即可
+         */
+        RAINY_NODISCARD bitmask<std::uint64_t, 8, 3> match(const std::uint8_t h2) const noexcept {
+            const std::uint64_t x = ctrl ^ (lsbs * h2);
+            return bitmask<std::uint64_t, 8, 3>((x - lsbs) & ~x & msbs);
+        }
+
+        RAINY_NODISCARD bitmask<std::uint64_t, 8, 3> mask_empty() const noexcept {
+            return bitmask<std::uint64_t, 8, 3>((ctrl & (~ctrl << 6)) & msbs);
+        }
+
+        RAINY_NODISCARD bitmask<std::uint64_t, 8, 3> mask_empty_or_deleted() const noexcept {
+            return bitmask<std::uint64_t, 8, 3>((ctrl & (~ctrl << 7)) & msbs);
+        }
+
+        RAINY_NODISCARD std::uint32_t count_leading_empty_or_deleted() const noexcept {
+            constexpr std::uint64_t gaps = 0x00FEFEFEFEFEFEFEULL;
+            return static_cast<std::uint32_t>((trailing_zeros(((~ctrl & (ctrl >> 7)) | gaps) + 1) + 7) >> 3);
+        }
+
+        std::uint64_t ctrl;
+    };
+#endif
+
+    /**
+     * @brief 容量为 0 的表共享的控制字，使默认构造不分配内存，查找时也无需特判
+     */
+    alignas(32) inline constexpr ctrl_t empty_group[32] = {
+        ctrl_sentinel, ctrl_empty, ctrl_empty, ctrl_empty, ctrl_empty, ctrl_empty, ctrl_empty, ctrl_empty,
+        ctrl_empty,    ctrl_empty, ctrl_empty, ctrl_empty, ctrl_empty, ctrl_empty, ctrl_empty, ctrl_empty,
+        ctrl_empty,    ctrl_empty, ctrl_empty, ctrl_empty, ctrl_empty, ctrl_empty, ctrl_empty, ctrl_empty,
+        ctrl_empty,    ctrl_empty, ctrl_empty, ctrl_empty, ctrl_empty, ctrl_empty, ctrl_empty, ctrl_empty};
+
+    /**
+     * @brief 以组为步长的三角探测序列，容量为 2^k - 1 时可遍历全部组
+     */
+    class probe_seq {
+    public:
+        probe_seq(const std::size_t hash, const std::size_t mask) noexcept : mask_(mask), offset_(hash & mask) {
+        }
+
+        RAINY_NODISCARD std::size_t offset() const noexcept {
+            return offset_;
+        }
+
+        RAINY_NODISCARD std::size_t offset(const std::size_t i) const noexcept {
+            return (offset_ + i) & mask_;
+        }
+
+        void next() noexcept {
+            index_ += group::width;
+            offset_ += index_;
+            offset_ &= mask_;
+        }
+
+    private:
+        std::size_t mask_;
+        std::size_t offset_;
+        std::size_t index_{0};
+    };
+
+    /**
+     * @brief 对用户哈希值再做一次混合，使 H1 与 H2 都依赖于完整的哈希值（例如恒等哈希的整数）
+     */
+    RAINY_NODISCARD inline std::size_t mix_hash(std::size_t hash) noexcept {
+#if RAINY_USING_64_BIT_PLATFORM
+        hash ^= hash >> 32;
+        hash *= 0x9E3779B97F4A7C15ULL;
+        hash ^= hash >> 32;
+#else
+        hash ^= hash >> 16;
+        hash *= 0x9E3779B9U;
+        hash ^= hash >> 16;
+#endif
+        return hash;
+    }
+
+    RAINY_NODISCARD inline std::size_t h1(const std::size_t hash) noexcept {
+        return hash >> 7;
+    }
+
+    RAINY_NODISCARD inline ctrl_t h2(const std::size_t hash) noexcept {
+        return static_cast<ctrl_t>(hash & 0x7F);
+    }
+
+    RAINY_NODISCARD inline std::size_t normalize_capacity(const std::size_t n) noexcept {
+        if (n == 0) {
+            return 1;
+        }
+        constexpr int extra_bits = 64 - static_cast<int>(sizeof(std::size_t) * 8);
+        return ~std::size_t{} >> (leading_zeros(static_cast<std::uint64_t>(n)) - extra_bits);
+    }
+
+    /**
+     * @brief 最大负载因子为 7/8
+     */
+    RAINY_NODISCARD inline std::size_t capacity_to_growth(const std::size_t capacity) noexcept {
+        if (group::width == 8 && capacity == 7) {
+            return 6;
+        }
+        return capacity - capacity / 8;
+    }
+
+    RAINY_NODISCARD inline std::size_t growth_to_lowerbound_capacity(const std::size_t growth) noexcept {
+        if (group::width == 8 && growth == 7) {
+            return 8;
+        }
+        return growth + static_cast<std::size_t>((static_cast<std::int64_t>(growth) - 1) / 7);
+    }
+
+    template <std::size_t Align>
+    struct alignas(Align) storage_unit {
+        unsigned char bytes[Align];
+    };
+
+    /**
+     * @brief 查找类接口的键参数类型选择器
+     *
+     * 以成员别名模板的形式给出，使透明情形下的 key_arg<Kty> 直接展开为 Kty，从而可以由实参推导
+     */
+    template <bool Transparent>
+    struct key_arg_selector {
+        template <typename Kty, typename Key>
+        using type = Kty;
+    };
+
+    template <>
+    struct key_arg_selector<false> {
+        template <typename Kty, typename Key>
+        using type = Key;
+    };
+
+    template <typename Policy, bool Const>
+    class raw_hash_iterator {
+        template <typename, typename, typename, typename>
+        friend class raw_hash_set;
+
+        template <typename, bool>
+        friend class raw_hash_iterator;
+
+        using slot_type = typename Policy::slot_type;
+
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = typename Policy::value_type;
+        using reference = type_traits::other_trans::conditional_t<Const || Policy::constant_iterators, const value_type &, value_type &>;
+        using pointer = type_traits::other_trans::conditional_t<Const || Policy::constant_iterators, const value_type *, value_type *>;
+        using difference_type = std::ptrdiff_t;
+
+        raw_hash_iterator() noexcept = default;
+
+        template <bool OtherConst, type_traits::other_trans::enable_if_t<Const && !OtherConst, int> = 0>
+        raw_hash_iterator(const raw_hash_iterator<Policy, OtherConst> &other) noexcept : ctrl_(other.ctrl_), slot_(other.slot_) { // NOLINT
+        }
+
+        reference operator*() const noexcept {
+            return Policy::element(slot_);
+        }
+
+        pointer operator->() const noexcept {
+            return &Policy::element(slot_);
+        }
+
+        raw_hash_iterator &operator++() noexcept {
+            ++ctrl_;
+            ++slot_;
+            skip_empty_or_deleted();
+            return *this;
+        }
+
+        raw_hash_iterator operator++(int) noexcept {
+            raw_hash_iterator tmp = *this;
+            ++*this;
+            return tmp;
+        }
+
+        friend bool operator==(const raw_hash_iterator &left, const raw_hash_iterator &right) noexcept {
+            return left.ctrl_ == right.ctrl_;
+        }
+
+        friend bool operator!=(const raw_hash_iterator &left, const raw_hash_iterator &right) noexcept {
+            return left.ctrl_ != right.ctrl_;
+        }
+
+    private:
+        raw_hash_iterator(ctrl_t *ctrl, slot_type *slot) noexcept : ctrl_(ctrl), slot_(slot) {
+        }
+
+        void skip_empty_or_deleted() noexcept {
+            while (is_empty_or_deleted(*ctrl_)) {
+                const std::uint32_t shift = group{ctrl_}.count_leading_empty_or_deleted();
+                ctrl_ += shift;
+                slot_ += shift;
+            }
+            if (*ctrl_ == ctrl_sentinel) {
+                ctrl_ = nullptr;
+            }
+        }
+
+        ctrl_t *ctrl_{nullptr};
+        slot_type *slot_{nullptr};
+    };
+
+    /**
+     * @brief Swiss table 的公共实现
+     *
+     * Policy 描述槽位的存储方式：
+     *  - slot_type：槽位类型
+     *  - key_type / value_type：键类型与迭代器给出的元素类型
+     *  - construct / destroy / transfer：在槽位上构造、析构以及在扩容时搬移元素
+     *  - element / key：从槽位取得元素与键
+     */
+    template <typename Policy, typename Hash, typename KeyEqual, typename Allocator>
+    class raw_hash_set {
+    public:
+        using policy_type = Policy;
+        using slot_type = typename Policy::slot_type;
+        using key_type = typename Policy::key_type;
+        using value_type = typename Policy::value_type;
+        using size_type = std::size_t;
+        using difference_type = std::ptrdiff_t;
+        using hasher = Hash;
+        using key_equal = KeyEqual;
+        using allocator_type = Allocator;
+        using reference = value_type &;
+        using const_reference = const value_type &;
+        using alloc_traits = std::allocator_traits<Allocator>;
+        using pointer = typename alloc_traits::pointer;
+        using const_pointer = typename alloc_traits::const_pointer;
+        using iterator = raw_hash_iterator<Policy, false>;
+        using const_iterator = raw_hash_iterator<Policy, true>;
+
+    protected:
+        /*
+         * hasher 与 key_equal 均为透明类型时，查找类接口接受任意可比较的键，避免构造临时 key_type
+         */
+        template <typename Kty>
+        using key_arg = typename key_arg_selector<type_traits::type_properties::is_transparent_v<hasher> &&
+                                                  type_traits::type_properties::is_transparent_v<key_equal>>::template type<Kty, key_type>;
+
+    private:
+        static constexpr std::size_t slot_align = alignof(slot_type) > alignof(std::size_t) ? alignof(slot_type) : alignof(std::size_t);
+
+        using unit_type = storage_unit<slot_align>;
+        using unit_allocator = typename alloc_traits::template rebind_alloc<unit_type>;
+        using unit_traits = std::allocator_traits<unit_allocator>;
+
+    public:
+        raw_hash_set() noexcept(type_traits::type_properties::is_nothrow_default_constructible_v<hasher> &&
+                                type_traits::type_properties::is_nothrow_default_constructible_v<key_equal> &&
+                                type_traits::type_properties::is_nothrow_default_constructible_v<allocator_type>) {
+        }
+
+        explicit raw_hash_set(const size_type bucket_count, const hasher &hash = hasher{}, const key_equal &equal = key_equal{},
+                              const allocator_type &allocator = allocator_type{}) :
+            tools_{equal, hash}, allocator_(allocator) {
+            if (bucket_count) {
+                resize(normalize_capacity(bucket_count));
+            }
+        }
+
+        raw_hash_set(const size_type bucket_count, const hasher &hash, const allocator_type &allocator) :
+            raw_hash_set(bucket_count, hash, key_equal{}, allocator) {
+        }
+
+        raw_hash_set(const size_type bucket_count, const allocator_type &allocator) :
+            raw_hash_set(bucket_count, hasher{}, key_equal{}, allocator) {
+        }
+
+        explicit raw_hash_set(const allocator_type &allocator) : raw_hash_set(0, hasher{}, key_equal{}, allocator) {
+        }
+
+        raw_hash_set(const raw_hash_set &right) :
+            raw_hash_set(right, alloc_traits::select_on_container_copy_construction(right.allocator_)) {
+        }
+
+        raw_hash_set(const raw_hash_set &right, const allocator_type &allocator) :
+            raw_hash_set(0, right.hash_function(), right.key_eq(), allocator) {
+            reserve(right.size());
+            for (const_iterator it = right.begin(); it != right.end(); ++it) {
+                const std::size_t hash = hash_of(Policy::key(it.slot_));
+                const std::size_t target = find_first_non_full(hash);
+                Policy::construct(allocator_, slots_ + target, Policy::element(it.slot_));
+                set_ctrl(target, h2(hash));
+                ++size_;
+                --growth_left_;
+            }
+        }
+
+        raw_hash_set(raw_hash_set &&right) noexcept :
+            ctrl_(right.ctrl_), slots_(right.slots_), size_(right.size_), capacity_(right.capacity_), growth_left_(right.growth_left_),
+            tools_(utility::move(right.tools_)), allocator_(utility::move(right.allocator_)) {
+            right.reset_to_empty();
+        }
+
+        raw_hash_set(raw_hash_set &&right, const allocator_type &allocator) : raw_hash_set(0, right.hash_function(), right.key_eq(), allocator) {
+            if (allocator_ == right.allocator_) {
+                swap_storage(right);
+            } else {
+                move_elements_from(right);
+            }
+        }
+
+        ~raw_hash_set() {
+            destroy_slots();
+        }
+
+        raw_hash_set &operator=(const raw_hash_set &right) {
+            if (this != &right) {
+                raw_hash_set tmp(right, alloc_traits::propagate_on_container_copy_assignment::value ? right.allocator_ : allocator_);
+                swap_impl(tmp);
+            }
+            return *this;
+        }
+
+        raw_hash_set &operator=(raw_hash_set &&right) noexcept(alloc_traits::propagate_on_container_move_assignment::value ||
+                                                                 alloc_traits::is_always_equal::value) {
+            if (this != &right) {
+                destroy_slots();
+                reset_to_empty();
+                tools_ = utility::move(right.tools_);
+                if constexpr (alloc_traits::propagate_on_container_move_assignment::value) {
+                    allocator_ = utility::move(right.allocator_);
+                    swap_storage(right);
+                } else if constexpr (alloc_traits::is_always_equal::value) {
+                    swap_storage(right);
+                } else if (allocator_ == right.allocator_) {
+                    swap_storage(right);
+                } else {
+                    // 分配器不传播且不相等时，right 的存储不能由 allocator_ 释放，只能逐个移动元素
+                    move_elements_from(right);
+                }
+            }
+            return *this;
+        }
+
+        RAINY_NODISCARD iterator begin() noexcept {
+            if (size_ == 0) {
+                return end();
+            }
+            iterator it{ctrl_, slots_};
+            it.skip_empty_or_deleted();
+            return it;
+        }
+
+        RAINY_NODISCARD iterator end() noexcept {
+            return {};
+        }
+
+        RAINY_NODISCARD const_iterator begin() const noexcept {
+            return const_cast<raw_hash_set *>(this)->begin();
+        }
+
+        RAINY_NODISCARD const_iterator end() const noexcept {
+            return {};
+        }
+
+        RAINY_NODISCARD const_iterator cbegin() const noexcept {
+            return begin();
+        }
+
+        RAINY_NODISCARD const_iterator cend() const noexcept {
+            return end();
+        }
+
+        RAINY_NODISCARD bool empty() const noexcept {
+            return size_ == 0;
+        }
+
+        RAINY_NODISCARD size_type size() const noexcept {
+            return size_;
+        }
+
+        RAINY_NODISCARD size_type capacity() const noexcept {
+            return capacity_;
+        }
+
+        RAINY_NODISCARD size_type max_size() const noexcept {
+            return (utility::numeric_limits<size_type>::max)() / sizeof(slot_type);
+        }
+
+        void clear() noexcept {
+            if (capacity_ == 0) {
+                return;
+            }
+            for (size_type i = 0; i != capacity_; ++i) {
+                if (is_full(ctrl_[i])) {
+                    Policy::destroy(allocator_, slots_ + i);
+                }
+            }
+            size_ = 0;
+            reset_ctrl();
+            growth_left_ = capacity_to_growth(capacity_);
+        }
+
+        /**
+         * @brief 以给定的键查找，不存在时以 args 在新槽位上构造元素；调用方需保证 args 构造出的元素的键与 keyval 相等
+         */
+        template <typename Kty = key_type, typename... Args>
+        utility::pair<iterator, bool> emplace_with_key(const key_arg<Kty> &keyval, Args &&...args) {
+            return emplace_at(keyval, utility::forward<Args>(args)...);
+        }
+
+        iterator erase(const_iterator pos) {
+            iterator it{pos.ctrl_, pos.slot_};
+            erase_at(it);
+            // 删除只会改写当前槽位的控制字，后继位置不受影响
+            ++it;
+            return it;
+        }
+
+        iterator erase(iterator pos) {
+            return erase(const_iterator{pos});
+        }
+
+        iterator erase(const_iterator first, const_iterator last) {
+            while (first != last) {
+                first = erase(first);
+            }
+            return iterator{last.ctrl_, last.slot_};
+        }
+
+        template <typename Kty = key_type>
+        size_type erase(const key_arg<Kty> &keyval) {
+            const auto it = find(keyval);
+            if (it == end()) {
+                return 0;
+            }
+            erase_at(it);
+            return 1;
+        }
+
+        void swap(raw_hash_set &right) noexcept {
+            swap_impl(right);
+        }
+
+        template <typename Kty = key_type>
+        RAINY_NODISCARD iterator find(const key_arg<Kty> &keyval) {
+            const std::size_t hash = hash_of(keyval);
+            probe_seq seq(h1(hash), capacity_);
+            const auto tag = static_cast<std::uint8_t>(h2(hash));
+            while (true) {
+                const group g{ctrl_ + seq.offset()};
+                for (const int i: g.match(tag)) {
+                    const std::size_t index = seq.offset(static_cast<std::size_t>(i));
+                    if (rainy_likely(tools_.get_first()(Policy::key(slots_ + index), keyval))) {
+                        return {ctrl_ + index, slots_ + index};
+                    }
+                }
+                if (rainy_likely(g.mask_empty())) {
+                    return end();
+                }
+                seq.next();
+            }
+        }
+
+        template <typename Kty = key_type>
+        RAINY_NODISCARD const_iterator find(const key_arg<Kty> &keyval) const {
+            return const_cast<raw_hash_set *>(this)->find(keyval);
+        }
+
+        template <typename Kty = key_type>
+        RAINY_NODISCARD size_type count(const key_arg<Kty> &keyval) const {
+            return find(keyval) == end() ? 0 : 1;
+        }
+
+        template <typename Kty = key_type>
+        RAINY_NODISCARD bool contains(const key_arg<Kty> &keyval) const {
+            return find(keyval) != end();
+        }
+
+        template <typename Kty = key_type>
+        RAINY_NODISCARD utility::pair<iterator, iterator> equal_range(const key_arg<Kty> &keyval) {
+            auto it = find(keyval);
+            if (it == end()) {
+                return {it, it};
+            }
+            auto next = it;
+            return {it, ++next};
+        }
+
+        template <typename Kty = key_type>
+        RAINY_NODISCARD utility::pair<const_iterator, const_iterator> equal_range(const key_arg<Kty> &keyval) const {
+            auto it = find(keyval);
+            if (it == end()) {
+                return {it, it};
+            }
+            auto next = it;
+            return {it, ++next};
+        }
+
+        /**
+         * @brief 与标准容器不同，桶即槽位，bucket_count 等于容量
+         */
+        RAINY_NODISCARD size_type bucket_count() const noexcept {
+            return capacity_;
+        }
+
+        RAINY_NODISCARD float load_factor() const noexcept {
+            return capacity_ ? static_cast<float>(size_) / static_cast<float>(capacity_) : 0.0f;
+        }
+
+        /**
+         * @brief 负载因子固定为 7/8，设置操作仅为兼容标准接口而保留
+         */
+        RAINY_NODISCARD float max_load_factor() const noexcept {
+            return 0.875f;
+        }
+
+        void max_load_factor(float) noexcept {
+        }
+
+        void rehash(const size_type count) {
+            if (count == 0 && capacity_ == 0) {
+                return;
+            }
+            if (count == 0 && size_ == 0) {
+                destroy_slots();
+                reset_to_empty();
+                return;
+            }
+            const size_type lower = normalize_capacity(growth_to_lowerbound_capacity(size_));
+            const size_type target = normalize_capacity(count > lower ? count : lower);
+            if (count == 0 || target > capacity_) {
+                resize(target);
+            }
+        }
+
+        void reserve(const size_type count) {
+            if (count > size_ + growth_left_) {
+                resize(normalize_capacity(growth_to_lowerbound_capacity(count)));
+            }
+        }
+
+        RAINY_NODISCARD hasher hash_function() const {
+            return tools_.get_second();
+        }
+
+        RAINY_NODISCARD key_equal key_eq() const {
+            return tools_.get_first();
+        }
+
+        RAINY_NODISCARD allocator_type get_allocator() const noexcept {
+            return allocator_;
+        }
+
+    protected:
+        template <typename Kty>
+        RAINY_NODISCARD std::size_t hash_of(const Kty &keyval) const {
+            return mix_hash(static_cast<std::size_t>(tools_.get_second()(keyval)));
+        }
+
+        /**
+         * @brief 查找键；不存在时预留一个已标记为占用的槽位，由调用方在其上构造元素
+         * @return 槽位下标以及是否为新预留的槽位
+         */
+        template <typename Kty>
+        utility::pair<std::size_t, bool> find_or_prepare_insert(const Kty &keyval) {
+            const std::size_t hash = hash_of(keyval);
+            probe_seq seq(h1(hash), capacity_);
+            const auto tag = static_cast<std::uint8_t>(h2(hash));
+            while (true) {
+                const group g{ctrl_ + seq.offset()};
+                for (const int i: g.match(tag)) {
+                    const std::size_t index = seq.offset(static_cast<std::size_t>(i));
+                    if (rainy_likely(tools_.get_first()(Policy::key(slots_ + index), keyval))) {
+                        return {index, false};
+                    }
+                }
+                if (rainy_likely(g.mask_empty())) {
+                    break;
+                }
+                seq.next();
+            }
+            return {prepare_insert(hash), true};
+        }
+
+        template <typename Kty, typename... Args>
+        utility::pair<iterator, bool> emplace_at(const Kty &keyval, Args &&...args) {
+            const auto res = find_or_prepare_insert(keyval);
+            if (res.second) {
+                try {
+                    Policy::construct(allocator_, slots_ + res.first, utility::forward<Args>(args)...);
+                } catch (...) {
+                    erase_meta_only(res.first);
+                    throw;
+                }
+            }
+            return {iterator{ctrl_ + res.first, slots_ + res.first}, res.second};
+        }
+
+    private:
+        RAINY_NODISCARD std::size_t find_first_non_full(const std::size_t hash) const noexcept {
+            probe_seq seq(h1(hash), capacity_);
+            while (true) {
+                const group g{ctrl_ + seq.offset()};
+                if (const auto mask = g.mask_empty_or_deleted()) {
+                    return seq.offset(static_cast<std::size_t>(mask.lowest_bit_set()));
+                }
+                seq.next();
+            }
+        }
+
+        std::size_t prepare_insert(const std::size_t hash) {
+            std::size_t target = find_first_non_full(hash);
+            if (rainy_unlikely(growth_left_ == 0 && ctrl_[target] != ctrl_deleted)) {
+                rehash_and_grow_if_necessary();
+                target = find_first_non_full(hash);
+            }
+            ++size_;
+            growth_left_ -= is_empty(ctrl_[target]) ? 1 : 0;
+            set_ctrl(target, h2(hash));
+            return target;
+        }
+
+        void rehash_and_grow_if_necessary() {
+            if (capacity_ == 0) {
+                resize(1);
+            } else if (capacity_ > group::width && size_ * 32 <= capacity_ * 25) {
+                // 删除标记过多：原容量重建即可回收墓碑，不必扩容
+                resize(capacity_);
+            } else {
+                resize(capacity_ * 2 + 1);
+            }
+        }
+
+        void set_ctrl(const std::size_t i, const ctrl_t h) noexcept {
+            ctrl_[i] = h;
+            ctrl_[((i - (group::width - 1)) & capacity_) + ((group::width - 1) & capacity_)] = h;
+        }
+
+        void erase_at(iterator it) noexcept {
+            Policy::destroy(allocator_, it.slot_);
+            erase_meta_only(static_cast<std::size_t>(it.ctrl_ - ctrl_));
+        }
+
+        /**
+         * @brief 若该槽位所在的窗口内从未满过，则任何探测序列都不会越过它，可以直接置空；否则留下墓碑
+         */
+        void erase_meta_only(const std::size_t index) noexcept {
+            --size_;
+            const std::size_t index_before = (index - group::width) & capacity_;
+            const auto empty_after = group{ctrl_ + index}.mask_empty();
+            const auto empty_before = group{ctrl_ + index_before}.mask_empty();
+            const bool was_never_full = empty_before && empty_after &&
+                                        static_cast<std::size_t>(empty_after.trailing_zeros() + empty_before.leading_zeros()) < group::width;
+            set_ctrl(index, was_never_full ? ctrl_t{ctrl_empty} : ctrl_t{ctrl_deleted});
+            growth_left_ += was_never_full ? 1 : 0;
+        }
+
+        static std::size_t ctrl_bytes(const std::size_t capacity) noexcept {
+            return capacity + group::width;
+        }
+
+        static std::size_t slot_offset(const std::size_t capacity) noexcept {
+            return (ctrl_bytes(capacity) + slot_align - 1) & ~(slot_align - 1);
+        }
+
+        static std::size_t alloc_units(const std::size_t capacity) noexcept {
+            return (slot_offset(capacity) + capacity * sizeof(slot_type) + slot_align - 1) / slot_align;
+        }
+
+        void reset_ctrl() noexcept {
+            std::memset(ctrl_, ctrl_empty, ctrl_bytes(capacity_));
+            ctrl_[capacity_] = ctrl_sentinel;
+        }
+
+        void initialize_slots(const std::size_t capacity) {
+            unit_allocator alloc(allocator_);
+            unit_type *mem = unit_traits::allocate(alloc, alloc_units(capacity));
+            ctrl_ = reinterpret_cast<ctrl_t *>(mem);
+            slots_ = reinterpret_cast<slot_type *>(reinterpret_cast<unsigned char *>(mem) + slot_offset(capacity));
+            capacity_ = capacity;
+            reset_ctrl();
+            growth_left_ = capacity_to_growth(capacity_) - size_;
+        }
+
+        void deallocate(ctrl_t *ctrl, const std::size_t capacity) noexcept {
+            unit_allocator alloc(allocator_);
+            unit_traits::deallocate(alloc, reinterpret_cast<unit_type *>(ctrl), alloc_units(capacity));
+        }
+
+        void resize(const std::size_t new_capacity) {
+            ctrl_t *old_ctrl = ctrl_;
+            slot_type *old_slots = slots_;
+            const std::size_t old_capacity = capacity_;
+            initialize_slots(new_capacity);
+            for (std::size_t i = 0; i != old_capacity; ++i) {
+                if (is_full(old_ctrl[i])) {
+                    const std::size_t hash = hash_of(Policy::key(old_slots + i));
+                    const std::size_t target = find_first_non_full(hash);
+                    set_ctrl(target, h2(hash));
+                    Policy::transfer(allocator_, slots_ + target, old_slots + i);
+                }
+            }
+            if (old_capacity) {
+                deallocate(old_ctrl, old_capacity);
+            }
+        }
+
+        void destroy_slots() noexcept {
+            if (capacity_ == 0) {
+                return;
+            }
+            for (std::size_t i = 0; i != capacity_; ++i) {
+                if (is_full(ctrl_[i])) {
+                    Policy::destroy(allocator_, slots_ + i);
+                }
+            }
+            deallocate(ctrl_, capacity_);
+        }
+
+        void reset_to_empty() noexcept {
+            ctrl_ = const_cast<ctrl_t *>(empty_group);
+            slots_ = nullptr;
+            size_ = 0;
+            capacity_ = 0;
+            growth_left_ = 0;
+        }
+
+        void swap_storage(raw_hash_set &right) noexcept {
+            using std::swap;
+            swap(ctrl_, right.ctrl_);
+            swap(slots_, right.slots_);
+            swap(size_, right.size_);
+            swap(capacity_, right.capacity_);
+            swap(growth_left_, right.growth_left_);
+        }
+
+        // 用 allocator_ 分配存储，逐个移动 right 的元素；right 保留其存储与已被移走的元素
+        void move_elements_from(raw_hash_set &right) {
+            reserve(right.size());
+            for (iterator it = right.begin(); it != right.end(); ++it) {
+                const std::size_t hash = hash_of(Policy::key(it.slot_));
+                const std::size_t target = find_first_non_full(hash);
+                Policy::construct(allocator_, slots_ + target, utility::move(Policy::mutable_element(it.slot_)));
+                set_ctrl(target, h2(hash));
+                ++size_;
+                --growth_left_;
+            }
+        }
+
+        void swap_impl(raw_hash_set &right) noexcept {
+            using std::swap;
+            swap_storage(right);
+            swap(tools_, right.tools_);
+            if constexpr (alloc_traits::propagate_on_container_swap::value) {
+                swap(allocator_, right.allocator_);
+            }
+        }
+
+        ctrl_t *ctrl_{const_cast<ctrl_t *>(empty_group)};
+        slot_type *slots_{nullptr};
+        size_type size_{0};
+        size_type capacity_{0};
+        size_type growth_left_{0};
+        utility::compressed_pair<key_equal, hasher> tools_;
+        allocator_type allocator_;
+    };
+
+    template <typename Policy, typename Hash, typename KeyEqual, typename Allocator>
+    bool operator==(const raw_hash_set<Policy, Hash, KeyEqual, Allocator> &left,
+                    const raw_hash_set<Policy, Hash, KeyEqual, Allocator> &right) {
+        if (left.size() != right.size()) {
+            return false;
+        }
+        for (const auto &elem: left) {
+            const auto it = right.find(Policy::key_of(elem));
+            if (it == right.end() || !Policy::equal_elements(*it, elem)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    template <typename Policy, typename Hash, typename KeyEqual, typename Allocator>
+    bool operator!=(const raw_hash_set<Policy, Hash, KeyEqual, Allocator> &left,
+                    const raw_hash_set<Policy, Hash, KeyEqual, Allocator> &right) {
+        return !(left == right);
+    }
+}
+
+#undef RAINY_FLAT_HASH_GROUP_AVX2
+#undef RAINY_FLAT_HASH_GROUP_SSE2
+
+#endif
@@ -0,0 +1,156 @@
+/*
+ * Copyright 2026 rainy-juzixiao
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef RAINY_COLLECTIONS_IMPLEMENTS_RING_BUFFER_HPP
+#define RAINY_COLLECTIONS_IMPLEMENTS_RING_BUFFER_HPP
+#include <cstddef>
+#include <new>
+#include <thread>
+#include <rainy/core/core.hpp>
+#include <rainy/foundation/concurrency/basic/parking.hpp>
+
+/*
+ * spsc_queue 与 mpmc_queue 共用的环形存储与阻塞等待。
+ *
+ * 槽位数量恒为 2 的幂，下标通过与掩码取得。Capacity 非 0 时槽位直接内嵌在队列对象中，
+ * 为 0 时在构造时按给定容量（向上取整到 2 的幂）分配。
+ */
+namespace rainy::collections::implements {
+    /**
+     * @brief 未构造元素的对齐存储
+     */
+    template <typename Ty>
+    struct ring_slot {
+        Ty *value() noexcept {
+            return std::launder(reinterpret_cast<Ty *>(storage));
+        }
+
+        alignas(Ty) unsigned char storage[sizeof(Ty)];
+    };
+
+    template <typename Cell, std::size_t Capacity>
+    class ring_cells {
+    public:
+        static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two no less than 2");
+
+        ring_cells() = default;
+
+        ring_cells(const ring_cells &) = delete;
+        ring_cells &operator=(const ring_cells &) = delete;
+
+        static constexpr std::size_t capacity() noexcept {
+            return Capacity;
+        }
+
+        static constexpr std::size_t mask() noexcept {
+            return Capacity - 1;
+        }
+
+        Cell &operator[](const std::size_t position) noexcept {
+            return cells_[position & mask()];
+        }
+
+    private:
+        Cell cells_[Capacity];
+    };
+
+    template <typename Cell>
+    class ring_cells<Cell, 0> {
+    public:
+        explicit ring_cells(const std::size_t capacity) :
+            mask_(core::builtin::next_power_of_two(capacity < 2 ? std::size_t{2} : capacity) - 1), cells_(new Cell[mask_ + 1]) {
+        }
+
+        ring_cells(const ring_cells &) = delete;
+        ring_cells &operator=(const ring_cells &) = delete;
+
+        ~ring_cells() {
+            delete[] cells_;
+        }
+
+        std::size_t capacity() const noexcept {
+            return mask_ + 1;
+        }
+
+        std::size_t mask() const noexcept {
+            return mask_;
+        }
+
+        Cell &operator[](const std::size_t position) noexcept {
+            return cells_[position & mask_];
+        }
+
+    private:
+        std::size_t mask_;
+        Cell *cells_;
+    };
+
+    /**
+     * @brief 队列满或空时的等待策略：先以 cpu_relax 短暂自旋，再让出若干次时间片，仍无进展才经 event_count 挂起
+     *
+     * 让出阶段使对端在同一核心上也能先处理完一批元素，避免每个元素都经历一次挂起与唤醒。
+     */
+    class ring_waiter {
+    public:
+        static constexpr std::size_t spin_limit = 64;
+        static constexpr std::size_t yield_limit = 16;
+
+        /**
+         * @brief 在队列状态发布之后调用
+         */
+        void notify() noexcept {
+            events_.notify_all();
+        }
+
+        /**
+         * @brief 反复调用 attempt 直到其返回 true，期间没有进展时阻塞
+         */
+        template <typename Attempt>
+        void wait_until(Attempt &&attempt) {
+            for (std::size_t i = 0; i < spin_limit; ++i) {
+                if (attempt()) {
+                    return;
+                }
+                foundation::concurrency::cpu_relax();
+            }
+            for (std::size_t i = 0; i < yield_limit; ++i) {
+                if (attempt()) {
+                    return;
+                }
+                std::this_thread::yield();
+            }
+            for (;;) {
+                const auto key = events_.prepare_wait();
+                bool done = false;
+                try {
+                    done = attempt();
+                } catch (...) {
+                    events_.cancel_wait();
+                    throw;
+                }
+                if (done) {
+                    events_.cancel_wait();
+                    return;
+                }
+                events_.commit_wait(key);
+            }
+        }
+
+    private:
+        foundation::concurrency::event_count events_;
+    };
+}
+
+#endif
@@ -2,6 +2,7 @@
 #define RAINY_IMPLEMENTS_HYBRID_JENOVA_IMPL_HPP
 #include <rainy/core/platform.hpp>
 #include <rainy/core/type_traits.hpp>
+#include <rainy/core/yesod/hash.hpp>
 #include <string>
 #include <string_view>
 
@@ -27,11 +28,8 @@ namespace rainy::core::implements {
     template <typename Elem, typename Traits, typename Alloc>
     struct constexpr_hash<std::basic_string<Elem, Traits, Alloc>> {
         constexpr std::size_t operator()(const std::basic_string<Elem, Traits, Alloc> &value, std::size_t seed = 0) const {
-            std::size_t hash_value = seed;
-            for (auto c: value) {
-                hash_value = (hash_value ^ static_cast<std::size_t>(c)) * 1099511628211U;
-            }
-            return hash_value;
+            return static_cast<std::size_t>(
+                rainy::utility::implements::rapidhash_chars(value.data(), value.size(), rainy::utility::implements::rapidhash_seed ^ seed));
         }
     };
 }
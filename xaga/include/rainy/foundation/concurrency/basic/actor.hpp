@@ -17,8 +17,8 @@
 #define RAINY_FOUNDATION_CONCURRENCY_ACTOR_HPP
 #include <functional>
 #include <rainy/foundation/functional/delegate.hpp>
-#include <rainy/foundation/concurrency/condition_variable.hpp>
 #include <rainy/foundation/concurrency/thread.hpp>
+#include <rainy/foundation/concurrency/basic/parking.hpp>
 #include <rainy/foundation/concurrency/basic/work_stealing_deque.hpp>
 #include <rainy/foundation/diagnostics/contract.hpp>
 #include <rainy/foundation/memory/nebula_ptr.hpp>
@@ -43,22 +43,91 @@ namespace rainy::foundation::concurrency {
             worker_thread_ = foundation::memory::make_nebula<thread>(thread::policy::auto_join, [this] { run_loop(); });
         }
 
+        /**
+         * @brief dedicated 模式下的工作线程，未启动时为空
+         */
+        thread *dedicated_thread() noexcept {
+            return worker_thread_.get();
+        }
+
         void set_peers(std::vector<actor_worker *> peers) {
             peers_ = utility::move(peers);
         }
 
+        /**
+         * @brief 指定空闲时挂起所用的 parker
+         *
+         * 多个线程共同服务一组 actor 时（pooled/priority），由 pool 层让它们共享同一个 parker，
+         * 这样 submit 唤醒的是任意一个空闲线程；不设置时使用 actor 自带的 parker。
+         */
+        void set_parker(idle_parker *parker) noexcept {
+            parker_ = parker ? parker : &own_parker_;
+        }
+
+        idle_parker &parker() noexcept {
+            return *parker_;
+        }
+
         // 注入完成回调（pooled 模式由 pool 层设置）
         void set_on_complete(on_complete cb) {
             on_complete_ = utility::move(cb);
         }
 
+        /**
+         * @brief 提交任务
+         *
+         * 当前线程正持有本 actor 时（即任务内部派生子任务），直接压入本地队列的 bottom 端以保持 LIFO 局部性；
+         * 否则经注入栈交给下一次持有本 actor 的线程。
+         */
         void submit(task_type task) {
-            local_queue_.push(utility::move(task));
-            cv_.notify_one();
+            if (current_owner() == this) {
+                local_queue_.push(utility::move(task));
+                // 叫醒一个挂起的线程来窃取；notify_one 先以 seq_cst 栅栏与挂起方的登记配对，无人挂起时立即返回
+                parker_->notify_one();
+                return;
+            }
+            local_queue_.inject(utility::move(task));
+            parker_->notify_one();
         }
 
-        // 模式A 专用：外部线程驱动，执行一个任务
+        /**
+         * @brief 批量提交 [first, last)，注入栈上只发生一次 CAS，且只唤醒一个线程
+         * @return 提交的任务数
+         */
+        template <typename Iter>
+        std::size_t submit_bulk(Iter first, Iter last) {
+            const std::size_t count = local_queue_.inject_bulk(first, last);
+            if (count != 0) {
+                parker_->notify_one();
+            }
+            return count;
+        }
+
+        /**
+         * @brief 模式A 专用：外部线程驱动，执行一个任务
+         *
+         * 同一时刻只有一个线程能持有 actor 并以所有者身份操作本地队列；其余线程拿不到所有权时退化为窃取者，
+         * 从本地队列的 top 端偷取。持有者本地队列为空时从 peers 批量窃取一半任务。
+         * 持有者正忙于长任务时，注入栈中的任务由窃取者转交给一个空闲的 peer，以该 peer 所有者的身份执行。
+         */
         bool run_once() {
+            if (!try_acquire()) {
+                if (auto t = local_queue_.steal()) {
+                    execute(utility::move(*t));
+                    return true;
+                }
+                return adopt_injected();
+            }
+            owner_scope scope(this);
+            return run_owned_once();
+        }
+
+        /**
+         * @brief 以所有者身份执行一个任务，调用方必须已经持有本 actor（current() == this）
+         *
+         * 供 fork-join 的 join 在等待子任务期间“帮忙”执行：此时所在线程正持有 actor，再次调用 run_once 只会退化为窃取。
+         */
+        bool run_owned_once() {
             if (auto t = local_queue_.pop()) {
                 execute(utility::move(*t));
                 return true;
@@ -67,8 +136,34 @@ namespace rainy::foundation::concurrency {
                 if (peer == this) {
                     continue;
                 }
-                if (auto t = peer->local_queue_.steal()) {
-                    execute(utility::move(*t));
+                if (peer->local_queue_.steal_half(local_queue_) != 0 || peer->local_queue_.steal_injected(local_queue_) != 0) {
+                    if (auto t = local_queue_.pop()) {
+                        execute(utility::move(*t));
+                        return true;
+                    }
+                }
+            }
+            return false;
+        }
+
+        /**
+         * @brief 空闲线程此刻能取到的任务是否存在
+         *
+         * 环形缓冲区中的任务随时可窃取；注入栈中的任务在本 actor 无人持有时可直接接管，
+         * 被持有时则需要一个空闲的 peer 来承接（见 run_once）。供 pool 层在挂起前判断，避免空转。
+         */
+        RAINY_NODISCARD bool has_reachable_work() const noexcept {
+            if (local_queue_.stealable_size() != 0) {
+                return true;
+            }
+            if (local_queue_.injected_size() == 0) {
+                return false;
+            }
+            if (!owned_.load(memory_order_acquire)) {
+                return true;
+            }
+            for (const auto *peer: peers_) {
+                if (peer != this && !peer->owned_.load(memory_order_acquire)) {
                     return true;
                 }
             }
@@ -77,7 +172,14 @@ namespace rainy::foundation::concurrency {
 
         void signal_stop() {
             stop_.store(true, memory_order_release);
-            cv_.notify_all();
+            parker_->notify_all();
+        }
+
+        /**
+         * @brief 当前线程正持有的 actor，不在任何 actor 的任务中执行时为空
+         */
+        static actor_worker *current() noexcept {
+            return current_owner();
         }
 
         std::size_t id() const noexcept {
@@ -93,34 +195,63 @@ namespace rainy::foundation::concurrency {
         }
 
     private:
-        void run_loop() {
-            while (true) {
-                if (auto t = local_queue_.pop()) {
-                    execute(utility::move(*t));
+        // 持有 actor 期间把当前线程登记为其所有者，离开时归还
+        class owner_scope {
+        public:
+            explicit owner_scope(actor_worker *self) noexcept : self_(self), previous_(current_owner()) {
+                current_owner() = self;
+            }
+
+            ~owner_scope() {
+                current_owner() = previous_;
+                self_->owned_.store(false, memory_order_release);
+            }
+
+            owner_scope(const owner_scope &) = delete;
+            owner_scope &operator=(const owner_scope &) = delete;
+
+        private:
+            actor_worker *self_;
+            actor_worker *previous_;
+        };
+
+        bool try_acquire() noexcept {
+            bool expected = false;
+            return owned_.compare_exchange_strong(expected, true, memory_order_acquire, memory_order_relaxed);
+        }
+
+        // 持有者繁忙时把注入栈整批搬入第一个能持有的 peer，随后这些任务也可被其他线程从该 peer 窃取
+        bool adopt_injected() {
+            if (local_queue_.injected_size() == 0) {
+                return false;
+            }
+            for (auto *peer: peers_) {
+                if (peer == this || !peer->try_acquire()) {
                     continue;
                 }
-                bool stolen = false;
-                for (auto *peer: peers_) {
-                    if (peer == this) {
-                        continue;
-                    }
-                    if (auto t = peer->local_queue_.steal()) {
-                        execute(utility::move(*t));
-                        stolen = true;
-                        break;
-                    }
+                owner_scope scope(peer);
+                if (local_queue_.steal_injected(peer->local_queue_) == 0) {
+                    return false;
                 }
-                if (stolen) {
+                return peer->run_owned_once();
+            }
+            return false;
+        }
+
+        static actor_worker *&current_owner() noexcept {
+            thread_local actor_worker *owner = nullptr;
+            return owner;
+        }
+
+        void run_loop() {
+            while (true) {
+                if (run_once()) {
                     continue;
                 }
-                {
-                    unique_lock lk(cv_mutex_);
-                    cv_.wait_for(lk, std::chrono::microseconds(100),
-                                 [this] { return !local_queue_.empty() || stop_.load(memory_order_acquire); });
-                }
                 if (stop_.load(memory_order_acquire) && local_queue_.empty()) {
                     break;
                 }
+                parker_->idle([this] { return !local_queue_.empty() || stop_.load(memory_order_acquire); });
             }
         }
 
@@ -134,12 +265,13 @@ namespace rainy::foundation::concurrency {
 
         std::size_t id_;
         atomic<bool> stop_;
+        atomic<bool> owned_{false};
         work_stealing_deque local_queue_;
         std::vector<actor_worker *> peers_;
         on_complete on_complete_;
 
-        mutex cv_mutex_;
-        condition_variable cv_;
+        idle_parker own_parker_;
+        idle_parker *parker_{&own_parker_};
         memory::nebula_ptr<thread> worker_thread_;
     };
 }
@@ -65,8 +65,16 @@ namespace rainy::foundation::concurrency::implements {
             };
         };
 
+        struct shared_state_tag {
+            enum {
+                cache_size = RAINY_RECYCLING_ALLOCATOR_CACHE_SIZE,
+                begin_mem_index = parallel_group_tag::end_mem_index,
+                end_mem_index = begin_mem_index + cache_size
+            };
+        };
+
         enum {
-            max_mem_index = parallel_group_tag::end_mem_index
+            max_mem_index = shared_state_tag::end_mem_index
         };
 
         thread_info_base();
@@ -217,6 +225,13 @@ namespace rainy::foundation::concurrency {
         using thread_call_stack = implements::call_stack<thread_context, implements::thread_info_base>;
 
         static implements::thread_info_base *top_of_thread_call_stack();
+
+        /**
+         * @brief 调用线程的回收缓存：调用栈上有 thread_info_base 时取栈顶，否则使用线程自带的一份
+         *
+         * 线程退出、自带缓存已析构后返回 nullptr，此时 recycling_allocator 直接走 pal 分配。
+         */
+        static implements::thread_info_base *current_thread_info() noexcept;
     };
 }
 
@@ -0,0 +1,177 @@
+/*
+ * Copyright 2026 rainy-juzixiao
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef RAINY_FOUNDATION_CONCURRENCY_FORK_JOIN_HPP
+#define RAINY_FOUNDATION_CONCURRENCY_FORK_JOIN_HPP
+#include <exception>
+#include <thread>
+#include <rainy/core/core.hpp>
+#include <rainy/foundation/concurrency/atomic.hpp>
+#include <rainy/foundation/concurrency/basic/parking.hpp>
+#include <rainy/foundation/concurrency/pool.hpp>
+
+namespace rainy::foundation::concurrency {
+    /**
+     * @brief 进程内共享的 pooled_actor_pool，线程数为 hardware_concurrency，首次调用时创建
+     *
+     * 并行算法默认在此 pool 上运行，避免每次调用都创建线程。
+     */
+    inline pooled_actor_pool &shared_pooled_pool() {
+        static pooled_actor_pool pool;
+        return pool;
+    }
+
+    /**
+     * @brief fork-join 任务组
+     *
+     * fork 派生的子任务经 submit_local 压入当前 actor 的本地队列；join 期间调用线程不挂起，而是反复 help_once
+     * 执行本地或窃取来的任务，因此在工作线程内部嵌套 fork/join 不会耗尽线程。
+     * 子任务抛出的第一个异常在 join 时重新抛出，其余异常被丢弃。析构时等待全部子任务结束但不抛出。
+     */
+    class fork_join_group {
+    public:
+        explicit fork_join_group(pooled_actor_pool &pool = shared_pooled_pool()) noexcept : pool_(&pool) {
+        }
+
+        ~fork_join_group() {
+            wait();
+        }
+
+        fork_join_group(const fork_join_group &) = delete;
+        fork_join_group &operator=(const fork_join_group &) = delete;
+
+        /**
+         * @brief 派生子任务，fn 及其引用的对象必须存活到 join 返回
+         */
+        template <typename Fx>
+        void fork(Fx &&fn) {
+            pending_.fetch_add(1, memory_order_relaxed);
+            pool_->submit_local([this, fn = utility::forward<Fx>(fn)]() mutable {
+                try {
+                    fn();
+                } catch (...) {
+                    capture(std::current_exception());
+                }
+                pending_.fetch_sub(1, memory_order_release);
+            });
+        }
+
+        /**
+         * @brief 等待全部子任务完成，有子任务抛出异常时重新抛出
+         */
+        void join() {
+            wait();
+            if (failed_.load(memory_order_acquire)) {
+                std::exception_ptr error = utility::move(error_);
+                error_ = nullptr;
+                failed_.store(false, memory_order_relaxed);
+                std::rethrow_exception(error);
+            }
+        }
+
+        RAINY_NODISCARD pooled_actor_pool &pool() const noexcept {
+            return *pool_;
+        }
+
+    private:
+        static constexpr std::size_t spin_limit = 64;
+
+        void wait() {
+            std::size_t idle = 0;
+            while (pending_.load(memory_order_acquire) != 0) {
+                if (pool_->help_once()) {
+                    idle = 0;
+                } else if (++idle < spin_limit) {
+                    cpu_relax();
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+        }
+
+        void capture(std::exception_ptr error) noexcept {
+            bool expected = false;
+            if (first_error_.compare_exchange_strong(expected, true, memory_order_acq_rel, memory_order_relaxed)) {
+                error_ = utility::move(error);
+                failed_.store(true, memory_order_release);
+            }
+        }
+
+        pooled_actor_pool *pool_;
+        atomic<std::size_t> pending_{0};
+        atomic<bool> first_error_{false};
+        atomic<bool> failed_{false};
+        std::exception_ptr error_;
+    };
+
+    /**
+     * @brief 在 fork_join_group 的 pool 上并发执行 left 与 right，right 被派生，left 在调用线程执行
+     */
+    template <typename Left, typename Right>
+    void parallel_invoke(pooled_actor_pool &pool, Left &&left, Right &&right) {
+        fork_join_group group(pool);
+        group.fork(utility::forward<Right>(right));
+        left();
+        group.join();
+    }
+
+    /**
+     * @brief 为 count 个元素挑选默认粒度：约为每个工作线程 8 段，且每段不少于 min_grain 个元素
+     */
+    RAINY_INLINE std::size_t default_grain(const std::size_t count, const std::size_t concurrency,
+                                           const std::size_t min_grain = 2048) noexcept {
+        const std::size_t parts = (core::max) (concurrency, std::size_t{1}) * 8;
+        return (core::max) ((count + parts - 1) / parts, min_grain);
+    }
+
+    /**
+     * @brief 把 [first, last) 递归二分直到每段不超过 grain，对每段调用 body(begin, end)
+     *
+     * 每次二分派生右半段、就地继续处理左半段，空闲线程从 top 端窃取的总是尚未拆分的较大区间。
+     * 区间不超过 grain 时直接在调用线程执行，不触碰 pool。
+     */
+    template <typename Body>
+    void parallel_for(pooled_actor_pool &pool, const std::size_t first, const std::size_t last, std::size_t grain, Body &&body) {
+        if (last <= first) {
+            return;
+        }
+        grain = (core::max) (grain, std::size_t{1});
+        if (last - first <= grain) {
+            body(first, last);
+            return;
+        }
+        fork_join_group group(pool);
+        struct splitter {
+            void operator()(std::size_t begin, std::size_t end) const {
+                while (end - begin > grain) {
+                    const std::size_t mid = begin + (end - begin) / 2;
+                    const splitter *self = this;
+                    group->fork([self, mid, end] { (*self)(mid, end); });
+                    end = mid;
+                }
+                (*body)(begin, end);
+            }
+
+            fork_join_group *group;
+            type_traits::reference_modify::remove_reference_t<Body> *body;
+            std::size_t grain;
+        };
+        const splitter split{&group, utility::addressof(body), grain};
+        split(first, last);
+        group.join();
+    }
+}
+
+#endif
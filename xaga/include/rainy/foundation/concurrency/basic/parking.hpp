@@ -0,0 +1,184 @@
+/*
+ * Copyright 2026 rainy-juzixiao
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef RAINY_FOUNDATION_CONCURRENCY_PARKING_HPP
+#define RAINY_FOUNDATION_CONCURRENCY_PARKING_HPP
+#include <cstdint>
+#include <rainy/core/core.hpp>
+#include <rainy/foundation/concurrency/atomic.hpp>
+
+#if RAINY_USING_MSVC
+#include <intrin.h>
+#endif
+
+namespace rainy::foundation::concurrency {
+    /**
+     * @brief 自旋等待时提示 CPU 当前处于忙等，降低功耗并让出超线程资源
+     */
+    RAINY_INLINE void cpu_relax() noexcept {
+#if RAINY_IS_X86_PLATFORM
+#if RAINY_USING_MSVC
+        _mm_pause();
+#else
+        __builtin_ia32_pause();
+#endif
+#elif RAINY_USING_MSVC
+        __yield();
+#else
+        __asm__ __volatile__("yield");
+#endif
+    }
+
+    /**
+     * @brief 事件计数器（eventcount）
+     *
+     * 等待方按 prepare_wait → 重新检查条件 → commit_wait / cancel_wait 的顺序使用，通知方在发布条件之后调用 notify_*。
+     * 等待方登记与通知方读取登记数之间由 seq_cst 保证互见，因此通知不会丢失；没有等待者时 notify 只是一次原子读取。
+     * 挂起使用 atomic::wait（Linux 为 futex，Windows 为 WaitOnAddress）。
+     */
+    class event_count {
+    public:
+        using key_type = std::uint32_t;
+
+        event_count() noexcept = default;
+
+        event_count(const event_count &) = delete;
+        event_count &operator=(const event_count &) = delete;
+
+        /**
+         * @brief 登记为等待者，返回当前纪元，之后必须调用 commit_wait 或 cancel_wait 之一
+         */
+        key_type prepare_wait() noexcept {
+            waiters_.fetch_add(1, memory_order_seq_cst);
+            return epoch_.load(memory_order_seq_cst);
+        }
+
+        /**
+         * @brief 条件已满足，撤销登记
+         */
+        void cancel_wait() noexcept {
+            waiters_.fetch_sub(1, memory_order_relaxed);
+        }
+
+        /**
+         * @brief 挂起直到纪元自 prepare_wait 以来发生变化
+         */
+        void commit_wait(const key_type key) noexcept {
+            while (epoch_.load(memory_order_acquire) == key) {
+                epoch_.wait(key, memory_order_acquire);
+            }
+            waiters_.fetch_sub(1, memory_order_relaxed);
+        }
+
+        /**
+         * @brief 唤醒至多一个挂起的等待者
+         */
+        void notify_one() noexcept {
+            concurrency::atomic_thread_fence(memory_order_seq_cst);
+            if (waiters_.load(memory_order_relaxed) == 0) {
+                return;
+            }
+            epoch_.fetch_add(1, memory_order_seq_cst);
+            epoch_.notify_one();
+        }
+
+        /**
+         * @brief 唤醒全部挂起的等待者
+         */
+        void notify_all() noexcept {
+            concurrency::atomic_thread_fence(memory_order_seq_cst);
+            if (waiters_.load(memory_order_relaxed) == 0) {
+                return;
+            }
+            epoch_.fetch_add(1, memory_order_seq_cst);
+            epoch_.notify_all();
+        }
+
+        RAINY_NODISCARD std::uint32_t waiters() const noexcept {
+            return waiters_.load(memory_order_relaxed);
+        }
+
+    private:
+        atomic<std::uint32_t> epoch_{0};
+        atomic<std::uint32_t> waiters_{0};
+    };
+
+    /**
+     * @brief 空闲工作线程的“先自旋、后挂起”策略
+     *
+     * 线程找不到任务时调用 idle(ready)：先以 cpu_relax 自旋至多 spin_budget 轮检查 ready()，
+     * 仍为假则经 event_count 挂起，直到有提交方调用 notify_one/notify_all。
+     * spin_budget 为 0 时直接挂起，适合与其他服务共享 CPU 的部署。
+     */
+    class idle_parker {
+    public:
+        static constexpr std::size_t default_spin_budget = 128;
+
+        explicit idle_parker(const std::size_t spin_budget = default_spin_budget) noexcept : spin_budget_(spin_budget) {
+        }
+
+        idle_parker(const idle_parker &) = delete;
+        idle_parker &operator=(const idle_parker &) = delete;
+
+        /**
+         * @brief 等待 ready() 为真或被唤醒
+         * @param ready 检查是否有可执行的任务或需要退出，可能被并发调用多次，应当廉价且无副作用
+         * @return 挂起过则返回 true
+         */
+        template <typename Ready>
+        bool idle(Ready &&ready) {
+            const std::size_t budget = spin_budget_.load(memory_order_relaxed);
+            for (std::size_t i = 0; i < budget; ++i) {
+                if (ready()) {
+                    return false;
+                }
+                cpu_relax();
+            }
+            const event_count::key_type key = events_.prepare_wait();
+            if (ready()) {
+                events_.cancel_wait();
+                return false;
+            }
+            events_.commit_wait(key);
+            return true;
+        }
+
+        void notify_one() noexcept {
+            events_.notify_one();
+        }
+
+        void notify_all() noexcept {
+            events_.notify_all();
+        }
+
+        void set_spin_budget(const std::size_t spin_budget) noexcept {
+            spin_budget_.store(spin_budget, memory_order_relaxed);
+        }
+
+        RAINY_NODISCARD std::size_t spin_budget() const noexcept {
+            return spin_budget_.load(memory_order_relaxed);
+        }
+
+        RAINY_NODISCARD std::uint32_t parked() const noexcept {
+            return events_.waiters();
+        }
+
+    private:
+        event_count events_;
+        atomic<std::size_t> spin_budget_;
+    };
+}
+
+#endif
@@ -16,6 +16,7 @@
 #ifndef RAINY_FOUNDATION_CONCURRENCY_SCHEDULER_HPP
 #define RAINY_FOUNDATION_CONCURRENCY_SCHEDULER_HPP
 #include <functional>
+#include <vector>
 #include <rainy/core/core.hpp>
 #include <rainy/foundation/functional/delegate.hpp>
 
@@ -62,6 +63,8 @@ namespace rainy::foundation::concurrency {
 namespace rainy::foundation::concurrency {
     class task_scheduler {
     public:
+        static constexpr std::size_t bulk_chunk_size = 1024;
+
         virtual ~task_scheduler() = default;
 
         virtual void submit(functional::move_only_delegate<void()> task) = 0;
@@ -71,6 +74,67 @@ namespace rainy::foundation::concurrency {
             (void) priority;
         }
 
+        /**
+         * @brief 批量提交，tasks 中的任务会被移走
+         *
+         * 默认实现逐个调用 submit；多线程调度器应覆盖此函数，一次性预留计数、单趟分发到各 actor，
+         * 并且只唤醒与分发出的批次数量相当的线程。
+         */
+        virtual void submit_bulk(collections::views::array_view<functional::move_only_delegate<void()>> tasks) {
+            for (auto &task: tasks) {
+                submit(utility::move(task));
+            }
+        }
+
+        /**
+         * @brief 范围形式的批量提交，[first, last) 中的元素被移动构造为任务
+         *
+         * 每凑满 bulk_chunk_size 个任务调用一次 submit_bulk，适用于只能单趟遍历的输入迭代器。
+         */
+        template <typename InputIt>
+        void submit_bulk(InputIt first, InputIt last) {
+            std::vector<functional::move_only_delegate<void()>> chunk;
+            chunk.reserve(bulk_chunk_size);
+            for (; first != last; ++first) {
+                chunk.emplace_back(utility::move(*first));
+                if (chunk.size() == bulk_chunk_size) {
+                    submit_bulk(collections::views::array_view<functional::move_only_delegate<void()>>{chunk});
+                    chunk.clear();
+                }
+            }
+            if (!chunk.empty()) {
+                submit_bulk(collections::views::array_view<functional::move_only_delegate<void()>>{chunk});
+            }
+        }
+
+        /**
+         * @brief 生成器形式的批量提交，依次以 0 ~ count - 1 调用 make(i) 产生任务
+         */
+        template <typename Generator>
+        void submit_n(const std::size_t count, Generator &&make) {
+            std::vector<functional::move_only_delegate<void()>> chunk;
+            chunk.reserve((core::min) (count, bulk_chunk_size));
+            for (std::size_t i = 0; i < count; ++i) {
+                chunk.emplace_back(make(i));
+                if (chunk.size() == bulk_chunk_size) {
+                    submit_bulk(collections::views::array_view<functional::move_only_delegate<void()>>{chunk});
+                    chunk.clear();
+                }
+            }
+            if (!chunk.empty()) {
+                submit_bulk(collections::views::array_view<functional::move_only_delegate<void()>>{chunk});
+            }
+        }
+
+        /**
+         * @brief 就近提交：调用线程正在执行本调度器的任务时，优先放入该线程所持队列的本地端
+         *
+         * 用于任务内部派生后继（fork-join、任务图），减少跨线程注入与唤醒。默认实现等同 submit。
+         */
+        virtual void submit_local(functional::move_only_delegate<void()> task) {
+            submit(utility::move(task));
+        }
+
         virtual void submit_to(std::size_t actor_id, functional::move_only_delegate<void()> task) = 0;
 
         virtual void submit_to(const std::size_t actor_id, functional::move_only_delegate<void()> task,
@@ -82,6 +146,16 @@ namespace rainy::foundation::concurrency {
         virtual void wait_all() {
         }
 
+        /**
+         * @brief 在调用线程上执行至多一个任务，供在工作线程内等待其他任务的一方帮忙而不是阻塞
+         *
+         * 默认实现不执行任何任务；不覆盖此函数的调度器上，在工作线程内阻塞等待仍可能耗尽线程。
+         * @return 执行了任务则返回 true
+         */
+        virtual bool help_once() {
+            return false;
+        }
+
         RAINY_NODISCARD virtual bool stopped() const noexcept = 0;
         virtual void stop() = 0;
         virtual void join() = 0;
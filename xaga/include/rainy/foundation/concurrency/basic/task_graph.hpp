@@ -0,0 +1,294 @@
+/*
+ * Copyright 2026 rainy-juzixiao
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef RAINY_FOUNDATION_CONCURRENCY_TASK_GRAPH_HPP
+#define RAINY_FOUNDATION_CONCURRENCY_TASK_GRAPH_HPP
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <thread>
+#include <vector>
+#include <rainy/core/core.hpp>
+#include <rainy/foundation/concurrency/atomic.hpp>
+#include <rainy/foundation/concurrency/basic/actor.hpp>
+#include <rainy/foundation/concurrency/basic/parking.hpp>
+#include <rainy/foundation/concurrency/basic/scheduler.hpp>
+#include <rainy/foundation/diagnostics/contract.hpp>
+#include <rainy/foundation/functional/delegate.hpp>
+
+namespace rainy::foundation::concurrency {
+    /**
+     * @brief 任务图（DAG）
+     *
+     * 先以 emplace 添加节点、以 precede 声明边，再交给任意 task_scheduler 执行。每个节点持有一个原子的前驱计数，
+     * 完成最后一个前驱的线程把就绪的后继经 submit_local 压入自己的本地队列，其中第一个后继直接在当前线程继续执行。
+     * 执行期间不创建 shared_state、不加锁，派发给调度器的任务只捕获图指针与节点下标。
+     *
+     * 图可以反复运行：节点与边在两次运行之间保持不变，重新运行只重置计数，不重新分配内存。
+     * 同一时刻只能有一次运行；运行期间不得修改图。
+     */
+    class task_graph {
+    public:
+        using node_id = std::size_t;
+        using task_type = functional::move_only_delegate<void()>;
+
+        task_graph() = default;
+
+        ~task_graph() {
+            wait_done();
+        }
+
+        task_graph(const task_graph &) = delete;
+        task_graph &operator=(const task_graph &) = delete;
+
+        /**
+         * @brief 添加节点
+         * @return 节点下标，用于声明边
+         */
+        node_id emplace(task_type work) {
+            utility::expects(!running_, "task_graph cannot be modified while running");
+            nodes_.emplace_back(utility::move(work));
+            dirty_ = true;
+            return nodes_.size() - 1;
+        }
+
+        /**
+         * @brief 声明 before 完成后 after 才能开始
+         */
+        void precede(const node_id before, const node_id after) {
+            utility::expects(!running_, "task_graph cannot be modified while running");
+            utility::expects(before < nodes_.size() && after < nodes_.size() && before != after, "invalid task_graph edge");
+            nodes_[before].successors.push_back(after);
+            ++nodes_[after].predecessors;
+            dirty_ = true;
+        }
+
+        /**
+         * @brief 派发全部入度为 0 的节点后立即返回，之后必须调用 wait
+         *
+         * 某个根节点提交失败时，已派发的节点不再执行任务，等本次运行结束后抛出该异常，图随后可以再次运行。
+         */
+        void dispatch(task_scheduler &scheduler) {
+            utility::expects(!running_, "task_graph is already running");
+            prepare();
+            if (nodes_.empty()) {
+                return;
+            }
+            scheduler_ = &scheduler;
+            running_ = true;
+            first_error_.store(false, memory_order_relaxed);
+            failed_.store(false, memory_order_relaxed);
+            error_ = nullptr;
+            released_.store(false, memory_order_relaxed);
+            for (node &n: nodes_) {
+                n.pending.store(n.predecessors, memory_order_relaxed);
+            }
+            remaining_.store(static_cast<std::uint32_t>(nodes_.size()), memory_order_release);
+            std::size_t submitted = 0;
+            try {
+                for (; submitted < roots_.size(); ++submitted) {
+                    const node_id id = roots_[submitted];
+                    scheduler.submit([this, id] { execute(id); });
+                }
+            } catch (...) {
+                capture(std::current_exception());
+                for (; submitted < roots_.size(); ++submitted) {
+                    skip(roots_[submitted]);
+                }
+                wait();
+            }
+        }
+
+        /**
+         * @brief 等待本次运行结束，有节点抛出异常时重新抛出第一个
+         *
+         * 某个节点抛出异常后，尚未开始的节点不再执行其任务，但依赖计数照常传递，运行总会结束。
+         * 在调度器的工作线程内调用时不挂起，而是经 help_once 执行任务直到运行结束，因此可以在单线程 pool 的任务中运行子图；
+         * 调度器不支持 help_once 时（见 task_scheduler::help_once）由其余线程推进。
+         */
+        void wait() {
+            wait_done();
+            if (failed_.load(memory_order_acquire)) {
+                std::exception_ptr error = utility::move(error_);
+                error_ = nullptr;
+                failed_.store(false, memory_order_relaxed);
+                std::rethrow_exception(error);
+            }
+        }
+
+        /**
+         * @brief 在 scheduler 上运行整个图并等待结束
+         */
+        void run(task_scheduler &scheduler) {
+            dispatch(scheduler);
+            wait();
+        }
+
+        RAINY_NODISCARD std::size_t size() const noexcept {
+            return nodes_.size();
+        }
+
+        RAINY_NODISCARD bool empty() const noexcept {
+            return nodes_.empty();
+        }
+
+        void clear() {
+            utility::expects(!running_, "task_graph cannot be modified while running");
+            nodes_.clear();
+            roots_.clear();
+            dirty_ = false;
+        }
+
+    private:
+        static constexpr node_id no_node = static_cast<node_id>(-1);
+        static constexpr std::size_t spin_limit = 64;
+
+        struct node {
+            explicit node(task_type work) : work(utility::move(work)) {
+            }
+
+            task_type work;
+            std::vector<node_id> successors;
+            std::uint32_t predecessors{0};
+            atomic<std::uint32_t> pending{0};
+        };
+
+        // 结构变化后重新收集根节点，并确认图中没有环（否则运行永远不会结束）
+        void prepare() {
+            if (!dirty_) {
+                return;
+            }
+            roots_.clear();
+            std::vector<std::uint32_t> indegree(nodes_.size());
+            std::vector<node_id> order;
+            order.reserve(nodes_.size());
+            for (node_id id = 0; id < nodes_.size(); ++id) {
+                indegree[id] = nodes_[id].predecessors;
+                if (indegree[id] == 0) {
+                    roots_.push_back(id);
+                    order.push_back(id);
+                }
+            }
+            for (std::size_t i = 0; i < order.size(); ++i) {
+                for (const node_id next: nodes_[order[i]].successors) {
+                    if (--indegree[next] == 0) {
+                        order.push_back(next);
+                    }
+                }
+            }
+            utility::expects(order.size() == nodes_.size(), "task_graph contains a cycle");
+            dirty_ = false;
+        }
+
+        void execute(node_id id) {
+            while (true) {
+                node &n = nodes_[id];
+                if (!failed_.load(memory_order_relaxed)) {
+                    try {
+                        n.work();
+                    } catch (...) {
+                        capture(std::current_exception());
+                    }
+                }
+                // 第一个就绪的后继留在当前线程继续执行，其余压入本地队列供其他线程窃取
+                node_id next = no_node;
+                for (const node_id succ: n.successors) {
+                    if (nodes_[succ].pending.fetch_sub(1, memory_order_acq_rel) == 1) {
+                        if (next == no_node) {
+                            next = succ;
+                        } else {
+                            scheduler_->submit_local([this, succ] { execute(succ); });
+                        }
+                    }
+                }
+                finish_one();
+                if (next == no_node) {
+                    return;
+                }
+                id = next;
+            }
+        }
+
+        // 不执行任务，只传递依赖计数，用于未能派发的根节点
+        void skip(const node_id root) {
+            std::vector<node_id> ready{root};
+            while (!ready.empty()) {
+                const node_id id = ready.back();
+                ready.pop_back();
+                for (const node_id succ: nodes_[id].successors) {
+                    if (nodes_[succ].pending.fetch_sub(1, memory_order_acq_rel) == 1) {
+                        ready.push_back(succ);
+                    }
+                }
+                finish_one();
+            }
+        }
+
+        void finish_one() noexcept {
+            if (remaining_.fetch_sub(1, memory_order_acq_rel) == 1) {
+                remaining_.notify_all();
+                // 等待方必须看到此标记才能返回，保证最后一个线程离开 notify 之前图不会被销毁
+                released_.store(true, memory_order_release);
+            }
+        }
+
+        void wait_done() noexcept {
+            if (!running_) {
+                return;
+            }
+            if (actor_worker::current()) {
+                // 在工作线程内等待：挂起可能让后继无人执行（如 pinned pool 的单个线程），改为帮忙执行任务
+                std::size_t idle = 0;
+                while (remaining_.load(memory_order_acquire) != 0) {
+                    if (scheduler_->help_once()) {
+                        idle = 0;
+                    } else if (++idle < spin_limit) {
+                        cpu_relax();
+                    } else {
+                        std::this_thread::yield();
+                    }
+                }
+            }
+            for (std::uint32_t left = remaining_.load(memory_order_acquire); left != 0; left = remaining_.load(memory_order_acquire)) {
+                remaining_.wait(left, memory_order_acquire);
+            }
+            while (!released_.load(memory_order_acquire)) {
+                cpu_relax();
+            }
+            running_ = false;
+        }
+
+        void capture(std::exception_ptr error) noexcept {
+            bool expected = false;
+            if (first_error_.compare_exchange_strong(expected, true, memory_order_acq_rel, memory_order_relaxed)) {
+                error_ = utility::move(error);
+                failed_.store(true, memory_order_release);
+            }
+        }
+
+        std::deque<node> nodes_;
+        std::vector<node_id> roots_;
+        bool dirty_{false};
+        bool running_{false};
+        task_scheduler *scheduler_{nullptr};
+        atomic<std::uint32_t> remaining_{0};
+        atomic<bool> released_{false};
+        atomic<bool> first_error_{false};
+        atomic<bool> failed_{false};
+        std::exception_ptr error_;
+    };
+}
+
+#endif
@@ -0,0 +1,84 @@
+/*
+ * Copyright 2026 rainy-juzixiao
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef RAINY_FOUNDATION_CONCURRENCY_TOPOLOGY_HPP
+#define RAINY_FOUNDATION_CONCURRENCY_TOPOLOGY_HPP
+#include <string_view>
+#include <vector>
+#include <rainy/core/core.hpp>
+
+namespace rainy::foundation::concurrency {
+    /**
+     * @brief 一个 NUMA 节点及其包含的逻辑 CPU
+     */
+    struct numa_node {
+        std::size_t id{0};
+        std::vector<std::size_t> cpus;
+    };
+
+    /**
+     * @brief 处理器拓扑
+     *
+     * Linux 下从 /sys/devices/system/node/node<N>/cpulist 读取各节点的 CPU 列表；
+     * 其他平台或 sysfs 不可用时视为单个节点，包含 0 ~ hardware_concurrency - 1。
+     */
+    class RAINY_TOOLKIT_API cpu_topology {
+    public:
+        static constexpr std::size_t unknown_node = static_cast<std::size_t>(-1);
+
+        cpu_topology() = default;
+
+        explicit cpu_topology(std::vector<numa_node> nodes);
+
+        /**
+         * @brief 进程内缓存的当前机器拓扑，首次调用时探测
+         */
+        static const cpu_topology &current();
+
+        /**
+         * @brief 重新探测当前机器的拓扑
+         */
+        static cpu_topology discover();
+
+        /**
+         * @brief 解析内核 cpulist 格式，例如 "0-3,8,10-11"
+         * @return 升序的 CPU 编号，格式错误的片段被忽略
+         */
+        static std::vector<std::size_t> parse_cpu_list(std::string_view text);
+
+        RAINY_NODISCARD const std::vector<numa_node> &nodes() const noexcept {
+            return nodes_;
+        }
+
+        RAINY_NODISCARD std::size_t node_count() const noexcept {
+            return nodes_.size();
+        }
+
+        /**
+         * @brief 查询 CPU 所属节点的 id，找不到时返回 unknown_node
+         */
+        RAINY_NODISCARD std::size_t node_of(std::size_t cpu) const noexcept;
+
+        /**
+         * @brief 按节点顺序展开的全部 CPU，连续的工作线程因此会先填满同一节点
+         */
+        RAINY_NODISCARD std::vector<std::size_t> cpus() const;
+
+    private:
+        std::vector<numa_node> nodes_;
+    };
+}
+
+#endif
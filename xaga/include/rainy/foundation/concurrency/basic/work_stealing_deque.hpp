@@ -15,56 +15,323 @@
  */
 #ifndef RAINY_FOUNDATION_CONCURRENCY_WORK_STEALING_QUEUE_HPP
 #define RAINY_FOUNDATION_CONCURRENCY_WORK_STEALING_QUEUE_HPP
-#include <deque>
-#include <rainy/foundation/concurrency/mutex.hpp>
+#include <cstdint>
+#include <optional>
+#include <vector>
+#include <rainy/foundation/concurrency/atomic.hpp>
+#include <rainy/foundation/functional/delegate.hpp>
 
 namespace rainy::foundation::concurrency {
+    /**
+     * @brief Chase–Lev 工作窃取双端队列
+     *
+     * 环形缓冲区起始容量固定，写满时由所有者线程按两倍扩容。线程角色分为三类：
+     *   - 所有者：push/pop 在 bottom 端进行（LIFO），不加锁，只有取最后一个元素时才与窃取者 CAS 竞争
+     *   - 窃取者：steal/steal_half 在 top 端以 CAS 取走元素，失败即放弃，不会阻塞所有者
+     *   - 任意线程：inject 将任务压入一个无锁注入栈，由所有者在下一次 pop 时整批搬入队列，
+     *     所有者繁忙时也可由另一队列的所有者经 steal_injected 整批接管
+     *
+     * 槽中只存放节点指针，窃取者在 CAS 之前读到的指针即使作废也不会造成对任务对象的竞争访问。
+     * 扩容后旧缓冲区可能仍被窃取者读取，因此保留到析构时统一释放。
+     * size()/empty() 只是近似值，用于负载均衡的启发式判断。
+     */
     class work_stealing_deque {
     public:
         using task_type = functional::delegate<void()>;
 
+        static constexpr std::size_t default_capacity = 256;
+        static constexpr std::size_t max_steal_batch = 32;
+
+        explicit work_stealing_deque(const std::size_t capacity = default_capacity) {
+            std::size_t rounded = 2;
+            while (rounded < capacity) {
+                rounded <<= 1;
+            }
+            auto *initial = new ring(rounded);
+            rings_.push_back(initial);
+            ring_.store(initial, memory_order_relaxed);
+        }
+
+        ~work_stealing_deque() {
+            const std::int64_t t = top_.load(memory_order_relaxed);
+            const std::int64_t b = bottom_.load(memory_order_relaxed);
+            ring *current = ring_.load(memory_order_relaxed);
+            for (std::int64_t i = t; i < b; ++i) {
+                delete current->get(i);
+            }
+            for (node *n = injected_.exchange(nullptr, memory_order_acquire); n;) {
+                node *next = n->next;
+                delete n;
+                n = next;
+            }
+            for (ring *r: rings_) {
+                delete r;
+            }
+        }
+
+        work_stealing_deque(const work_stealing_deque &) = delete;
+        work_stealing_deque &operator=(const work_stealing_deque &) = delete;
+
+        /**
+         * @brief 所有者线程在 bottom 端压入任务
+         */
         void push(task_type task) {
-            lock_guard lk(mutex_);
-            deque_.push_back(std::move(task));
+            push_node(new node{utility::move(task), nullptr});
+        }
+
+        /**
+         * @brief 任意线程向注入栈压入任务，所有者下一次 pop 时才可见
+         */
+        void inject(task_type task) {
+            auto *n = new node{utility::move(task), nullptr};
+            injected_count_.fetch_add(1, memory_order_relaxed); // 先计数，drain 的减法不会越过零
+            node *head = injected_.load(memory_order_relaxed);
+            do {
+                n->next = head;
+            } while (!injected_.compare_exchange_weak(head, n, memory_order_release, memory_order_relaxed));
+        }
+
+        /**
+         * @brief 任意线程一次性注入 [first, last) 中的全部任务，只做一次 CAS
+         *
+         * 链表按从后到前的顺序串联，与逐个 inject 的结果相同，所有者仍按传入顺序取出。
+         * @return 注入的任务数
+         */
+        template <typename Iter>
+        std::size_t inject_bulk(Iter first, Iter last) {
+            node *head = nullptr;
+            node *tail = nullptr;
+            std::size_t count = 0;
+            for (; first != last; ++first) {
+                auto *n = new node{task_type{utility::move(*first)}, head};
+                if (!tail) {
+                    tail = n;
+                }
+                head = n;
+                ++count;
+            }
+            if (count == 0) {
+                return 0;
+            }
+            injected_count_.fetch_add(count, memory_order_relaxed);
+            node *expected = injected_.load(memory_order_relaxed);
+            do {
+                tail->next = expected;
+            } while (!injected_.compare_exchange_weak(expected, head, memory_order_release, memory_order_relaxed));
+            return count;
         }
 
+        /**
+         * @brief 所有者线程从 bottom 端取出最近压入的任务
+         *
+         * 先把注入栈整批搬入队列。注入栈头部是最新的任务，按此顺序压入后最早注入的任务位于 bottom 端，
+         * 因此外部提交的任务对所有者保持先来先服务，而所有者自己派生的子任务依旧是 LIFO。
+         */
         std::optional<task_type> pop() {
-            lock_guard lk(mutex_);
-            if (deque_.empty()) {
+            drain_injected();
+            node *n = take();
+            if (!n) {
                 return std::nullopt;
             }
-            auto task = std::move(deque_.front());
-            deque_.pop_front();
-            return task;
+            return release(n);
         }
 
+        /**
+         * @brief 任意线程从 top 端窃取一个任务，与其他线程竞争失败时返回空
+         */
         std::optional<task_type> steal() {
-            if (!mutex_.try_lock()) {
-                return std::nullopt; // 拿不到锁直接放弃，下次再试
-            }
-            lock_guard lk(mutex_, adopt_lock);
-            if (deque_.empty()) {
+            node *n = steal_node();
+            if (!n) {
                 return std::nullopt;
             }
-            auto task = std::move(deque_.back()); // 从 back 偷，与 pop 的 front 错开，减少竞争
-            deque_.pop_back();
-            return task;
+            return release(n);
+        }
+
+        /**
+         * @brief 从本队列窃取约一半的任务并压入 dest
+         *
+         * Chase–Lev 的所有者只在取最后一个元素时才参与 CAS，一次推进 top 多格会与所有者的 pop 重叠，
+         * 因此这里逐个 CAS，数量以开始时观察到的一半为上限（至多 max_steal_batch），任何一次失败即停止。
+         * @param dest 由调用线程持有的队列
+         * @return 实际搬运的任务数
+         */
+        std::size_t steal_half(work_stealing_deque &dest) {
+            const std::int64_t t = top_.load(memory_order_acquire);
+            const std::int64_t b = bottom_.load(memory_order_acquire);
+            if (t >= b) {
+                return 0;
+            }
+            std::size_t quota = static_cast<std::size_t>(b - t + 1) / 2;
+            if (quota > max_steal_batch) {
+                quota = max_steal_batch;
+            }
+            std::size_t moved = 0;
+            while (moved < quota) {
+                node *n = steal_node();
+                if (!n) {
+                    break;
+                }
+                dest.push_node(n);
+                ++moved;
+            }
+            return moved;
+        }
+
+        /**
+         * @brief 把注入栈中的任务整批搬入 dest，由 dest 的所有者调用
+         *
+         * 本队列的所有者正在执行长任务时，注入栈只能经此被其他线程接管。搬入顺序与 pop 时相同，
+         * 最早注入的任务位于 dest 的 bottom 端。
+         * @return 搬运的任务数
+         */
+        std::size_t steal_injected(work_stealing_deque &dest) {
+            if (!injected_.load(memory_order_relaxed)) {
+                return 0;
+            }
+            node *n = injected_.exchange(nullptr, memory_order_acquire);
+            std::size_t count = 0;
+            while (n) {
+                node *next = n->next;
+                dest.push_node(n);
+                n = next;
+                ++count;
+            }
+            injected_count_.fetch_sub(count, memory_order_relaxed);
+            return count;
+        }
+
+        RAINY_NODISCARD bool empty() const noexcept {
+            return size() == 0;
+        }
+
+        RAINY_NODISCARD std::size_t size() const noexcept {
+            return stealable_size() + injected_size();
         }
 
-        bool empty() const {
-            lock_guard lk(mutex_);
-            return deque_.empty();
+        /**
+         * @brief 已进入环形缓冲区、可被 steal 取走的任务数
+         */
+        RAINY_NODISCARD std::size_t stealable_size() const noexcept {
+            const std::int64_t b = bottom_.load(memory_order_relaxed);
+            const std::int64_t t = top_.load(memory_order_relaxed);
+            return b > t ? static_cast<std::size_t>(b - t) : 0;
         }
 
-        std::size_t size() const {
-            lock_guard lk(mutex_);
-            return deque_.size();
+        /**
+         * @brief 仍在注入栈中、只有持有所有权的线程才能取走的任务数
+         */
+        RAINY_NODISCARD std::size_t injected_size() const noexcept {
+            return injected_count_.load(memory_order_relaxed);
+        }
+
+        RAINY_NODISCARD std::size_t capacity() const noexcept {
+            return ring_.load(memory_order_relaxed)->capacity;
         }
 
     private:
-        mutable mutex mutex_;
-        std::deque<task_type> deque_;
+        struct node {
+            task_type task;
+            node *next;
+        };
+
+        struct ring {
+            explicit ring(const std::size_t cap) : capacity(cap), mask(cap - 1), slots(new atomic<node *>[cap]) {
+            }
+
+            ~ring() {
+                delete[] slots;
+            }
+
+            ring(const ring &) = delete;
+            ring &operator=(const ring &) = delete;
+
+            node *get(const std::int64_t index) const noexcept {
+                return slots[static_cast<std::size_t>(index) & mask].load(memory_order_relaxed);
+            }
+
+            void put(const std::int64_t index, node *value) noexcept {
+                slots[static_cast<std::size_t>(index) & mask].store(value, memory_order_relaxed);
+            }
+
+            std::size_t capacity;
+            std::size_t mask;
+            atomic<node *> *slots;
+        };
+
+        static task_type release(node *n) {
+            task_type task = utility::move(n->task);
+            delete n;
+            return task;
+        }
+
+        void push_node(node *n) {
+            const std::int64_t b = bottom_.load(memory_order_relaxed);
+            const std::int64_t t = top_.load(memory_order_acquire);
+            ring *current = ring_.load(memory_order_relaxed);
+            if (b - t >= static_cast<std::int64_t>(current->capacity)) {
+                current = grow(current, t, b);
+            }
+            current->put(b, n);
+            concurrency::atomic_thread_fence(memory_order_release);
+            bottom_.store(b + 1, memory_order_relaxed);
+        }
+
+        node *take() {
+            const std::int64_t b = bottom_.load(memory_order_relaxed) - 1;
+            ring *current = ring_.load(memory_order_relaxed);
+            bottom_.store(b, memory_order_relaxed);
+            concurrency::atomic_thread_fence(memory_order_seq_cst);
+            std::int64_t t = top_.load(memory_order_relaxed);
+            if (t > b) {
+                bottom_.store(b + 1, memory_order_relaxed);
+                return nullptr;
+            }
+            node *n = current->get(b);
+            if (t == b) {
+                // 最后一个元素，与窃取者竞争
+                if (!top_.compare_exchange_strong(t, t + 1, memory_order_seq_cst, memory_order_relaxed)) {
+                    n = nullptr;
+                }
+                bottom_.store(b + 1, memory_order_relaxed);
+            }
+            return n;
+        }
+
+        node *steal_node() {
+            std::int64_t t = top_.load(memory_order_acquire);
+            concurrency::atomic_thread_fence(memory_order_seq_cst);
+            const std::int64_t b = bottom_.load(memory_order_acquire);
+            if (t >= b) {
+                return nullptr;
+            }
+            node *n = ring_.load(memory_order_acquire)->get(t);
+            if (!top_.compare_exchange_strong(t, t + 1, memory_order_seq_cst, memory_order_relaxed)) {
+                return nullptr;
+            }
+            return n;
+        }
+
+        ring *grow(ring *old, const std::int64_t t, const std::int64_t b) {
+            auto *bigger = new ring(old->capacity * 2);
+            for (std::int64_t i = t; i < b; ++i) {
+                bigger->put(i, old->get(i));
+            }
+            rings_.push_back(bigger);
+            ring_.store(bigger, memory_order_release);
+            return bigger;
+        }
+
+        void drain_injected() {
+            steal_injected(*this);
+        }
+
+        alignas(64) atomic<std::int64_t> top_{0};
+        alignas(64) atomic<std::int64_t> bottom_{0};
+        atomic<ring *> ring_{nullptr};
+        std::vector<ring *> rings_; // 仅所有者修改，包含当前与已退役的缓冲区
+        alignas(64) atomic<node *> injected_{nullptr};
+        atomic<std::size_t> injected_count_{0};
     };
 }
 
-#endif
\ No newline at end of file
+#endif
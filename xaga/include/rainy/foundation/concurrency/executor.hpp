@@ -35,7 +35,7 @@ namespace rainy::foundation::concurrency {
 
         template <typename F, typename R = std::invoke_result_t<std::decay_t<F>>>
         monad_future<R> submit_to(const std::size_t actor_id, F &&f) {
-            auto state = std::make_shared<shared_state<R>>();
+            auto state = make_shared_state<R>();
             auto *sched = get_scheduler();
             auto fn = utility::forward<F>(f);
 
@@ -56,15 +56,19 @@
  */
 #ifndef RAINY_FOUNDATION_PAL_CONCURRENCY_FUTURE_HPP
 #define RAINY_FOUNDATION_PAL_CONCURRENCY_FUTURE_HPP
+#include <cstdint>
 #include <functional>
 #include <future>
 #include <memory>
+#include <rainy/foundation/concurrency/atomic.hpp>
 #include <rainy/foundation/concurrency/basic/scheduler.hpp>
 #include <rainy/foundation/concurrency/condition_variable.hpp>
 #include <rainy/foundation/concurrency/mutex.hpp>
 #include <rainy/foundation/functional/delegate.hpp>
 #include <rainy/foundation/memory/nebula_ptr.hpp>
+#include <rainy/foundation/memory/recycling_allocator.hpp>
 #include <variant>
+#include <vector>
 
 namespace rainy::foundation::concurrency {
     template <typename Ty>
@@ -111,444 +115,340 @@ namespace rainy::foundation::concurrency {
     };
 }
 
-namespace rainy::foundation::concurrency {
-    template <typename Ty>
-    class shared_state : public std::enable_shared_from_this<shared_state<Ty>> {
+namespace rainy::foundation::concurrency::implements {
+    /**
+     * @brief shared_state 的状态字与续体管理
+     *
+     * 状态字的低位为 pending/deferred/fulfilled/rejected，其余位为标记。写入结果、登记第一个续体、唤醒等待方均只做原子操作，
+     * 不加锁：第一个续体放在内联槽中，只有第二个及以后的续体才进入受 mutex 保护的溢出表。
+     * 无限期等待直接在状态字上 atomic::wait；限时等待较少见，退回 condition_variable。
+     */
+    class shared_state_base {
     public:
-        shared_state() : status_(status::pending) {
-        }
-
-        shared_state(const shared_state &) = delete;
-        shared_state &operator=(const shared_state &) = delete;
-
-        ~shared_state() {
-            std::vector<functional::delegate<void()>> to_drain;
-            {
-                lock_guard lk(mutex_);
-                if (status_ == status::fulfilling_at_exit) {
-                    status_ = status::fulfilled;
-                } else if (status_ == status::rejecting_at_exit) {
-                    status_ = status::rejected;
-                } else {
-                    return;
-                }
-                to_drain = utility::move(continuations_);
-            }
-            cv_.notify_all();
-            drain(utility::move(to_drain));
-        }
-
-        Ty &value_ref_unsafe() {
-            return std::get<1>(result_);
-        }
+        using continuation_type = functional::delegate<void()>;
 
-        std::exception_ptr exception_ref_unsafe() const {
-            return std::get<2>(result_);
-        }
+        shared_state_base(const shared_state_base &) = delete;
+        shared_state_base &operator=(const shared_state_base &) = delete;
 
-        void set_value(Ty value) {
-            std::vector<functional::delegate<void()>> to_drain;
-            {
-                lock_guard lk(mutex_);
-                throw_if_already_satisfied();
-                result_.template emplace<1>(utility::move(value));
-                status_ = status::fulfilled;
-                to_drain = utility::move(continuations_);
-            }
-            cv_.notify_all();
-            drain(utility::move(to_drain));
-        }
-
-        void set_exception(std::exception_ptr ep) {
-            std::vector<functional::delegate<void()>> to_drain;
-            {
-                lock_guard lk(mutex_);
-                throw_if_already_satisfied();
-                result_.template emplace<2>(utility::move(ep));
-                status_ = status::rejected;
-                to_drain = utility::move(continuations_);
-            }
-            cv_.notify_all();
-            drain(utility::move(to_drain));
-        }
-
-        void set_deferred(functional::delegate<void()> fn) {
+        void set_deferred(continuation_type fn) {
             lock_guard lk(mutex_);
-            if (status_ != status::pending) {
-                throw std::future_error(std::future_errc::promise_already_satisfied);
-            }
             deferred_fn_ = utility::move(fn);
-            status_ = status::deferred;
+            std::uint32_t cur = word_.load(memory_order_relaxed);
+            do {
+                if ((cur & (status_mask | claimed_bit)) != pending) {
+                    deferred_fn_.reset();
+                    throw std::future_error(std::future_errc::promise_already_satisfied);
+                }
+            } while (!word_.compare_exchange_weak(cur, cur | deferred, memory_order_release, memory_order_relaxed));
         }
 
         void wait() const {
             maybe_invoke_deferred();
-            unique_lock lk(mutex_);
-            cv_.wait(lk, [this] { return is_done(status_); });
+            std::uint32_t cur = word_.load(memory_order_acquire);
+            while (!is_done(cur)) {
+                // 先打上等待标记，完成方只在看到该标记时才执行唤醒
+                if (!(cur & waiting_bit)) {
+                    if (!word_.compare_exchange_weak(cur, cur | waiting_bit, memory_order_acquire, memory_order_acquire)) {
+                        continue;
+                    }
+                    cur |= waiting_bit;
+                }
+                word_.wait(cur, memory_order_acquire);
+                cur = word_.load(memory_order_acquire);
+            }
         }
 
         template <typename Rep, typename Period>
         future_status wait_for(const std::chrono::duration<Rep, Period> &rel) const {
-            {
-                lock_guard lk(mutex_);
-                if (status_ == status::deferred) {
-                    return future_status::deferred;
-                }
+            if (is_deferred()) {
+                return future_status::deferred;
+            }
+            if (is_ready()) {
+                return future_status::ready;
             }
             unique_lock lk(mutex_);
-            return cv_.wait_for(lk, rel, [this] { return is_done(status_); }) ? future_status::ready : future_status::timeout;
+            word_.fetch_or(waiting_bit, memory_order_acq_rel);
+            return cv_.wait_for(lk, rel, [this] { return is_ready(); }) ? future_status::ready : future_status::timeout;
         }
 
         template <typename Clock, typename Duration>
         future_status wait_until(const std::chrono::time_point<Clock, Duration> &abs) const {
-            {
-                lock_guard lk(mutex_);
-                if (status_ == status::deferred) {
-                    return future_status::deferred;
-                }
+            if (is_deferred()) {
+                return future_status::deferred;
             }
-            unique_lock lk(mutex_);
-            return cv_.wait_until(lk, abs, [this] { return is_done(status_); }) ? future_status::ready : future_status::timeout;
-        }
-
-        Ty get() {
-            maybe_invoke_deferred();
-            wait();
-            lock_guard lk(mutex_);
-            if (status_ == status::rejected) {
-                std::rethrow_exception(std::get<2>(result_));
+            if (is_ready()) {
+                return future_status::ready;
             }
-            return utility::move(std::get<1>(result_));
-        }
-
-        const Ty &get_shared() const {
-            maybe_invoke_deferred();
-            wait();
-            lock_guard lk(mutex_);
-            if (status_ == status::rejected) {
-                std::rethrow_exception(std::get<2>(result_));
-            }
-            return std::get<1>(result_);
+            unique_lock lk(mutex_);
+            word_.fetch_or(waiting_bit, memory_order_acq_rel);
+            return cv_.wait_until(lk, abs, [this] { return is_ready(); }) ? future_status::ready : future_status::timeout;
         }
 
-        bool is_deferred() const {
-            lock_guard lk(mutex_);
-            return status_ == status::deferred;
+        RAINY_NODISCARD bool is_deferred() const noexcept {
+            return (word_.load(memory_order_acquire) & status_mask) == deferred;
         }
 
-        bool is_fulfilled() const {
-            lock_guard lk(mutex_);
-            return status_ == status::fulfilled;
+        RAINY_NODISCARD bool is_fulfilled() const noexcept {
+            return (word_.load(memory_order_acquire) & status_mask) == fulfilled;
         }
 
-        bool is_rejected() const {
-            lock_guard lk(mutex_);
-            return status_ == status::rejected;
+        RAINY_NODISCARD bool is_rejected() const noexcept {
+            return (word_.load(memory_order_acquire) & status_mask) == rejected;
         }
 
-        bool is_ready() const {
-            lock_guard lk(mutex_);
-            return is_done(status_);
+        RAINY_NODISCARD bool is_ready() const noexcept {
+            return is_done(word_.load(memory_order_acquire));
         }
 
-        std::exception_ptr get_exception() const {
-            lock_guard lk(mutex_);
-            if (status_ == status::rejected) {
-                return std::get<2>(result_);
+        /**
+         * @brief 登记续体，状态已完成时在当前线程立即执行
+         */
+        void add_continuation(continuation_type callback) {
+            std::uint32_t cur = word_.load(memory_order_acquire);
+            while (!is_done(cur)) {
+                if (cur & inline_claimed_bit) {
+                    add_overflow(utility::move(callback));
+                    return;
+                }
+                if (word_.compare_exchange_weak(cur, cur | inline_claimed_bit, memory_order_acquire, memory_order_acquire)) {
+                    inline_ = utility::move(callback);
+                    // 与完成方的 publish 竞争：后到的一方负责执行内联续体
+                    if (is_done(word_.fetch_or(inline_ready_bit, memory_order_acq_rel))) {
+                        run_inline();
+                    }
+                    return;
+                }
             }
-            return nullptr;
+            callback();
         }
 
-        void add_continuation(functional::delegate<void()> callback) {
-            bool fire_now = false;
-            {
-                lock_guard lk(mutex_);
-                if (is_done(status_)) {
-                    fire_now = true;
-                } else {
-                    continuations_.push_back(utility::move(callback));
-                    return;
+    protected:
+        shared_state_base() = default;
+        ~shared_state_base() = default;
+
+        /**
+         * @brief 取得写入结果的唯一权利，状态已完成或处于 deferred 时抛出 promise_already_satisfied
+         */
+        void claim() {
+            std::uint32_t cur = word_.load(memory_order_relaxed);
+            do {
+                if ((cur & (status_mask | claimed_bit)) != pending) {
+                    throw std::future_error(std::future_errc::promise_already_satisfied);
                 }
-            }
-            if (fire_now) {
-                callback();
-                callback.reset();
-            }
+            } while (!word_.compare_exchange_weak(cur, cur | claimed_bit, memory_order_acquire, memory_order_relaxed));
         }
 
-    private:
-        enum class status {
-            pending,
-            deferred,
-            fulfilling_at_exit,
-            rejecting_at_exit,
-            fulfilled,
-            rejected
-        };
+        /**
+         * @brief 写入结果失败时交还 claim 取得的权利
+         */
+        void unclaim() noexcept {
+            word_.fetch_and(~claimed_bit, memory_order_release);
+        }
 
-        static bool is_done(status s) noexcept {
-            return s == status::fulfilled || s == status::rejected;
+        void fulfill() {
+            publish(fulfilled);
         }
 
-        void throw_if_already_satisfied() {
-            if (status_ != status::pending) {
-                throw std::future_error(std::future_errc::promise_already_satisfied);
-            }
+        void reject() {
+            publish(rejected);
         }
 
         void maybe_invoke_deferred() const {
-            functional::delegate<void()> fn;
+            if ((word_.load(memory_order_acquire) & status_mask) != deferred) {
+                return;
+            }
+            continuation_type fn;
             {
                 lock_guard lk(mutex_);
-                if (status_ != status::deferred) {
+                if ((word_.load(memory_order_acquire) & status_mask) != deferred) {
                     return;
                 }
                 fn = utility::move(deferred_fn_);
-                status_ = status::pending;
+                word_.fetch_and(~status_mask, memory_order_acq_rel);
             }
             fn();
         }
 
-        void flush_at_exit() {
-            std::vector<functional::delegate<void()>> to_drain;
-            {
-                lock_guard lk(mutex_);
-                if (status_ == status::fulfilling_at_exit) {
-                    status_ = status::fulfilled;
-                } else if (status_ == status::rejecting_at_exit) {
-                    status_ = status::rejected;
+    private:
+        enum : std::uint32_t {
+            pending = 0,
+            deferred = 1,
+            fulfilled = 2,
+            rejected = 3,
+            status_mask = 0x3,
+            claimed_bit = 1u << 2,
+            waiting_bit = 1u << 3,
+            inline_claimed_bit = 1u << 4,
+            inline_ready_bit = 1u << 5,
+            overflow_bit = 1u << 6
+        };
+
+        static bool is_done(const std::uint32_t word) noexcept {
+            return (word & status_mask) >= fulfilled;
+        }
+
+        void publish(const std::uint32_t status) {
+            const std::uint32_t prev = word_.fetch_or(status, memory_order_acq_rel);
+            if (prev & waiting_bit) {
+                {
+                    // 限时等待方在持锁时检查状态，这里取一次锁保证通知不会落在其检查与挂起之间
+                    lock_guard lk(mutex_);
                 }
-                to_drain = utility::move(continuations_);
+                cv_.notify_all();
+                word_.notify_all();
+            }
+            if (prev & inline_ready_bit) {
+                run_inline();
             }
-            cv_.notify_all();
-            drain(utility::move(to_drain));
+            if (prev & overflow_bit) {
+                std::vector<continuation_type> to_drain;
+                {
+                    lock_guard lk(mutex_);
+                    overflow_drained_ = true;
+                    to_drain = utility::move(overflow_);
+                }
+                for (auto &cb: to_drain) {
+                    cb();
+                    cb.reset();
+                }
+            }
+        }
+
+        void run_inline() {
+            continuation_type cb = utility::move(inline_);
+            inline_.reset();
+            cb();
         }
 
-        static void drain(std::vector<functional::delegate<void()>> callbacks) {
-            for (auto &cb: callbacks) {
-                cb();
-                cb.reset();
+        void add_overflow(continuation_type callback) {
+            if (!is_done(word_.fetch_or(overflow_bit, memory_order_acq_rel))) {
+                lock_guard lk(mutex_);
+                // 标记先于 publish 落下时，完成方一定会来清空溢出表；这里只需判断它是否已经来过
+                if (!overflow_drained_) {
+                    overflow_.push_back(utility::move(callback));
+                    return;
+                }
             }
+            callback();
         }
 
+        mutable atomic<std::uint32_t> word_{pending};
+        continuation_type inline_;
         mutable mutex mutex_;
         mutable condition_variable cv_;
-        mutable functional::delegate<void()> deferred_fn_;
-        mutable status status_;
-
-        std::vector<functional::delegate<void()>> continuations_;
-        std::variant<std::monostate, Ty, std::exception_ptr> result_;
+        mutable continuation_type deferred_fn_;
+        bool overflow_drained_{false};
+        std::vector<continuation_type> overflow_;
     };
 }
 
 namespace rainy::foundation::concurrency {
-    template <>
-    class shared_state<void> : public std::enable_shared_from_this<shared_state<void>> {
+    template <typename Ty>
+    class shared_state : public implements::shared_state_base, public std::enable_shared_from_this<shared_state<Ty>> {
     public:
         shared_state() = default;
 
-        ~shared_state() {
-            std::vector<functional::delegate<void()>> to_drain;
-            {
-                lock_guard lk(mutex_);
-                if (status_ == status::fulfilling_at_exit) {
-                    status_ = status::fulfilled;
-                } else if (status_ == status::rejecting_at_exit) {
-                    status_ = status::rejected;
-                } else {
-                    return;
-                }
-                to_drain = utility::move(continuations_);
-            }
-            cv_.notify_all();
-            drain(utility::move(to_drain));
-        }
-
-        void set_value() {
-            std::vector<functional::delegate<void()>> to_drain;
-            {
-                lock_guard lk(mutex_);
-                throw_if_already_satisfied();
-                status_ = status::fulfilled;
-                to_drain = utility::move(continuations_);
-            }
-            cv_.notify_all();
-            drain(utility::move(to_drain));
-        }
-
-        void set_exception(std::exception_ptr ep) {
-            std::vector<functional::delegate<void()>> to_drain;
-            {
-                lock_guard lk(mutex_);
-                throw_if_already_satisfied();
-                exception_ = utility::move(ep);
-                status_ = status::rejected;
-                to_drain = utility::move(continuations_);
-            }
-            cv_.notify_all();
-            drain(utility::move(to_drain));
+        Ty &value_ref_unsafe() {
+            return std::get<1>(result_);
         }
 
-        void wait() const {
-            maybe_invoke_deferred();
-            unique_lock lk(mutex_);
-            cv_.wait(lk, [this] { return is_done(status_); });
+        std::exception_ptr exception_ref_unsafe() const {
+            return std::get<2>(result_);
         }
 
-        template <typename Rep, typename Period>
-        future_status wait_for(const std::chrono::duration<Rep, Period> &rel) const {
-            {
-                lock_guard lk(mutex_);
-                if (status_ == status::deferred)
-                    return future_status::deferred;
+        void set_value(Ty value) {
+            claim();
+            try {
+                result_.template emplace<1>(utility::move(value));
+            } catch (...) {
+                unclaim();
+                throw;
             }
-            unique_lock lk(mutex_);
-            return cv_.wait_for(lk, rel, [this] { return is_done(status_); }) ? future_status::ready : future_status::timeout;
+            fulfill();
         }
 
-        template <typename Clock, typename Duration>
-        future_status wait_until(const std::chrono::time_point<Clock, Duration> &abs) const {
-            {
-                lock_guard lk(mutex_);
-                if (status_ == status::deferred)
-                    return future_status::deferred;
-            }
-            unique_lock lk(mutex_);
-            return cv_.wait_until(lk, abs, [this] { return is_done(status_); }) ? future_status::ready : future_status::timeout;
+        void set_exception(std::exception_ptr ep) {
+            claim();
+            result_.template emplace<2>(utility::move(ep));
+            reject();
         }
 
-        void get() {
-            maybe_invoke_deferred();
+        Ty get() {
             wait();
-            lock_guard lk(mutex_);
-            if (status_ == status::rejected) {
-                std::rethrow_exception(exception_);
+            if (is_rejected()) {
+                std::rethrow_exception(std::get<2>(result_));
             }
+            return utility::move(std::get<1>(result_));
         }
 
-        void get_shared() const {
-            const_cast<shared_state *>(this)->get();
-        }
-
-        void set_deferred(functional::delegate<void()> fn) {
-            lock_guard lk(mutex_);
-            if (status_ != status::pending) {
-                throw std::future_error(std::future_errc::promise_already_satisfied);
+        const Ty &get_shared() const {
+            wait();
+            if (is_rejected()) {
+                std::rethrow_exception(std::get<2>(result_));
             }
-            deferred_fn_ = utility::move(fn);
-            status_ = status::deferred;
-        }
-
-        bool is_deferred() const {
-            lock_guard lk(mutex_);
-            return status_ == status::deferred;
-        }
-
-        bool is_fulfilled() const {
-            lock_guard lk(mutex_);
-            return status_ == status::fulfilled;
-        }
-
-        bool is_rejected() const {
-            lock_guard lk(mutex_);
-            return status_ == status::rejected;
-        }
-
-        bool is_ready() const {
-            lock_guard lk(mutex_);
-            return is_done(status_);
+            return std::get<1>(result_);
         }
 
         std::exception_ptr get_exception() const {
-            lock_guard lk(mutex_);
-            return exception_;
-        }
-
-        void add_continuation(functional::delegate<void()> callback) {
-            bool fire_now = false;
-            {
-                lock_guard lk(mutex_);
-                if (is_done(status_)) {
-                    fire_now = true;
-                } else {
-                    continuations_.push_back(utility::move(callback));
-                    return;
-                }
-            }
-            if (fire_now) {
-                callback();
-                callback.reset();
+            if (is_rejected()) {
+                return std::get<2>(result_);
             }
+            return nullptr;
         }
 
     private:
-        enum class status {
-            pending,
-            deferred,
-            fulfilling_at_exit,
-            rejecting_at_exit,
-            fulfilled,
-            rejected
-        };
+        std::variant<std::monostate, Ty, std::exception_ptr> result_;
+    };
+}
+
+namespace rainy::foundation::concurrency {
+    template <>
+    class shared_state<void> : public implements::shared_state_base, public std::enable_shared_from_this<shared_state<void>> {
+    public:
+        shared_state() = default;
 
-        static bool is_done(const status s) noexcept {
-            return s == status::fulfilled || s == status::rejected;
+        void set_value() {
+            claim();
+            fulfill();
         }
 
-        void throw_if_already_satisfied() const {
-            if (status_ != status::pending) {
-                throw std::future_error(std::future_errc::promise_already_satisfied);
-            }
+        void set_exception(std::exception_ptr ep) {
+            claim();
+            exception_ = utility::move(ep);
+            reject();
         }
 
-        void flush_at_exit() {
-            std::vector<functional::delegate<void()>> to_drain;
-            {
-                lock_guard lk(mutex_);
-                if (status_ == status::fulfilling_at_exit) {
-                    status_ = status::fulfilled;
-                } else if (status_ == status::rejecting_at_exit) {
-                    status_ = status::rejected;
-                }
-                to_drain = utility::move(continuations_);
+        void get() {
+            wait();
+            if (is_rejected()) {
+                std::rethrow_exception(exception_);
             }
-            cv_.notify_all();
-            drain(utility::move(to_drain));
         }
 
-        void maybe_invoke_deferred() const {
-            functional::delegate<void()> fn;
-            {
-                lock_guard lk(mutex_);
-                if (status_ != status::deferred)
-                    return;
-                fn = utility::move(deferred_fn_);
-                status_ = status::pending;
-            }
-            fn();
+        void get_shared() const {
+            const_cast<shared_state *>(this)->get();
         }
 
-        static void drain(std::vector<functional::delegate<void()>> callbacks) {
-            for (auto &cb: callbacks) {
-                cb();
-                cb.reset();
+        std::exception_ptr get_exception() const {
+            if (is_rejected()) {
+                return exception_;
             }
+            return nullptr;
         }
 
-        mutable mutex mutex_;
-        mutable condition_variable cv_;
-        mutable functional::delegate<void()> deferred_fn_;
-        mutable status status_{status::pending};
-
+    private:
         std::exception_ptr exception_;
-        std::vector<functional::delegate<void()>> continuations_;
     };
 }
 
 namespace rainy::foundation::concurrency {
+    /**
+     * @brief 创建 shared_state，控制块与状态一次分配，经线程本地回收缓存复用
+     */
     template <typename Ty>
     std::shared_ptr<shared_state<Ty>> make_shared_state() {
-        return std::shared_ptr<shared_state<Ty>>(new shared_state<Ty>());
+        return std::allocate_shared<shared_state<Ty>>(
+            memory::recycling_allocator<shared_state<Ty>, implements::thread_info_base::shared_state_tag>{});
     }
 }
 
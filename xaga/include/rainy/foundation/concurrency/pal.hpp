@@ -232,6 +232,31 @@ namespace rainy::foundation::concurrency::implements {
      * @brief 恢复被挂起线程
      */
     RAINY_TOOLKIT_API void resume_thread(schd_thread_t thread_handle) noexcept;
+
+    /**
+     * @brief 将线程限制在给定的逻辑 CPU 集合上运行
+     *
+     * @param cpus 逻辑 CPU 编号数组
+     * @param count 数组长度，为 0 时返回 error 并设置 errno = EINVAL
+     * @return 平台不支持（如 macOS）时返回 error 并设置 errno = ENOTSUP
+     */
+    RAINY_TOOLKIT_API thrd_result thread_set_affinity(schd_thread_t thread_handle, const std::size_t *cpus,
+                                                      std::size_t count) noexcept;
+
+    /**
+     * @brief 设置线程名，便于调试器与 top/perf 识别
+     *
+     * @remark Linux 下名称最多 15 个字节，超出部分被截断；macOS 只能为当前线程命名。
+     */
+    RAINY_TOOLKIT_API thrd_result thread_set_name(schd_thread_t thread_handle, const char *name) noexcept;
+
+    /**
+     * @brief 设置线程调度优先级
+     *
+     * @param level 取值 -2 ~ 2，依次对应最低、较低、普通、较高、最高
+     * @remark Linux 下映射为线程的 nice 值，提高优先级通常需要 CAP_SYS_NICE，权限不足时返回 error 并设置 errno = EPERM。
+     */
+    RAINY_TOOLKIT_API thrd_result thread_set_priority(schd_thread_t thread_handle, int level) noexcept;
 }
 
 namespace rainy::foundation::concurrency::implements {
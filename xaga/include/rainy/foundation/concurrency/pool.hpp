@@ -16,18 +16,109 @@
 #ifndef RAINY_FOUNDATION_CONCURRENCY_POOL_HPP
 #define RAINY_FOUNDATION_CONCURRENCY_POOL_HPP
 #include <queue>
+#include <string>
 #include <rainy/foundation/concurrency/atomic.hpp>
 #include <rainy/foundation/concurrency/basic/actor.hpp>
+#include <rainy/foundation/concurrency/basic/parking.hpp>
 #include <rainy/foundation/concurrency/basic/scheduler.hpp>
+#include <rainy/foundation/concurrency/basic/topology.hpp>
 #include <rainy/foundation/concurrency/condition_variable.hpp>
 #include <rainy/foundation/diagnostics/contract.hpp>
 #include <rainy/foundation/memory/nebula_ptr.hpp>
 
+namespace rainy::foundation::concurrency::implements {
+    /**
+     * @brief 以 self 为起点计算访问其他成员的顺序：与 self 同一 NUMA 节点的排在前面，各组内从 self 的下一个开始轮转，
+     *        避免所有窃取者总是先冲向同一个受害者
+     * @param nodes 每个成员所在的节点
+     * @return 不含 self 的成员下标
+     */
+    inline std::vector<std::size_t> locality_order(const std::size_t self, const std::vector<std::size_t> &nodes) {
+        const std::size_t count = nodes.size();
+        std::vector<std::size_t> order;
+        order.reserve(count);
+        for (std::size_t off = 1; off < count; ++off) {
+            if (const std::size_t idx = (self + off) % count; nodes[idx] == nodes[self]) {
+                order.push_back(idx);
+            }
+        }
+        for (std::size_t off = 1; off < count; ++off) {
+            if (const std::size_t idx = (self + off) % count; nodes[idx] != nodes[self]) {
+                order.push_back(idx);
+            }
+        }
+        return order;
+    }
+
+    /**
+     * @brief 将 tasks 切成至多 actors.size() 段连续批次，从 start 起依次交给各 actor
+     *
+     * 每段只在目标 actor 的注入栈上 CAS 一次并唤醒一个线程，因此被唤醒的线程数不超过批次数。
+     */
+    template <typename Actors>
+    void distribute_bulk(Actors &actors, const std::size_t start,
+                         const collections::views::array_view<functional::move_only_delegate<void()>> tasks) {
+        const std::size_t count = tasks.size();
+        const std::size_t actor_count = actors.size();
+        const std::size_t batches = (core::min) (count, actor_count);
+        auto *first = tasks.data();
+        for (std::size_t k = 0; k < batches; ++k) {
+            const std::size_t begin = count * k / batches;
+            const std::size_t end = count * (k + 1) / batches;
+            actors[(start + k) % actor_count]->submit_bulk(first + begin, first + end);
+        }
+    }
+
+    /**
+     * @brief 各 pool 的 submit_bulk 公共部分：完成计数只累加一次，从 round_robin 取起点后经 distribute_bulk 分发
+     */
+    template <typename Actors>
+    void submit_bulk(Actors &actors, atomic<int> &submit_count, atomic<std::size_t> &round_robin,
+                     const collections::views::array_view<functional::move_only_delegate<void()>> tasks) {
+        if (tasks.empty()) {
+            return;
+        }
+        submit_count.fetch_add(static_cast<int>(tasks.size()), memory_order_relaxed);
+        const std::size_t start = round_robin.fetch_add(tasks.size(), memory_order_relaxed) % actors.size();
+        distribute_bulk(actors, start, tasks);
+    }
+
+    /**
+     * @brief 调用线程当前持有的 actor，若它属于 actors 则返回之，否则为空
+     */
+    template <typename Actors>
+    actor_worker *owned_actor(const Actors &actors) noexcept {
+        actor_worker *self = actor_worker::current();
+        if (self && self->id() < actors.size() && actors[self->id()].get() == self) { // NOLINT
+            return self;
+        }
+        return nullptr;
+    }
+
+    inline void name_worker(thread &worker, const char *prefix, const std::size_t index) {
+        (void) worker.set_name(std::string{prefix} + std::to_string(index));
+    }
+
+    /**
+     * @brief 给出 cpus 时把 worker 绑定到 cpus[index % cpus.size()]
+     * @return 绑定失败（如 CPU 不在进程的 cgroup 允许范围内）时返回 false；未给出 cpus 时不绑定，返回 true
+     */
+    inline bool pin_worker(thread &worker, const std::vector<std::size_t> &cpus, const std::size_t index) noexcept {
+        return cpus.empty() || worker.set_affinity(cpus[index % cpus.size()]) == thrd_result::success;
+    }
+}
+
 namespace rainy::foundation::concurrency {
+    /**
+     * @brief pooled_actor_pool
+     *
+     * N 个线程服务 M 个 actor。构造时给出 cpus 则线程 i 绑定到 cpus[i % cpus.size()]，
+     * 并按 CPU 所属 NUMA 节点决定窃取与扫描顺序：先同节点、后跨节点。
+     */
     class pooled_actor_pool final : public task_scheduler {
     public:
         explicit pooled_actor_pool(const std::size_t thread_count = std::thread::hardware_concurrency(),
-                                   const std::size_t actor_count = 0) :
+                                   const std::size_t actor_count = 0, const std::vector<std::size_t> &cpus = {}) :
             thread_count_(thread_count), actor_count_(actor_count == 0 ? thread_count : actor_count), round_robin_(0), stop_(false) {
             utility::expects(thread_count_ > 0);
             utility::expects(actor_count_ >= thread_count_);
@@ -46,18 +137,39 @@ namespace rainy::foundation::concurrency {
                     }
                 });
             }
-            std::vector<actor_worker *> all_peers;
-            all_peers.reserve(actor_count_);
-            for (auto &a: actors_) {
-                all_peers.push_back(a.get());
+            // actor j 的“家”是偏好它的线程 j % thread_count 所在的节点；未指定 cpus 时全部视为同一节点
+            const cpu_topology &topology = cpu_topology::current();
+            std::vector<std::size_t> actor_nodes(actor_count_, 0);
+            if (!cpus.empty()) {
+                for (std::size_t j = 0; j < actor_count_; ++j) {
+                    actor_nodes[j] = topology.node_of(cpus[(j % thread_count_) % cpus.size()]);
+                }
             }
-            for (auto &a: actors_) {
-                a->set_peers(all_peers);
+            for (std::size_t j = 0; j < actor_count_; ++j) {
+                std::vector<actor_worker *> peers;
+                peers.reserve(actor_count_);
+                for (const std::size_t idx: implements::locality_order(j, actor_nodes)) {
+                    peers.push_back(actors_[idx].get()); // NOLINT
+                }
+                actors_[j]->set_peers(utility::move(peers)); // NOLINT
+                actors_[j]->set_parker(&parker_); // NOLINT
+            }
+            scan_order_.reserve(thread_count_);
+            for (std::size_t i = 0; i < thread_count_; ++i) {
+                const std::size_t preferred = i % actor_count_;
+                std::vector<std::size_t> order{preferred};
+                const auto rest = implements::locality_order(preferred, actor_nodes);
+                order.insert(order.end(), rest.begin(), rest.end());
+                scan_order_.push_back(utility::move(order));
             }
             threads_.reserve(thread_count_);
             for (std::size_t i = 0; i < thread_count_; ++i) {
                 threads_.emplace_back(
                     foundation::memory::make_nebula<thread>(thread::policy::auto_join, [this, i] { thread_loop(i); }));
+                implements::name_worker(*threads_.back(), "pooled-", i);
+                if (!implements::pin_worker(*threads_.back(), cpus, i)) {
+                    ++unpinned_;
+                }
             }
         }
 
@@ -90,6 +202,15 @@ namespace rainy::foundation::concurrency {
             return traits;
         }
 
+        using task_scheduler::submit_bulk;
+
+        /**
+         * @brief 批量提交：计数只累加一次，任务按连续批次分给各 actor
+         */
+        void submit_bulk(collections::views::array_view<functional::move_only_delegate<void()>> tasks) override {
+            implements::submit_bulk(actors_, submit_count_, round_robin_, tasks);
+        }
+
         void submit_to(const std::size_t actor_id, functional::move_only_delegate<void()> task) override {
             submit_count_.fetch_add(1, memory_order_relaxed);
             if (actor_id < actor_count_) {
@@ -99,6 +220,52 @@ namespace rainy::foundation::concurrency {
             }
         }
 
+        /**
+         * @brief 就近提交：当前线程正在执行本 pool 的任务时压入所持 actor 的本地队列，否则与 submit 相同
+         *
+         * fork-join 派生的子任务因此留在父任务所在线程的 LIFO 端，其他线程只在空闲时从 top 端偷走较大的一半。
+         */
+        void submit_local(functional::move_only_delegate<void()> task) override {
+            submit_count_.fetch_add(1, memory_order_relaxed);
+            if (actor_worker *self = implements::owned_actor(actors_)) {
+                self->submit(utility::move(task));
+            } else {
+                route(utility::move(task));
+            }
+        }
+
+        /**
+         * @brief 在调用线程上执行至多一个任务，供等待子任务完成的一方帮忙而不是阻塞
+         *
+         * 调用线程正持有本 pool 的 actor 时先处理其本地队列，再依次尝试其余 actor。
+         * @return 执行了任务则返回 true
+         */
+        bool help_once() override {
+            if (actor_worker *self = implements::owned_actor(actors_); self && self->run_owned_once()) {
+                return true;
+            }
+            for (auto &a: actors_) {
+                if (a->run_once()) {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        /**
+         * @brief 设置空闲线程挂起前的自旋轮数，0 表示找不到任务立即挂起
+         */
+        void set_spin_budget(const std::size_t spin_budget) noexcept {
+            parker_.set_spin_budget(spin_budget);
+        }
+
+        /**
+         * @brief 构造时绑定 CPU 失败、仍由系统调度的线程数
+         */
+        RAINY_NODISCARD std::size_t unpinned_count() const noexcept {
+            return unpinned_;
+        }
+
         RAINY_NODISCARD bool stopped() const noexcept override {
             return stop_.load(memory_order_acquire);
         }
@@ -130,37 +297,43 @@ namespace rainy::foundation::concurrency {
         }
 
         void thread_loop(const std::size_t thread_idx) {
-            const std::size_t preferred = thread_idx % actor_count_;
+            // 偏好 actor 在最前，其后先同节点、后跨节点
+            const std::vector<std::size_t> &order = scan_order_[thread_idx]; // NOLINT
             while (!stop_.load(memory_order_acquire)) {
                 bool did_work = false;
-                if (actors_[preferred]->run_once()) { // NOLINT
-                    did_work = true;
-                } else {
-                    for (std::size_t i = 0; i < actor_count_; ++i) {
-                        if (i == preferred) {
-                            continue;
-                        }
-                        if (actors_[i]->run_once()) { // NOLINT
-                            did_work = true;
-                            break;
-                        }
+                for (const std::size_t i: order) {
+                    if (actors_[i]->run_once()) { // NOLINT
+                        did_work = true;
+                        break;
                     }
                 }
 
                 if (!did_work) {
-                    thread::sleep_for(0);
+                    parker_.idle([this] { return stop_.load(memory_order_acquire) || has_pending(); });
+                }
+            }
+        }
+
+        RAINY_NODISCARD bool has_pending() const noexcept {
+            for (const auto &a: actors_) {
+                if (a->has_reachable_work()) {
+                    return true;
                 }
             }
+            return false;
         }
 
         std::size_t thread_count_;
         std::size_t actor_count_;
         atomic<std::size_t> round_robin_;
         atomic<bool> stop_;
+        idle_parker parker_;
+        std::size_t unpinned_{0};
 
         mutex idle_mutex_;
         condition_variable idle_cv_;
 
+        std::vector<std::vector<std::size_t>> scan_order_;
         std::vector<memory::nebula_ptr<thread>> threads_;
         std::vector<memory::nebula_ptr<actor_worker>> actors_;
         atomic<int> submit_count_{0};
@@ -169,9 +342,15 @@ namespace rainy::foundation::concurrency {
 }
 
 namespace rainy::foundation::concurrency {
+    /**
+     * @brief dedicated_actor_pool
+     *
+     * 每个 actor 独占一个线程。构造时给出 cpus 则 actor i 的线程绑定到 cpus[i % cpus.size()]。
+     */
     class dedicated_actor_pool final : public task_scheduler {
     public:
-        explicit dedicated_actor_pool(const std::size_t actor_count = std::thread::hardware_concurrency()) :
+        explicit dedicated_actor_pool(const std::size_t actor_count = std::thread::hardware_concurrency(),
+                                      const std::vector<std::size_t> &cpus = {}) :
             actor_count_(actor_count), round_robin_(0), submit_count_(0), complete_count_(0) {
             utility::expects(actor_count_ > 0);
 
@@ -194,8 +373,13 @@ namespace rainy::foundation::concurrency {
             for (auto &a: actors_) {
                 all_peers.push_back(a.get());
             }
-            for (auto &a: actors_) {
-                a->start_dedicated({}); // ← 空 peers，禁止 stealing
+            for (std::size_t i = 0; i < actor_count_; ++i) {
+                actors_[i]->start_dedicated({}); // ← 空 peers，禁止 stealing // NOLINT
+                thread *worker = actors_[i]->dedicated_thread(); // NOLINT
+                implements::name_worker(*worker, "actor-", i);
+                if (!implements::pin_worker(*worker, cpus, i)) {
+                    ++unpinned_;
+                }
             }
         }
 
@@ -210,6 +394,15 @@ namespace rainy::foundation::concurrency {
             route(utility::move(task));
         }
 
+        using task_scheduler::submit_bulk;
+
+        /**
+         * @brief 批量提交：计数只累加一次，任务按连续批次分给各 actor
+         */
+        void submit_bulk(collections::views::array_view<functional::move_only_delegate<void()>> tasks) override {
+            implements::submit_bulk(actors_, submit_count_, round_robin_, tasks);
+        }
+
         void submit_to(const std::size_t actor_id, functional::move_only_delegate<void()> task) override {
             submit_count_.fetch_add(1, memory_order_relaxed);
             if (actor_id < actor_count_) {
@@ -219,6 +412,26 @@ namespace rainy::foundation::concurrency {
             }
         }
 
+        /**
+         * @brief 在本 pool 的 actor 线程内提交时留在该 actor 上，否则与 submit 相同
+         */
+        void submit_local(functional::move_only_delegate<void()> task) override {
+            submit_count_.fetch_add(1, memory_order_relaxed);
+            if (actor_worker *self = implements::owned_actor(actors_)) {
+                self->submit(utility::move(task));
+            } else {
+                route(utility::move(task));
+            }
+        }
+
+        /**
+         * @brief 调用线程是本 pool 的 actor 线程时执行该 actor 队列中的一个任务，否则什么也不做
+         */
+        bool help_once() override {
+            actor_worker *self = implements::owned_actor(actors_);
+            return self && self->run_owned_once();
+        }
+
         void wait_all() override {
             int target = submit_count_.load(memory_order_acquire);
             if (target == 0) {
@@ -243,6 +456,22 @@ namespace rainy::foundation::concurrency {
             return actor_count_;
         }
 
+        /**
+         * @brief 设置空闲线程挂起前的自旋轮数，0 表示找不到任务立即挂起
+         */
+        void set_spin_budget(const std::size_t spin_budget) noexcept {
+            for (auto &a: actors_) {
+                a->parker().set_spin_budget(spin_budget);
+            }
+        }
+
+        /**
+         * @brief 构造时绑定 CPU 失败、仍由系统调度的线程数
+         */
+        RAINY_NODISCARD std::size_t unpinned_count() const noexcept {
+            return unpinned_;
+        }
+
         RAINY_NODISCARD bool stopped() const noexcept override {
             return stop_.load(memory_order_acquire);
         }
@@ -277,6 +506,7 @@ namespace rainy::foundation::concurrency {
         atomic<int> submit_count_;
         atomic<int> complete_count_;
         atomic<bool> stop_{false};
+        std::size_t unpinned_{0};
         mutex idle_mutex_;
         condition_variable idle_cv_;
         std::vector<memory::nebula_ptr<actor_worker>> actors_;
@@ -293,10 +523,12 @@ namespace rainy::foundation::concurrency {
      *   - 线程属于共享 pool，可通过 submit() 经 round-robin+轻载 路由
      *   - 支持 submit_to(actor_id, task) 直接投递到指定 actor
      *   - actor_count == thread_count，保证一一对应
+     *   - 给出 cpus 时线程 i 绑定到 cpus[i % cpus.size()]，未给出时不绑定，由系统调度
      */
     class pinned_actor_pool final : public task_scheduler {
     public:
-        explicit pinned_actor_pool(const std::size_t thread_count = std::thread::hardware_concurrency()) :
+        explicit pinned_actor_pool(const std::size_t thread_count = std::thread::hardware_concurrency(),
+                                   const std::vector<std::size_t> &cpus = {}) :
             thread_count_(thread_count), round_robin_(0), stop_(false) {
             utility::expects(thread_count_ > 0);
 
@@ -323,6 +555,12 @@ namespace rainy::foundation::concurrency {
                 threads_.emplace_back(
                     foundation::memory::make_nebula<thread>(thread::policy::auto_join, [this, i] { thread_loop(i); }));
             }
+            for (std::size_t i = 0; i < thread_count_; ++i) {
+                implements::name_worker(*threads_[i], "pinned-", i); // NOLINT
+                if (!implements::pin_worker(*threads_[i], cpus, i)) { // NOLINT
+                    ++unpinned_;
+                }
+            }
         }
 
         ~pinned_actor_pool() override {
@@ -340,6 +578,15 @@ namespace rainy::foundation::concurrency {
             route(utility::move(task));
         }
 
+        using task_scheduler::submit_bulk;
+
+        /**
+         * @brief 批量提交：计数只累加一次，任务按连续批次分给各 actor
+         */
+        void submit_bulk(collections::views::array_view<functional::move_only_delegate<void()>> tasks) override {
+            implements::submit_bulk(actors_, submit_count_, round_robin_, tasks);
+        }
+
         /**
          * @brief 直接投递到指定 actor（即固定线程），越过路由
          *        actor_id 越界时退化为 route()
@@ -353,6 +600,14 @@ namespace rainy::foundation::concurrency {
             }
         }
 
+        /**
+         * @brief 调用线程是本 pool 的固定线程时执行其 actor 队列中的一个任务，否则什么也不做
+         */
+        bool help_once() override {
+            actor_worker *self = implements::owned_actor(actors_);
+            return self && self->run_owned_once();
+        }
+
         void wait_all() override {
             const int target = submit_count_.load(memory_order_acquire);
             if (target == 0) {
@@ -377,6 +632,22 @@ namespace rainy::foundation::concurrency {
             return thread_count_;
         }
 
+        /**
+         * @brief 设置空闲线程挂起前的自旋轮数，0 表示找不到任务立即挂起
+         */
+        void set_spin_budget(const std::size_t spin_budget) noexcept {
+            for (auto &a: actors_) {
+                a->parker().set_spin_budget(spin_budget);
+            }
+        }
+
+        /**
+         * @brief 构造时绑定 CPU 失败、仍由系统调度的线程数
+         */
+        RAINY_NODISCARD std::size_t unpinned_count() const noexcept {
+            return unpinned_;
+        }
+
         bool stopped() const noexcept override {
             return stop_.load(memory_order_acquire);
         }
@@ -415,8 +686,9 @@ namespace rainy::foundation::concurrency {
             actor_worker *pinned = actors_[thread_idx].get(); // NOLINT
             while (!stop_.load(memory_order_acquire)) {
                 if (!pinned->run_once()) { // NOLINT
-                    // 本 actor 暂无任务，短暂让出 CPU
-                    thread::sleep_for(0);
+                    // 本 actor 暂无任务，自旋一段时间后挂起，等待 submit 唤醒
+                    pinned->parker().idle(
+                        [this, pinned] { return stop_.load(memory_order_acquire) || pinned->queue_size() != 0; });
                 }
             }
         }
@@ -424,6 +696,7 @@ namespace rainy::foundation::concurrency {
         std::size_t thread_count_;
         atomic<std::size_t> round_robin_;
         atomic<bool> stop_;
+        std::size_t unpinned_{0};
 
         mutex idle_mutex_;
         condition_variable idle_cv_;
@@ -496,6 +769,7 @@ namespace rainy::foundation::concurrency {
                 }
                 for (auto &a: tier_actors) {
                     a->set_peers(peers);
+                    a->set_parker(&parker_);
                 }
             }
 
@@ -543,6 +817,24 @@ namespace rainy::foundation::concurrency {
             submit(utility::move(task), p);
         }
 
+        using task_scheduler::submit_bulk;
+
+        /**
+         * @brief 批量提交到 normal 层
+         */
+        void submit_bulk(collections::views::array_view<functional::move_only_delegate<void()>> tasks) override {
+            submit_bulk(tasks, actor_priority::normal);
+        }
+
+        /**
+         * @brief 批量提交到指定优先级层，计数只累加一次，任务按连续批次分给层内各 actor
+         */
+        void submit_bulk(collections::views::array_view<functional::move_only_delegate<void()>> tasks,
+                         const actor_priority priority) {
+            const auto tier = static_cast<std::size_t>(priority);
+            implements::submit_bulk(actors_[tier], submit_count_, round_robin_[tier], tasks); // NOLINT
+        }
+
         /**
          * @brief 直接投递到指定层的指定 actor
          *        actor_id 是层内索引，越界退化为 route()
@@ -586,6 +878,13 @@ namespace rainy::foundation::concurrency {
             return actors_per_tier_;
         }
 
+        /**
+         * @brief 设置空闲线程挂起前的自旋轮数，0 表示找不到任务立即挂起
+         */
+        void set_spin_budget(const std::size_t spin_budget) noexcept {
+            parker_.set_spin_budget(spin_budget);
+        }
+
         bool stopped() const noexcept override {
             return stop_.load(memory_order_acquire);
         }
@@ -689,15 +988,27 @@ namespace rainy::foundation::concurrency {
                     }
                 }
                 if (!did_work) {
-                    thread::sleep_for(0);
+                    parker_.idle([this] { return stop_.load(memory_order_acquire) || has_pending(); });
                 }
                 ++tick;
             }
         }
 
+        RAINY_NODISCARD bool has_pending() const noexcept {
+            for (const auto &tier_actors: actors_) {
+                for (const auto &a: tier_actors) {
+                    if (a->has_reachable_work()) {
+                        return true;
+                    }
+                }
+            }
+            return false;
+        }
+
         std::size_t thread_count_;
         std::size_t actors_per_tier_;
         atomic<bool> stop_;
+        idle_parker parker_;
 
         mutex idle_mutex_;
         condition_variable idle_cv_;
@@ -753,6 +1064,33 @@ namespace rainy::foundation::concurrency {
             check_expand_pool();
         }
 
+        using task_scheduler::submit_bulk;
+
+        /**
+         * @brief 批量提交：一次加锁压入全部任务，只唤醒与任务数相当的线程
+         */
+        void submit_bulk(collections::views::array_view<functional::move_only_delegate<void()>> tasks) override {
+            if (tasks.empty()) {
+                return;
+            }
+            const std::size_t count = tasks.size();
+            pending_tasks_.fetch_add(static_cast<int>(count), memory_order_relaxed);
+            {
+                lock_guard lk(queue_mutex_);
+                for (auto &task: tasks) {
+                    task_queue_.push(utility::move(task));
+                }
+                if (count >= active_threads_.load(memory_order_relaxed)) {
+                    queue_cv_.notify_all();
+                } else {
+                    for (std::size_t i = 0; i < count; ++i) {
+                        queue_cv_.notify_one();
+                    }
+                }
+            }
+            check_expand_pool();
+        }
+
         void submit_to(std::size_t actor_id, functional::move_only_delegate<void()> task) override {
             (void) actor_id;
             submit(utility::move(task));
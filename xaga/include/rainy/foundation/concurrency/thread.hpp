@@ -16,6 +16,8 @@
 #ifndef RAINY_FOUNDATION_CONCURRENCY_THREAD_HPP
 #define RAINY_FOUNDATION_CONCURRENCY_THREAD_HPP
 #include <chrono>
+#include <string_view>
+#include <vector>
 #include <rainy/core/core.hpp>
 #include <rainy/foundation/concurrency/pal.hpp>
 #include <rainy/foundation/memory/nebula_ptr.hpp>
@@ -31,6 +33,17 @@ namespace rainy::foundation::concurrency {
             auto_detach
         };
 
+        /**
+         * @brief 线程调度优先级，由平台映射为各自的取值（Linux 为 nice 值，Windows 为 THREAD_PRIORITY_*）
+         */
+        enum class priority : int {
+            lowest = -2,
+            below_normal = -1,
+            normal = 0,
+            above_normal = 1,
+            highest = 2
+        };
+
 #if RAINY_USING_LINUX
         using native_handle_type = ::pthread_t;
 #else
@@ -95,6 +108,23 @@ namespace rainy::foundation::concurrency {
 
         RAINY_NODISCARD id get_id() const noexcept;
 
+        /**
+         * @brief 将线程限制在给定的逻辑 CPU 集合上运行
+         */
+        thrd_result set_affinity(const std::vector<std::size_t> &cpus) noexcept;
+
+        /**
+         * @brief 将线程绑定到单个逻辑 CPU
+         */
+        thrd_result set_affinity(std::size_t cpu) noexcept;
+
+        /**
+         * @brief 设置线程名（Linux 下超过 15 字节的部分被截断）
+         */
+        thrd_result set_name(std::string_view name) noexcept;
+
+        thrd_result set_priority(priority level) noexcept;
+
     private:
         template <typename Tuple, std::size_t... Indices>
         static unsigned int invoke_function(void *arg_list) {
@@ -365,6 +365,76 @@ namespace rainy::foundation::io {
     }
 }
 
+namespace rainy::foundation::io::implements {
+    template <typename Ty, typename Buffer, typename = void>
+    struct is_buffer_range : type_traits::helper::false_type {};
+
+    template <typename Ty, typename Buffer>
+    struct is_buffer_range<Ty, Buffer,
+                           type_traits::other_trans::void_t<decltype(*buffer_sequence_begin(utility::declval<const Ty &>()))>>
+        : type_traits::helper::bool_constant<type_traits::type_relations::is_convertible_v<
+              type_traits::other_trans::decay_t<decltype(*buffer_sequence_begin(utility::declval<const Ty &>()))>, Buffer>> {};
+
+    /**
+     * @brief 把缓冲区序列展开成定长的描述符数组，供 readv / writev / sendmsg 一次提交
+     *
+     * 不分配堆内存：超过 max_segments 段的序列只取前 max_segments 段，*_some 类操作本就允许部分完成；空缓冲区被跳过。
+     * 元素不是缓冲区的对象（如 collections::vector<char>）经 io::buffer() 当作单个缓冲区。
+     */
+    template <typename Buffer>
+    class buffer_sequence_array {
+    public:
+        static constexpr std::size_t max_segments = 16;
+
+        template <typename BufferSequence,
+                  type_traits::other_trans::enable_if_t<
+                      !type_traits::type_relations::is_same_v<type_traits::other_trans::decay_t<BufferSequence>, buffer_sequence_array>,
+                      int> = 0>
+        explicit buffer_sequence_array(BufferSequence &&buffers) noexcept {
+            // 按调用方给出的常量性转发，使非 const 的容器经 io::buffer() 得到 mutable_buffer
+            if constexpr (is_buffer_range<type_traits::other_trans::decay_t<BufferSequence>, Buffer>::value) {
+                auto it = buffer_sequence_begin(buffers);
+                const auto end = buffer_sequence_end(buffers);
+                for (; it != end && count_ < max_segments; ++it) {
+                    push(Buffer(*it));
+                }
+            } else {
+                push(io::buffer(buffers));
+            }
+        }
+
+        RAINY_NODISCARD const Buffer *data() const noexcept {
+            return buffers_;
+        }
+
+        RAINY_NODISCARD std::size_t size() const noexcept {
+            return count_;
+        }
+
+        RAINY_NODISCARD std::size_t total_size() const noexcept {
+            std::size_t total = 0;
+            for (std::size_t i = 0; i < count_; ++i) {
+                total += buffers_[i].size();
+            }
+            return total;
+        }
+
+        RAINY_NODISCARD Buffer front() const noexcept {
+            return count_ != 0 ? buffers_[0] : Buffer{};
+        }
+
+    private:
+        void push(const Buffer &buffer) noexcept {
+            if (buffer.size() != 0) {
+                buffers_[count_++] = buffer;
+            }
+        }
+
+        Buffer buffers_[max_segments]{};
+        std::size_t count_{0};
+    };
+}
+
 namespace rainy::foundation::io {
     template <typename Ty, typename Allocator>
     class dynamic_vector_buffer {
@@ -45,6 +45,10 @@ namespace rainy::foundation::io {
         explicit async_completion(CompletionToken &t) : completion_handler(t), result(completion_handler) {
         }
 
+        // 令牌以 const 左值传入时（例如 use_awaitable），由令牌构造出独立的处理器
+        explicit async_completion(const CompletionToken &t) : completion_handler(t), result(completion_handler) {
+        }
+
         async_completion(const async_completion &) = delete;
         async_completion &operator=(const async_completion &) = delete;
 
@@ -22,10 +22,69 @@
 #include <rainy/foundation/io/executor/implements/handler_tracking.hpp>
 
 namespace rainy::foundation::io::implements {
+    struct timer_entry;
+    class timer_op;
+
+    /**
+     * @brief 由后端持有、内核按需挑选的缓冲区池（io_uring provided buffer ring）
+     *
+     * 内核在完成事件中报告选中的缓冲区编号，使用方处理完毕后必须调用 recycle() 归还。
+     */
+    class provided_buffer_pool {
+    public:
+        virtual ~provided_buffer_pool() = default;
+
+        RAINY_NODISCARD virtual void *data(std::uint32_t buffer_id) const noexcept = 0;
+        RAINY_NODISCARD virtual std::size_t buffer_size() const noexcept = 0;
+        RAINY_NODISCARD virtual std::size_t buffer_count() const noexcept = 0;
+
+        /**
+         * @brief 将编号为 buffer_id 的缓冲区归还给池，之后内核可再次选用
+         */
+        virtual void recycle(std::uint32_t buffer_id) noexcept = 0;
+    };
+
+    /**
+     * @brief 预先注册到内核的固定缓冲区池（io_uring fixed buffers）
+     *
+     * 池中缓冲区的页面在注册时一次性锁定，后端发现读写范围落在某个缓冲区内时会改用 read_fixed / write_fixed，
+     * 从而省去每次操作的页面锁定。使用方通过 acquire() 借出、release() 归还。
+     */
+    class fixed_buffer_pool {
+    public:
+        virtual ~fixed_buffer_pool() = default;
+
+        RAINY_NODISCARD virtual void *data(std::uint32_t index) const noexcept = 0;
+        RAINY_NODISCARD virtual std::size_t buffer_size() const noexcept = 0;
+        RAINY_NODISCARD virtual std::size_t buffer_count() const noexcept = 0;
+
+        /**
+         * @brief 借出一个空闲缓冲区
+         * @param index 成功时写入缓冲区编号
+         * @return 池已耗尽时返回 false
+         */
+        virtual bool acquire(std::uint32_t &index) noexcept = 0;
+
+        /**
+         * @brief 归还编号为 index 的缓冲区
+         */
+        virtual void release(std::uint32_t index) noexcept = 0;
+    };
+
+    enum op_result_flags : std::uint32_t {
+        op_result_none = 0,
+        op_result_more = 1u << 0, // 多发（multishot）操作仍处于活动状态，后续还会有完成事件
+        op_result_buffer = 1u << 1, // buffer_id 有效，数据位于 buffers 所指的缓冲区池中
+        op_result_notification = 1u << 2 // 零拷贝发送的通知事件：内核已不再引用发送缓冲区
+    };
+
     struct op_result {
         void *user_data;
         std::size_t bytes_transferred;
         int error_code;
+        std::uint32_t flags{op_result_none};
+        std::uint32_t buffer_id{0};
+        provided_buffer_pool *buffers{nullptr};
     };
 
     struct completion_op {
@@ -43,6 +102,55 @@ namespace rainy::foundation::io::implements {
         void *io_handle{nullptr};
     };
 
+    /**
+     * @brief 以 completion_op::next 串联的无锁多生产者队列
+     *
+     * 生产者以 CAS 压入栈顶；消费者用一次 exchange 摘走整批，再反转成先进先出的链表。
+     * 消费者只做 exchange，不存在 ABA 问题，因此多个线程同时 run() 时也可以各自取走互不相交的批次。
+     */
+    class completion_op_mpsc_queue {
+    public:
+        completion_op_mpsc_queue() noexcept = default;
+
+        completion_op_mpsc_queue(const completion_op_mpsc_queue &) = delete;
+        completion_op_mpsc_queue &operator=(const completion_op_mpsc_queue &) = delete;
+
+        /**
+         * @brief 压入一个 op，可在任意线程调用
+         * @return 压入前队列是否为空
+         */
+        bool push(completion_op *op) noexcept {
+            completion_op *head = head_.load(concurrency::memory_order_relaxed);
+            do {
+                op->next = head;
+            } while (!head_.compare_exchange_weak(head, op, concurrency::memory_order_release, concurrency::memory_order_relaxed));
+            return head == nullptr;
+        }
+
+        /**
+         * @brief 一次性取走当前所有 op
+         * @return 按压入顺序以 next 串联的链表，队列为空时返回 nullptr
+         */
+        RAINY_NODISCARD completion_op *pop_all() noexcept {
+            completion_op *head = head_.exchange(nullptr, concurrency::memory_order_acquire);
+            completion_op *fifo = nullptr;
+            while (head) {
+                completion_op *next = head->next;
+                head->next = fifo;
+                fifo = head;
+                head = next;
+            }
+            return fifo;
+        }
+
+        RAINY_NODISCARD bool empty() const noexcept {
+            return head_.load(concurrency::memory_order_acquire) == nullptr;
+        }
+
+    private:
+        concurrency::atomic<completion_op *> head_{nullptr};
+    };
+
     template <typename Func>
     class immediate_op final : public completion_op , public handler_tracking::tracked_handler {
     public:
@@ -112,6 +220,126 @@ namespace rainy::foundation::io::implements {
         return new executor_completion_op<std::decay_t<Func>, Executor>(utility::forward<Func>(func), executor);
     }
 
+    /**
+     * @brief 提交批次统计
+     *
+     * 每次 flush 都会把当时累积的 SQE（或平台等价物）一次性交给内核，
+     * last_batch 为最近一次 flush 携带的数量，max_batch 为历史最大值。
+     */
+    struct submission_stats {
+        std::uint64_t flushes{0};
+        std::uint64_t submitted{0};
+        std::uint32_t last_batch{0};
+        std::uint32_t max_batch{0};
+    };
+
+    /**
+     * @brief io_context 构造选项
+     *
+     * 除 concurrency_hint 外的字段目前只对 io_uring 后端有意义，其余后端忽略。
+     * 内核拒绝某个标志时，后端会逐个去掉标志重试，实际生效的组合可通过 io_context::applied_options() 查询。
+     */
+    struct io_context_options {
+        int concurrency_hint{0};
+
+        /**
+         * @brief SQ 深度，0 表示按 concurrency_hint 推导
+         */
+        unsigned int queue_depth{0};
+
+        /**
+         * @brief CQ 深度，0 表示使用内核默认值（SQ 的两倍）；非 0 时不得小于 queue_depth
+         */
+        unsigned int completion_queue_depth{0};
+
+        /**
+         * @brief IORING_SETUP_SQPOLL：由内核线程轮询 SQ，提交无需系统调用
+         */
+        bool submission_polling{false};
+
+        /**
+         * @brief 内核轮询线程空闲多少毫秒后休眠，0 表示内核默认值
+         */
+        unsigned int submission_polling_idle_ms{0};
+
+        /**
+         * @brief 将内核轮询线程绑定到指定 CPU（IORING_SETUP_SQ_AFF），-1 表示不绑定
+         */
+        int submission_polling_cpu{-1};
+
+        /**
+         * @brief IORING_SETUP_COOP_TASKRUN：完成工作只在进入内核时处理，不再用 IPI 打断运行中的线程
+         */
+        bool cooperative_taskrun{false};
+
+        /**
+         * @brief IORING_SETUP_SINGLE_ISSUER：只有一个线程提交 I/O
+         *
+         * 该线程为首次提交或首次运行事件循环的线程，之后发起 I/O 必须都在该线程上进行；
+         * 其它线程仍可 post()，唤醒改走 eventfd。
+         */
+        bool single_issuer{false};
+
+        /**
+         * @brief IORING_SETUP_DEFER_TASKRUN：完成工作推迟到事件循环等待时处理，隐含 single_issuer
+         *
+         * 内核不接受与 submission_polling 同时使用，此时会被去掉。
+         */
+        bool defer_taskrun{false};
+
+        /**
+         * @brief 环的数量，大于 1 时每个调用 run() 的线程独占一个环（thread-per-core）
+         *
+         * 运行线程上发起的 I/O 与 post() 都留在本线程的环中，跨环投递经由 IORING_OP_MSG_RING。
+         * 应由 ring_count 个线程分别调用 run()，否则投递到无人运行的环上的任务不会执行。
+         */
+        unsigned int ring_count{1};
+    };
+
+    /**
+     * @brief 多发完成操作
+     *
+     * 与 executor_completion_op 不同，只要完成结果带有 op_result_more，本对象就保持存活并继续接收后续完成事件；
+     * 最后一次完成（或被取消）后自行销毁。
+     */
+    template <typename Func, typename Executor>
+    class multishot_completion_op final : public completion_op {
+    public:
+        template <typename Fx,
+                  type_traits::other_trans::enable_if_t<type_traits::type_properties::is_constructible_v<Func, Fx &&>, int> = 0>
+        explicit multishot_completion_op(Fx &&func, Executor executor) noexcept(
+            type_traits::type_properties::is_nothrow_constructible_v<Func, Fx &&>) :
+            completion_op(&do_complete), executor_(executor), func_(utility::forward<Fx>(func)) {
+            executor.on_work_started();
+        }
+
+        ~multishot_completion_op() {
+            executor_.on_work_finished();
+        }
+
+        multishot_completion_op(const multishot_completion_op &) = delete;
+        multishot_completion_op &operator=(const multishot_completion_op &) = delete;
+
+    private:
+        static void do_complete(completion_op *self, const op_result &result, bool is_cancelled) {
+            auto *op = static_cast<multishot_completion_op *>(self);
+            const bool last = is_cancelled || (result.flags & op_result_more) == 0;
+            op->func_(result, is_cancelled);
+            if (last) {
+                delete op;
+            }
+        }
+
+        Executor executor_;
+        Func func_;
+    };
+
+    template <typename Func, typename Executor>
+    RAINY_NODISCARD multishot_completion_op<std::decay_t<Func>, Executor> *make_multishot_completion_op(Func &&func,
+                                                                                                         Executor executor) {
+        return new multishot_completion_op<std::decay_t<Func>, Executor>(utility::forward<Func>(func), executor);
+    }
+
     class io_context_impl_base {
     public:
         virtual ~io_context_impl_base() = default;
@@ -195,6 +423,16 @@ namespace rainy::foundation::io::implements {
          */
         virtual void post_immediate_completion(completion_op *op, bool is_continuation) noexcept = 0;
 
+        /**
+         * @brief 将已就绪的 op 投递到指定的环，由运行该环的线程执行
+         *
+         * 只有一个环的后端忽略 ring，等同于 post_immediate_completion()。
+         */
+        virtual void post_to(std::size_t ring, completion_op *op) noexcept {
+            (void) ring;
+            post_immediate_completion(op, false);
+        }
+
         /**
          * @brief 平台专属：将一个 completion_op 与已发起的 I/O 操作关联
          *
@@ -217,12 +455,126 @@ namespace rainy::foundation::io::implements {
          */
         RAINY_NODISCARD virtual int concurrency_hint() const noexcept = 0;
 
+        /**
+         * @brief 返回实际生效的构造选项
+         *
+         * 被内核拒绝而回退掉的标志在返回值中为 false；不支持这些选项的后端只填充 concurrency_hint。
+         */
+        RAINY_NODISCARD virtual io_context_options applied_options() const noexcept {
+            io_context_options options;
+            options.concurrency_hint = concurrency_hint();
+            return options;
+        }
+
+        /**
+         * @brief 将已准备但尚未交给内核的操作立即提交
+         *
+         * 对于批量提交的后端（io_uring），事件循环会在每轮迭代末尾自动 flush，
+         * 循环外的调用方可以显式调用本函数。其余后端无需批量提交，默认实现什么也不做。
+         *
+         * @return 本次提交的操作数量
+         */
+        virtual std::size_t flush() noexcept {
+            return 0;
+        }
+
+        /**
+         * @brief 返回提交批次统计
+         */
+        RAINY_NODISCARD virtual submission_stats get_submission_stats() const noexcept {
+            return {};
+        }
+
+        /**
+         * @brief 创建由本 impl 持有的缓冲区池，供多发接收（multishot receive）使用
+         * @param buffer_count 缓冲区数量，必须为 2 的幂
+         * @param buffer_size 每个缓冲区的字节数
+         * @return 不支持内核选择缓冲区的后端返回 error
+         */
+        virtual concurrency::thrd_result setup_provided_buffers(std::size_t buffer_count, std::size_t buffer_size) noexcept {
+            (void) buffer_count;
+            (void) buffer_size;
+            return concurrency::thrd_result::error;
+        }
+
+        /**
+         * @brief 返回 setup_provided_buffers() 创建的缓冲区池，未创建时为 nullptr
+         */
+        RAINY_NODISCARD virtual provided_buffer_pool *provided_buffers() noexcept {
+            return nullptr;
+        }
+
+        /**
+         * @brief 创建稀疏的已注册文件表
+         *
+         * 创建之后，文件与套接字在首次发起异步操作时会占用表中一个槽位，后续操作以槽位号代替 fd 提交，
+         * 省去内核每次的 fd 表查找。槽位在关闭时归还。
+         *
+         * @param capacity 槽位数量
+         * @return 不支持已注册文件的后端返回 error
+         */
+        virtual concurrency::thrd_result register_files(std::size_t capacity) noexcept {
+            (void) capacity;
+            return concurrency::thrd_result::error;
+        }
+
+        /**
+         * @brief 创建并注册固定缓冲区池
+         * @param buffer_count 缓冲区数量
+         * @param buffer_size 每个缓冲区的字节数
+         * @return 不支持固定缓冲区的后端返回 error
+         */
+        virtual concurrency::thrd_result register_buffers(std::size_t buffer_count, std::size_t buffer_size) noexcept {
+            (void) buffer_count;
+            (void) buffer_size;
+            return concurrency::thrd_result::error;
+        }
+
+        /**
+         * @brief 返回 register_buffers() 创建的缓冲区池，未创建时为 nullptr
+         */
+        RAINY_NODISCARD virtual fixed_buffer_pool *fixed_buffers() noexcept {
+            return nullptr;
+        }
+
+        /**
+         * @brief 后端是否在事件循环内部驱动定时器，为 false 时 basic_waitable_timer 自行计时
+         */
+        RAINY_NODISCARD virtual bool native_timers() const noexcept {
+            return false;
+        }
+
+        /**
+         * @brief 让 op 在 deadline_ns（steady_clock 纳秒）到期时完成
+         *
+         * 同一 entry 上的等待共享到期时间，再次调度会把 entry 移到新的到期时间。已经到期的 op 立即投递。
+         *
+         * @return 不支持原生定时器的后端返回 error
+         */
+        virtual concurrency::thrd_result schedule_timer(timer_entry &entry, std::uint64_t deadline_ns, timer_op *op) noexcept {
+            (void) entry;
+            (void) deadline_ns;
+            (void) op;
+            return concurrency::thrd_result::error;
+        }
+
+        /**
+         * @brief 取消 entry 上最早发起的至多 max_count 个等待，被取消的 op 以 ECANCELED 投递
+         * @return 实际取消的数量
+         */
+        virtual std::size_t cancel_timer(timer_entry &entry, std::size_t max_count) noexcept {
+            (void) entry;
+            (void) max_count;
+            return 0;
+        }
+
     protected:
         concurrency::atomic<long> work_count_{0};
         concurrency::atomic<bool> stopped_{false};
     };
 
     RAINY_TOOLKIT_API memory::nebula_ptr<io_context_impl_base> create_io_context_impl(int concurrency_hint);
+    RAINY_TOOLKIT_API memory::nebula_ptr<io_context_impl_base> create_io_context_impl(const io_context_options &options);
 }
 
 #endif
@@ -0,0 +1,480 @@
+/*
+ * Copyright 2026 rainy-juzixiao
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef RAINY_FOUNDATION_IO_IMPLEMENTS_IO_URING_HPP
+#define RAINY_FOUNDATION_IO_IMPLEMENTS_IO_URING_HPP
+#include <rainy/foundation/io/executor/implements/io_context.hpp>
+
+#if RAINY_USING_LINUX
+#include <rainy/foundation/io/executor/implements/timer_queue.hpp>
+#include <liburing.h>
+#include <memory>
+#include <rainy/foundation/concurrency/mutex.hpp>
+#include <sys/socket.h>
+#include <sys/uio.h>
+#include <vector>
+
+namespace rainy::foundation::io::implements {
+    /**
+     * @brief 注册到 io_uring 的 provided buffer ring
+     *
+     * 多发接收通过 IOSQE_BUFFER_SELECT 让内核从本环中挑选缓冲区，
+     * 使用方归还（recycle）后缓冲区重新挂回环尾。
+     */
+    class io_uring_buffer_ring final : public provided_buffer_pool {
+    public:
+        io_uring_buffer_ring() = default;
+        ~io_uring_buffer_ring() override = default;
+
+        io_uring_buffer_ring(const io_uring_buffer_ring &) = delete;
+        io_uring_buffer_ring &operator=(const io_uring_buffer_ring &) = delete;
+
+        concurrency::thrd_result init(io_uring *ring, unsigned int count, std::size_t size, int group_id) noexcept;
+        void destroy(io_uring *ring) noexcept;
+
+        RAINY_NODISCARD void *data(std::uint32_t buffer_id) const noexcept override;
+        RAINY_NODISCARD std::size_t buffer_size() const noexcept override {
+            return size_;
+        }
+        RAINY_NODISCARD std::size_t buffer_count() const noexcept override {
+            return count_;
+        }
+        void recycle(std::uint32_t buffer_id) noexcept override;
+
+        RAINY_NODISCARD int group_id() const noexcept {
+            return group_id_;
+        }
+
+    private:
+        io_uring_buf_ring *ring_{nullptr};
+        std::unique_ptr<unsigned char[]> storage_;
+        unsigned int count_{0};
+        std::size_t size_{0};
+        int group_id_{0};
+        concurrency::mutex mutex_;
+    };
+
+    /**
+     * @brief 通过 io_uring_register_buffers 注册的固定缓冲区池
+     *
+     * 所有缓冲区位于一块按页对齐的连续内存中，index_of() 据此判断某段读写范围能否走 read_fixed / write_fixed。
+     */
+    class io_uring_fixed_buffers final : public fixed_buffer_pool {
+    public:
+        io_uring_fixed_buffers() = default;
+        ~io_uring_fixed_buffers() override;
+
+        io_uring_fixed_buffers(const io_uring_fixed_buffers &) = delete;
+        io_uring_fixed_buffers &operator=(const io_uring_fixed_buffers &) = delete;
+
+        concurrency::thrd_result init(io_uring *ring, std::size_t count, std::size_t size) noexcept;
+
+        RAINY_NODISCARD void *data(std::uint32_t index) const noexcept override;
+        RAINY_NODISCARD std::size_t buffer_size() const noexcept override {
+            return size_;
+        }
+        RAINY_NODISCARD std::size_t buffer_count() const noexcept override {
+            return count_;
+        }
+        bool acquire(std::uint32_t &index) noexcept override;
+        void release(std::uint32_t index) noexcept override;
+
+        /**
+         * @brief 查找完整包含 [ptr, ptr + len) 的缓冲区
+         * @return 缓冲区编号，不在池内时返回 -1
+         */
+        RAINY_NODISCARD int index_of(const void *ptr, std::size_t len) const noexcept;
+
+    private:
+        unsigned char *storage_{nullptr};
+        std::size_t count_{0};
+        std::size_t size_{0};
+        std::vector<std::uint32_t> free_list_;
+        concurrency::mutex mutex_;
+    };
+
+    class io_uring_impl;
+
+    /**
+     * @brief 文件 / 套接字在已注册文件表中占用的槽位
+     *
+     * 由各后端持有。apply() 在首次调用时向 ring 申请槽位，之后把 SQE 改写为以槽位号提交（IOSQE_FIXED_FILE）；
+     * 若 ring 没有已注册文件表，或操作提交到了另一个 io_context，则保持原始 fd 不变。
+     * 已注册的文件在内核中持有额外引用，因此关闭 fd 之前必须先 reset()。
+     */
+    class io_uring_file_slot {
+    public:
+        io_uring_file_slot() noexcept = default;
+
+        ~io_uring_file_slot() {
+            reset();
+        }
+
+        io_uring_file_slot(const io_uring_file_slot &) = delete;
+        io_uring_file_slot &operator=(const io_uring_file_slot &) = delete;
+
+        void apply(io_uring_impl *ring, io_uring_sqe *sqe, int fd) noexcept;
+        void reset() noexcept;
+
+        RAINY_NODISCARD bool registered() const noexcept {
+            return slot_ >= 0;
+        }
+
+    private:
+        io_uring_impl *ring_{nullptr};
+        int slot_{-1};
+        bool attempted_{false};
+    };
+
+    /**
+     * @brief Linux io_uring 后端实现
+     *
+     * 仅供 sources/posix/linux 下的各个后端（descriptor / file / socket / tls）使用。
+     * 通过 associate_handle() 之后，completion_op::io_handle 指向本对象，后端借此获取 SQE 并提交。
+     *
+     * 在事件循环线程内准备的 SQE 不会立即进入内核，而是累积到本轮循环末尾，
+     * 由 harvest() 通过 io_uring_submit_and_wait 一次性提交，从而将多次 io_uring_enter 合并为一次。
+     */
+    class io_uring_impl final : public io_context_impl_base {
+    public:
+        static constexpr std::size_t max_iovecs = 16;
+
+        /**
+         * @brief 与某个 SQE 同下标的分段表，存放 readv / writev / sendmsg 引用的 iovec 与 msghdr
+         *
+         * 内核在消费 SQE 时复制这些描述（IORING_FEAT_SUBMIT_STABLE），而该下标在被消费之前不会分配给别的 SQE，
+         * 因此不必为每个操作单独分配。name 存放 sendmsg 的目标地址副本。
+         * 这里只能存放内核在提交时读取的数据；recvmsg 的 msghdr、accept 的 addrlen 等在完成时才被回写，
+         * 而此时下标可能已被别的 SQE 复用，必须放在存活到 CQE 的 op 中。
+         */
+        struct sqe_scratch {
+            ::msghdr msg;
+            ::iovec iov[max_iovecs];
+            ::sockaddr_storage name;
+
+            /**
+             * @brief 把 buffers 的前 max_iovecs 段填入 iov，并让 msg 指向它们
+             * @return 实际填入的段数
+             */
+            template <typename Buffer>
+            std::size_t gather(const Buffer *buffers, std::size_t count) noexcept {
+                count = count < max_iovecs ? count : max_iovecs;
+                for (std::size_t i = 0; i < count; ++i) {
+                    iov[i].iov_base = const_cast<void *>(static_cast<const void *>(buffers[i].data()));
+                    iov[i].iov_len = buffers[i].size();
+                }
+                msg = {};
+                msg.msg_iov = iov;
+                msg.msg_iovlen = count;
+                return count;
+            }
+
+            /**
+             * @brief 只有一段缓冲区时的 gather
+             */
+            void gather_one(void *data, const std::size_t size) noexcept {
+                iov[0].iov_base = data;
+                iov[0].iov_len = size;
+                msg = {};
+                msg.msg_iov = iov;
+                msg.msg_iovlen = 1;
+            }
+        };
+
+        explicit io_uring_impl(int concurrency_hint) noexcept;
+        explicit io_uring_impl(const io_context_options &options) noexcept;
+
+        ~io_uring_impl() override;
+
+        concurrency::thrd_result init(int concurrency_hint) noexcept override;
+
+        /**
+         * @brief 按选项创建 io_uring 实例
+         *
+         * 内核拒绝（EINVAL / EPERM）时依次去掉 DEFER_TASKRUN、SINGLE_ISSUER、COOP_TASKRUN、SQPOLL、CQSIZE 重试，
+         * 最终生效的组合记录在 applied_options() 中。
+         */
+        concurrency::thrd_result init(const io_context_options &options) noexcept;
+        void destroy() noexcept override;
+
+        std::size_t run() override;
+        std::size_t run_one() override;
+        std::size_t run_one_for(std::uint64_t timeout_ns) override;
+        std::size_t poll() override;
+        std::size_t poll_one() override;
+
+        void stop() noexcept override;
+        void restart() noexcept override;
+        RAINY_NODISCARD bool stopped() const noexcept override;
+
+        void on_work_started() noexcept override;
+        void on_work_finished() noexcept override;
+
+        void post_immediate_completion(completion_op *op, bool is_continuation) noexcept override;
+        concurrency::thrd_result associate_handle(completion_op *op, std::uintptr_t fd, void *extra) noexcept override;
+
+        RAINY_NODISCARD bool running_in_this_thread() const noexcept override;
+        RAINY_NODISCARD int concurrency_hint() const noexcept override;
+        RAINY_NODISCARD io_context_options applied_options() const noexcept override;
+
+        std::size_t flush() noexcept override;
+        RAINY_NODISCARD submission_stats get_submission_stats() const noexcept override;
+
+        concurrency::thrd_result setup_provided_buffers(std::size_t buffer_count, std::size_t buffer_size) noexcept override;
+        RAINY_NODISCARD provided_buffer_pool *provided_buffers() noexcept override;
+
+        concurrency::thrd_result register_files(std::size_t capacity) noexcept override;
+        concurrency::thrd_result register_buffers(std::size_t buffer_count, std::size_t buffer_size) noexcept override;
+        RAINY_NODISCARD fixed_buffer_pool *fixed_buffers() noexcept override;
+
+        RAINY_NODISCARD bool native_timers() const noexcept override;
+        concurrency::thrd_result schedule_timer(timer_entry &entry, std::uint64_t deadline_ns, timer_op *op) noexcept override;
+        std::size_t cancel_timer(timer_entry &entry, std::size_t max_count) noexcept override;
+
+        /**
+         * @brief 为 fd 占用一个已注册文件槽位
+         * @return 槽位号，未调用 register_files() 或槽位耗尽时返回 -1
+         */
+        int acquire_file_slot(int fd) noexcept;
+
+        /**
+         * @brief 清空并归还槽位，内核随之释放对该文件的引用
+         */
+        void release_file_slot(int slot) noexcept;
+
+        /**
+         * @brief 查找完整包含 [ptr, ptr + len) 的固定缓冲区
+         * @return 缓冲区编号，未注册或不在池内时返回 -1
+         */
+        RAINY_NODISCARD int fixed_buffer_index(const void *ptr, std::size_t len) const noexcept {
+            return fixed_buffers_ ? fixed_buffers_->index_of(ptr, len) : -1;
+        }
+
+        /**
+         * @brief 内核是否支持 IORING_OP_SEND_ZC 与 IORING_OP_SENDMSG_ZC（6.1 起），在 init() 时探测
+         */
+        RAINY_NODISCARD bool supports_zero_copy_send() const noexcept {
+            return zero_copy_send_;
+        }
+
+        /**
+         * @brief 返回多发接收使用的缓冲区环，未通过 setup_provided_buffers() 创建时为 nullptr
+         */
+        RAINY_NODISCARD io_uring_buffer_ring *buffer_ring() noexcept {
+            return buffer_ring_.get();
+        }
+
+        /**
+         * @brief 获取一个空闲 SQE
+         *
+         * 若 SQ 已满，会先 flush() 已累积的 SQE 再重试一次。
+         *
+         * @return SQE 指针，SQ 仍然满时返回 nullptr
+         */
+        io_uring_sqe *get_sqe() noexcept;
+
+        /**
+         * @brief 提交已准备好的 SQE
+         *
+         * 在事件循环线程中调用时仅登记，等待本轮循环末尾批量提交；
+         * 在其它线程中调用时立即提交，避免阻塞中的循环永远看不到该 SQE。
+         */
+        concurrency::thrd_result submit_sqe() noexcept;
+
+        /**
+         * @brief 在 sqe 之后追加一个 IORING_OP_LINK_TIMEOUT，sqe 在 timeout_ns 内未完成时由内核取消（以 ECANCELED 完成）
+         *
+         * 必须在 sqe 准备完毕之后、submit_sqe() 之前调用，两者之间不能再获取其它 SQE。超时请求自身的完成事件由事件循环吞掉。
+         *
+         * @return SQ 已满时返回 false，sqe 不带期限照常提交
+         */
+        bool link_timeout(io_uring_sqe *sqe, std::uint64_t timeout_ns) noexcept;
+
+        /**
+         * @brief 返回 sqe 专属的分段表，见 sqe_scratch
+         */
+        sqe_scratch &scratch_for(const io_uring_sqe *sqe) noexcept {
+            return sqe_scratch_[static_cast<std::size_t>(sqe - ring_.sq.sqes)];
+        }
+
+        RAINY_NODISCARD io_uring *native_ring() noexcept {
+            return &ring_;
+        }
+
+        static io_uring_impl *from_op(const completion_op *op) noexcept {
+            return op ? static_cast<io_uring_impl *>(op->io_handle) : nullptr;
+        }
+
+        /**
+         * @brief 改用外部的工作计数与停止标志
+         *
+         * 多环实现让所有环共享同一份状态，使任何一个环上的 run() 都以整个 io_context 的工作量为退出条件。
+         */
+        void share_state(concurrency::atomic<long> *work, concurrency::atomic<bool> *stopped) noexcept {
+            work_ = work;
+            stop_flag_ = stopped;
+        }
+
+        /**
+         * @brief 通过 IORING_OP_MSG_RING 把 op 投递到另一个环，由目标环的事件循环执行
+         *
+         * 只能在本环的事件循环线程中调用。目标环拒收（例如内核不支持 MSG_RING）时 op 退回本环执行。
+         *
+         * @return 本环 SQ 已满时返回 false，op 未被接收
+         */
+        bool send_to(io_uring_impl &target, completion_op *op) noexcept;
+
+        /**
+         * @brief 唤醒阻塞在本环上的事件循环，可在任意线程调用
+         */
+        void wakeup() noexcept;
+
+    private:
+        std::size_t harvest(unsigned int wait_nr, ::__kernel_timespec *timeout);
+        std::size_t harvest_one_cqe() noexcept;
+        std::size_t drain_ready_queue();
+        std::size_t drain_ready_queue_one();
+        completion_op *take_ready_batch() noexcept;
+        void return_unrun(completion_op *chain) noexcept;
+        std::size_t run_chain(completion_op *chain);
+        std::size_t dispatch_cqes() noexcept;
+        op_result make_result(completion_op *op, const io_uring_cqe *cqe) noexcept;
+        void record_flush(unsigned int carried) noexcept;
+        bool handle_internal_cqe(const io_uring_cqe *cqe) noexcept;
+        void enable_ring() noexcept;
+        void arm_wakeup_poll() noexcept;
+        void on_wakeup_cqe(const io_uring_cqe *cqe) noexcept;
+        std::size_t expire_timers() noexcept;
+        ::__kernel_timespec *bound_wait_by_timers(::__kernel_timespec *timeout, ::__kernel_timespec &storage) noexcept;
+
+        completion_op_mpsc_queue ready_queue_;
+        // 已从 ready_queue_ 摘下但尚未执行的 op（run_one 只执行一个，或回调抛出异常），只在这种少见情况下加锁
+        concurrency::mutex backlog_mutex_;
+        completion_op *backlog_{nullptr};
+        concurrency::atomic<bool> has_backlog_{false};
+        io_uring ring_{};
+        bool ring_initialized_{false};
+        int concurrency_hint_{0};
+        int event_fd_{-1};
+        io_context_options requested_{};
+        io_context_options applied_{};
+        bool single_issuer_{false};
+        concurrency::atomic<bool> ring_disabled_{false};
+        std::unique_ptr<io_uring_buffer_ring> buffer_ring_;
+        std::unique_ptr<io_uring_fixed_buffers> fixed_buffers_;
+        concurrency::mutex file_slot_mutex_;
+        std::vector<int> free_file_slots_;
+        // 按 SQE 下标存放链式超时的时长，内核在消费该 SQE 之前不会复用同一下标
+        std::vector<::__kernel_timespec> link_timespecs_;
+        std::vector<sqe_scratch> sqe_scratch_;
+        bool files_registered_{false};
+        bool zero_copy_send_{false};
+        concurrency::atomic<std::uint64_t> flush_count_{0};
+        concurrency::atomic<std::uint64_t> submitted_sqes_{0};
+        concurrency::atomic<std::uint32_t> last_batch_{0};
+        concurrency::atomic<std::uint32_t> max_batch_{0};
+        // 时间轮只由 timer_mutex_ 保护；timer_count_ 让没有定时器时跳过加锁，
+        // wait_deadline_ns_ 为事件循环当前阻塞到的时间点，更早的定时器需要唤醒它
+        concurrency::mutex timer_mutex_;
+        timer_wheel timers_;
+        concurrency::atomic<std::size_t> timer_count_{0};
+        concurrency::atomic<std::uint64_t> wait_deadline_ns_{0};
+        concurrency::atomic<long> *work_{&work_count_};
+        concurrency::atomic<bool> *stop_flag_{&stopped_};
+        static thread_local io_uring_impl *current_loop_;
+    };
+
+    /**
+     * @brief thread-per-core 的多环 io_uring 实现
+     *
+     * 持有 ring_count 个 io_uring_impl，每个调用 run() 的线程在首次运行时认领一个环并一直使用它。
+     * 运行线程上发起的 I/O 与 post() 留在本线程的环中，因此由某个环接受的连接，其后续操作也固定在该环上；
+     * 非运行线程的 post() 轮流分配到各个环。所有环共享同一份工作计数与停止标志。
+     */
+    class io_uring_multi_impl final : public io_context_impl_base {
+    public:
+        explicit io_uring_multi_impl(const io_context_options &options) noexcept;
+
+        ~io_uring_multi_impl() override;
+
+        concurrency::thrd_result init(int concurrency_hint) noexcept override;
+        void destroy() noexcept override;
+
+        std::size_t run() override;
+        std::size_t run_one() override;
+        std::size_t run_one_for(std::uint64_t timeout_ns) override;
+        std::size_t poll() override;
+        std::size_t poll_one() override;
+
+        void stop() noexcept override;
+        void restart() noexcept override;
+        RAINY_NODISCARD bool stopped() const noexcept override;
+
+        void on_work_started() noexcept override;
+        void on_work_finished() noexcept override;
+
+        void post_immediate_completion(completion_op *op, bool is_continuation) noexcept override;
+        void post_to(std::size_t ring, completion_op *op) noexcept override;
+        concurrency::thrd_result associate_handle(completion_op *op, std::uintptr_t fd, void *extra) noexcept override;
+
+        RAINY_NODISCARD bool running_in_this_thread() const noexcept override;
+        RAINY_NODISCARD int concurrency_hint() const noexcept override;
+        RAINY_NODISCARD io_context_options applied_options() const noexcept override;
+
+        std::size_t flush() noexcept override;
+        RAINY_NODISCARD submission_stats get_submission_stats() const noexcept override;
+
+        concurrency::thrd_result setup_provided_buffers(std::size_t buffer_count, std::size_t buffer_size) noexcept override;
+        RAINY_NODISCARD provided_buffer_pool *provided_buffers() noexcept override;
+        concurrency::thrd_result register_files(std::size_t capacity) noexcept override;
+        concurrency::thrd_result register_buffers(std::size_t buffer_count, std::size_t buffer_size) noexcept override;
+        RAINY_NODISCARD fixed_buffer_pool *fixed_buffers() noexcept override;
+
+        RAINY_NODISCARD bool native_timers() const noexcept override;
+        concurrency::thrd_result schedule_timer(timer_entry &entry, std::uint64_t deadline_ns, timer_op *op) noexcept override;
+        std::size_t cancel_timer(timer_entry &entry, std::size_t max_count) noexcept override;
+
+    private:
+        /**
+         * @brief 当前线程认领的环，非运行线程返回 nullptr
+         */
+        RAINY_NODISCARD io_uring_impl *runner_ring() const noexcept;
+
+        /**
+         * @brief 当前线程认领的环，尚未认领时认领下一个
+         */
+        io_uring_impl &claim_ring() noexcept;
+
+        /**
+         * @brief 当前线程发起操作时使用的环：运行线程用自己的环，其它线程用第 0 个环
+         */
+        RAINY_NODISCARD io_uring_impl &local_ring() const noexcept;
+
+        void wakeup_all() noexcept;
+
+        template <typename Fn>
+        concurrency::thrd_result for_each_ring(Fn &&fn) noexcept;
+
+        io_context_options options_;
+        std::vector<std::unique_ptr<io_uring_impl>> rings_;
+        concurrency::atomic<std::size_t> next_runner_{0};
+        concurrency::atomic<std::size_t> next_post_{0};
+        static thread_local const io_uring_multi_impl *runner_owner_;
+        static thread_local std::size_t runner_index_;
+    };
+}
+#endif
+
+#endif
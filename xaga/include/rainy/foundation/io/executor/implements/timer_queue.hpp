@@ -0,0 +1,126 @@
+/*
+ * Copyright 2026 rainy-juzixiao
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef RAINY_FOUNDATION_IO_IMPLEMENTS_TIMER_QUEUE_HPP
+#define RAINY_FOUNDATION_IO_IMPLEMENTS_TIMER_QUEUE_HPP
+#include <rainy/foundation/io/executor/implements/io_context.hpp>
+
+namespace rainy::foundation::io::implements {
+    /**
+     * @brief 定时器等待操作的基类
+     *
+     * 正常到期时由事件循环直接 complete()；被取消时先写入 error_code，再经 post_immediate_completion 投递，
+     * 因此派生类在 do_complete 中应以 error_code 而不是 op_result 判断结果。
+     */
+    class timer_op : public completion_op {
+    public:
+        explicit timer_op(const fn_type f) noexcept : completion_op(f) {
+        }
+
+        int error_code{0};
+    };
+
+    /**
+     * @brief 一个定时器在时间轮上的节点，由 basic_waitable_timer 持有
+     *
+     * 同一定时器上的所有等待共享同一到期时间，挂在 ops_head / ops_tail 组成的链表中（经由 completion_op::next）。
+     * 节点只在存在等待时位于时间轮上。
+     */
+    struct timer_entry {
+        timer_entry *prev{nullptr};
+        timer_entry *next{nullptr};
+        std::uint64_t deadline_tick{0};
+        completion_op *ops_head{nullptr};
+        completion_op *ops_tail{nullptr};
+        io_context_impl_base *owner{nullptr}; // 首次调度时确定，多环时所有操作都转交给它
+        std::uint16_t position{no_position};
+
+        static constexpr std::uint16_t no_position = 0xFFFF;
+
+        RAINY_NODISCARD bool linked() const noexcept {
+            return position != no_position;
+        }
+    };
+
+    /**
+     * @brief 分层时间轮
+     *
+     * 每层 64 个槽，刻度 1ms，共 11 层以覆盖完整的 64 位刻度范围。节点所在的层由到期刻度与当前刻度异或后的最高位决定，
+     * 挂入与摘除都是 O(1)：只需计算层号、槽号并操作双向链表；推进时借助每层的占用位图直接跳到下一个非空槽，
+     * 空转的时间不需要逐刻度处理。
+     * 本类不加锁，由持有者负责同步。
+     */
+    class RAINY_TOOLKIT_API timer_wheel {
+    public:
+        static constexpr std::uint64_t tick_ns = 1'000'000;
+        static constexpr unsigned int slot_bits = 6;
+        static constexpr unsigned int slot_count = 1u << slot_bits;
+        static constexpr unsigned int level_count = (64 + slot_bits - 1) / slot_bits;
+        static constexpr std::uint64_t no_deadline = ~std::uint64_t{0};
+
+        explicit timer_wheel(std::uint64_t now_ns = steady_now_ns()) noexcept;
+
+        timer_wheel(const timer_wheel &) = delete;
+        timer_wheel &operator=(const timer_wheel &) = delete;
+
+        /**
+         * @brief 当前单调时钟读数（纳秒）
+         */
+        static std::uint64_t steady_now_ns() noexcept;
+
+        /**
+         * @brief 将 entry 挂到 deadline_ns（向上取整到刻度）到期，已在轮上时先摘下
+         */
+        void schedule(timer_entry &entry, std::uint64_t deadline_ns) noexcept;
+
+        /**
+         * @brief 将 entry 从轮上摘下，不在轮上时什么也不做
+         */
+        void remove(timer_entry &entry) noexcept;
+
+        /**
+         * @brief 推进到 now_ns，返回所有到期的节点
+         * @return 以 timer_entry::next 串联的链表，节点均已摘下
+         */
+        timer_entry *advance(std::uint64_t now_ns) noexcept;
+
+        /**
+         * @brief 下一次需要推进（到期或向下级联）的时间点
+         * @return 纳秒，轮为空时返回 no_deadline
+         */
+        RAINY_NODISCARD std::uint64_t next_event_ns() const noexcept;
+
+        RAINY_NODISCARD bool empty() const noexcept {
+            return size_ == 0;
+        }
+
+        RAINY_NODISCARD std::size_t size() const noexcept {
+            return size_;
+        }
+
+    private:
+        void link(timer_entry &entry) noexcept;
+        void unlink(timer_entry &entry) noexcept;
+        timer_entry *take_slot(unsigned int level, unsigned int slot) noexcept;
+        RAINY_NODISCARD std::uint64_t next_event_tick() const noexcept;
+
+        timer_entry *slots_[level_count][slot_count]{};
+        std::uint64_t occupied_[level_count]{};
+        std::uint64_t current_tick_{0};
+        std::size_t size_{0};
+    };
+}
+
+#endif
@@ -0,0 +1,264 @@
+/*
+ * Copyright 2026 rainy-juzixiao
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef RAINY_FOUNDATION_IO_EXECUTOR_USE_AWAITABLE_HPP
+#define RAINY_FOUNDATION_IO_EXECUTOR_USE_AWAITABLE_HPP
+#include <rainy/core/core.hpp>
+
+#if RAINY_HAS_CXX20
+#include <coroutine>
+#include <memory>
+#include <optional>
+#include <system_error>
+#include <tuple>
+#include <rainy/foundation/concurrency/atomic.hpp>
+#include <rainy/foundation/io/executor/async_result.hpp>
+#include <rainy/foundation/io/io_context.hpp>
+#include <rainy/foundation/memory/recycling_allocator.hpp>
+
+namespace rainy::foundation::io {
+    /**
+     * @brief 协程完成令牌
+     *
+     * 作为 async_* 的完成令牌传入时，操作照常立即发起，返回一个可 co_await 的对象；操作完成时在 io_context 的线程上恢复协程。
+     * 签名首个参数为 std::error_code 时，出错由 co_await 抛出 std::system_error；其余参数作为结果：
+     * 没有则为 void，一个则为该值，多个则为 std::tuple。
+     *
+     * 每次操作的共享状态经线程本地回收缓存分配。每个返回的对象只能 co_await 一次。
+     */
+    struct use_awaitable_t {
+        constexpr use_awaitable_t() noexcept = default;
+    };
+
+    inline constexpr use_awaitable_t use_awaitable{};
+}
+
+namespace rainy::foundation::io::implements {
+    /**
+     * @brief 处理器与等待方共享的单次操作状态，双方各持有一个引用
+     */
+    template <typename... Args>
+    class awaitable_op_state {
+    public:
+        using result_type = std::tuple<type_traits::other_trans::decay_t<Args>...>;
+
+        static awaitable_op_state *create() {
+            return ::new (static_cast<void *>(allocator_type{}.allocate(1))) awaitable_op_state();
+        }
+
+        void release() noexcept {
+            if (refs_.fetch_sub(1, concurrency::memory_order_acq_rel) == 1) {
+                this->~awaitable_op_state();
+                allocator_type{}.deallocate(this, 1);
+            }
+        }
+
+        /**
+         * @brief 由处理器调用：保存结果，等待方已挂起时就地恢复它
+         */
+        template <typename... UArgs>
+        void complete(UArgs &&...args) {
+            result_.emplace(utility::forward<UArgs>(args)...);
+            if (phase_.exchange(completed, concurrency::memory_order_acq_rel) == suspended) {
+                waiter_.resume();
+            }
+        }
+
+        RAINY_NODISCARD bool ready() const noexcept {
+            return phase_.load(concurrency::memory_order_acquire) == completed;
+        }
+
+        /**
+         * @return 操作尚未完成、协程应挂起时返回 true
+         */
+        bool suspend(const std::coroutine_handle<> waiter) noexcept {
+            waiter_ = waiter;
+            int expected = pending;
+            return phase_.compare_exchange_strong(expected, suspended, concurrency::memory_order_acq_rel,
+                                                  concurrency::memory_order_acquire);
+        }
+
+        result_type &result() noexcept {
+            return *result_;
+        }
+
+    private:
+        using allocator_type =
+            memory::recycling_allocator<awaitable_op_state, concurrency::implements::thread_info_base::awaitable_frame_tag>;
+
+        enum : int {
+            pending,
+            suspended,
+            completed
+        };
+
+        awaitable_op_state() = default;
+
+        concurrency::atomic<int> phase_{pending};
+        concurrency::atomic<int> refs_{2};
+        std::coroutine_handle<> waiter_;
+        std::optional<result_type> result_;
+    };
+
+    /**
+     * @brief use_awaitable 对应的完成处理器，可被复制，但整个操作只会调用其中一份一次
+     */
+    template <typename... Args>
+    class awaitable_handler {
+    public:
+        using state_type = awaitable_op_state<Args...>;
+
+        explicit awaitable_handler(const use_awaitable_t &) : state_(state_type::create()) {
+        }
+
+        void operator()(Args... args) {
+            state_type *state = state_;
+            state->complete(static_cast<Args &&>(args)...);
+            state->release();
+        }
+
+        RAINY_NODISCARD state_type *state() const noexcept {
+            return state_;
+        }
+
+    private:
+        state_type *state_;
+    };
+
+    template <typename... Args>
+    struct awaitable_result_traits {
+        static constexpr std::size_t offset = 0;
+    };
+
+    template <typename... Rest>
+    struct awaitable_result_traits<std::error_code, Rest...> {
+        static constexpr std::size_t offset = 1;
+    };
+
+    /**
+     * @brief co_await 一个以 use_awaitable 发起的操作
+     */
+    template <typename... Args>
+    class RAINY_NODISCARD op_awaitable {
+    public:
+        using state_type = awaitable_op_state<Args...>;
+
+        explicit op_awaitable(state_type *state) noexcept : state_(state) {
+        }
+
+        op_awaitable(op_awaitable &&other) noexcept : state_(std::exchange(other.state_, nullptr)) {
+        }
+
+        op_awaitable(const op_awaitable &) = delete;
+        op_awaitable &operator=(const op_awaitable &) = delete;
+        op_awaitable &operator=(op_awaitable &&) = delete;
+
+        ~op_awaitable() {
+            if (state_) {
+                state_->release();
+            }
+        }
+
+        RAINY_NODISCARD bool await_ready() const noexcept {
+            return state_->ready();
+        }
+
+        bool await_suspend(const std::coroutine_handle<> waiter) noexcept {
+            return state_->suspend(waiter);
+        }
+
+        decltype(auto) await_resume() {
+            constexpr std::size_t offset = awaitable_result_traits<type_traits::other_trans::decay_t<Args>...>::offset;
+            auto &result = state_->result();
+            if constexpr (offset == 1) {
+                if (const std::error_code &ec = std::get<0>(result)) {
+                    throw std::system_error(ec);
+                }
+            }
+            return take(result, std::make_index_sequence<sizeof...(Args) - offset>{});
+        }
+
+    private:
+        template <typename Tuple, std::size_t... I>
+        static auto take(Tuple &result, std::index_sequence<I...>) {
+            constexpr std::size_t offset = sizeof...(Args) - sizeof...(I);
+            if constexpr (sizeof...(I) == 0) {
+                (void) result;
+            } else if constexpr (sizeof...(I) == 1) {
+                return utility::move(std::get<offset + I...>(result));
+            } else {
+                return std::tuple<std::tuple_element_t<offset + I, Tuple>...>{utility::move(std::get<offset + I>(result))...};
+            }
+        }
+
+        state_type *state_;
+    };
+
+    /**
+     * @brief co_await schedule_on(ctx) 把协程的后续部分投递到 io_context 上执行
+     */
+    class io_context_schedule_awaitable {
+    public:
+        explicit io_context_schedule_awaitable(io_context &ctx) noexcept : ctx_(&ctx) {
+        }
+
+        static constexpr bool await_ready() noexcept {
+            return false;
+        }
+
+        void await_suspend(const std::coroutine_handle<> waiter) const {
+            ctx_->get_executor().post([waiter] { waiter.resume(); }, std::allocator<void>{});
+        }
+
+        static constexpr void await_resume() noexcept {
+        }
+
+    private:
+        io_context *ctx_;
+    };
+}
+
+namespace rainy::foundation::io {
+    template <typename Result, typename... Args>
+    class async_result<use_awaitable_t, Result(Args...)> {
+    public:
+        using completion_handler_type = implements::awaitable_handler<Args...>;
+        using return_type = implements::op_awaitable<Args...>;
+
+        explicit async_result(completion_handler_type &handler) : state_(handler.state()) {
+        }
+
+        async_result(const async_result &) = delete;
+        async_result &operator=(const async_result &) = delete;
+
+        return_type get() {
+            return return_type{state_};
+        }
+
+    private:
+        implements::awaitable_op_state<Args...> *state_;
+    };
+
+    /**
+     * @brief 在 ctx 的线程上继续执行当前协程
+     */
+    inline implements::io_context_schedule_awaitable schedule_on(io_context &ctx) noexcept {
+        return implements::io_context_schedule_awaitable{ctx};
+    }
+}
+
+#endif
+
+#endif
@@ -107,6 +107,12 @@ namespace rainy::foundation::io::filesystem {
             return n;
         }
 
+        /**
+         * @brief  在偏移 offset 处异步读取
+         *
+         * buf 可以是单个缓冲区，也可以是 mutable_buffer 序列；后者以一次 readv 填充（最多 16 段），
+         * 处理器签名为 void(std::error_code, std::size_t)。
+         */
         template <typename MutableBufferSequence, typename Handler>
         void async_read_some_at(std::uint64_t offset, const MutableBufferSequence &buf, Handler &&handler) {
             auto *op = io::implements::make_executor_completion_op(
@@ -123,9 +129,15 @@ namespace rainy::foundation::io::filesystem {
                     h(ec, res.bytes_transferred);
                 },
                 ctx_->get_executor());
-            impl_->async_read_some_at(buffer(buf), offset, ctx_->get_executor(), op);
+            const io::implements::buffer_sequence_array<mutable_buffer> segments(buf);
+            impl_->async_readv_at(segments.data(), segments.size(), offset, ctx_->get_executor(), op);
         }
 
+        /**
+         * @brief  在偏移 offset 处异步写入，const_buffer 序列以一次 writev 发出（最多 16 段）
+         *
+         * 例如先写记录头再写负载时，不必先把两者拼接到临时缓冲区。
+         */
         template <typename ConstBufferSequence, typename Handler>
         void async_write_some_at(std::uint64_t offset, const ConstBufferSequence &buf, Handler &&handler) {
             auto *op = io::implements::make_executor_completion_op(
@@ -142,7 +154,40 @@ namespace rainy::foundation::io::filesystem {
                     h(ec, res.bytes_transferred);
                 },
                 ctx_->get_executor());
-            impl_->async_write_some_at(buffer(buf), offset, ctx_->get_executor(), op);
+            const io::implements::buffer_sequence_array<const_buffer> segments(buf);
+            impl_->async_writev_at(segments.data(), segments.size(), offset, ctx_->get_executor(), op);
+        }
+
+        /**
+         * @brief  写入后刷盘（fdatasync），两者作为一个依赖链发起
+         *
+         * 处理器只调用一次，签名为 void(std::error_code, std::size_t)；写入不足时不会刷盘，需对剩余部分再次调用。
+         */
+        template <typename ConstBufferSequence, typename Handler>
+        void async_write_some_at_and_sync(std::uint64_t offset, const ConstBufferSequence &buf, Handler &&handler) {
+            auto *op = io::implements::make_executor_completion_op(
+                [h = utility::forward<Handler>(handler), is_open = impl_->is_open()](const implements::op_result &res,
+                                                                                     bool cancelled) mutable {
+                    std::error_code ec;
+                    if (cancelled) {
+                        ec = std::make_error_code(std::errc::operation_canceled);
+                    } else if (res.error_code) {
+                        ec = std::error_code{res.error_code, std::system_category()};
+                    } else if (!is_open) {
+                        ec = std::make_error_code(std::errc::bad_file_descriptor);
+                    }
+                    h(ec, res.bytes_transferred);
+                },
+                ctx_->get_executor());
+            impl_->async_write_some_at_and_sync(buffer(buf), offset, ctx_->get_executor(), op);
+        }
+
+        /**
+         * @brief  同步刷盘
+         * @param  data_only  为 true 时只保证数据落盘
+         */
+        std::error_code sync(const bool data_only = false) noexcept {
+            return impl_->sync(data_only);
         }
 
         RAINY_NODISCARD std::uint64_t size() const {
@@ -67,10 +67,55 @@ namespace rainy::foundation::io::filesystem::implements {
         virtual void async_write_some_at(const_buffer buf, std::uint64_t offset, io_context::executor_type executor,
                                          completion_op *op) noexcept = 0;
 
+        /**
+         * @brief  分散读 / 聚集写：一次请求覆盖 count 个缓冲区，数据在文件中从 offset 起连续排列
+         *
+         * count 不超过 1 时等同于 async_read_some_at / async_write_some_at；io_uring 后端把多段映射为 IORING_OP_READV / IORING_OP_WRITEV。
+         * 默认实现只处理第一个缓冲区（*_some 操作本就允许部分完成），由调用方对剩余部分再次发起。
+         */
+        virtual void async_readv_at(const mutable_buffer *buffers, std::size_t count, std::uint64_t offset,
+                                    io_context::executor_type executor, completion_op *op) noexcept {
+            async_read_some_at(count != 0 ? buffers[0] : mutable_buffer{}, offset, executor, op);
+        }
+
+        virtual void async_writev_at(const const_buffer *buffers, std::size_t count, std::uint64_t offset,
+                                     io_context::executor_type executor, completion_op *op) noexcept {
+            async_write_some_at(count != 0 ? buffers[0] : const_buffer{}, offset, executor, op);
+        }
+
         RAINY_NODISCARD virtual std::uint64_t size(std::error_code &ec) const noexcept = 0;
 
         virtual std::error_code resize(std::uint64_t new_size) noexcept = 0;
 
+        /**
+         * @brief  同步刷盘
+         * @param  data_only  为 true 时只保证数据落盘（fdatasync），不强制刷新无关的元数据
+         */
+        virtual std::error_code sync(bool data_only) noexcept = 0;
+
+        /**
+         * @brief  写入后刷盘，两者作为一个依赖链发起
+         *
+         * op 只完成一次：写入失败时报告写入的错误；写入完整时报告刷盘的结果，bytes_transferred 始终为写入的字节数。
+         * 写入不足 buf.size() 时不会刷盘，调用方应对剩余部分再次调用。
+         * 默认实现在写入完成的回调中同步调用 sync()，io_uring 后端以 IOSQE_IO_LINK 把 write 与 fdatasync 一次提交。
+         */
+        virtual void async_write_some_at_and_sync(const_buffer buf, std::uint64_t offset, io_context::executor_type executor,
+                                                  completion_op *op) noexcept {
+            const std::size_t expected = buf.size();
+            auto *write_op = io::implements::make_executor_completion_op(
+                [this, op, expected](const op_result &res, const bool cancelled) {
+                    op_result result = res;
+                    result.user_data = op;
+                    if (!cancelled && res.error_code == 0 && res.bytes_transferred == expected) {
+                        result.error_code = sync(true).value();
+                    }
+                    op->complete(result, cancelled);
+                },
+                executor);
+            async_write_some_at(buf, offset, executor, write_op);
+        }
+
         RAINY_NODISCARD virtual std::uintptr_t native_handle() const noexcept = 0;
     };
 
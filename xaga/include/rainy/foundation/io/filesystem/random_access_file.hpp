@@ -136,6 +136,29 @@ namespace rainy::foundation::io::filesystem {
                                       utility::forward<Handler>(handler));
         }
 
+        /**
+         * @brief  在指定偏移处异步写入并刷盘，适合日志追加等需要持久化确认的场景
+         *
+         * @param  offset   文件偏移（字节）
+         * @param  buf      源缓冲区序列
+         * @param  handler  完成回调，签名须为 void(std::error_code, std::size_t)，仅在数据落盘（或出错）后调用一次
+         */
+        template <typename ConstBufferSequence, typename Handler>
+        void async_write_some_at_and_sync(std::uint64_t offset,
+                                          const ConstBufferSequence &buf,
+                                          Handler &&handler) {
+            file_.async_write_some_at_and_sync(offset, buf,
+                                               utility::forward<Handler>(handler));
+        }
+
+        /**
+         * @brief  同步刷盘
+         * @param  data_only  为 true 时只保证数据落盘
+         */
+        std::error_code sync(bool data_only = false) noexcept {
+            return file_.sync(data_only);
+        }
+
         /**
          * @brief  返回文件字节大小（抛出异常版本）
          */
@@ -20,6 +20,8 @@
 #include <rainy/foundation/io/executor.hpp>
 
 namespace rainy::foundation::io {
+    class fixed_buffer;
+
     class RAINY_TOOLKIT_API io_context : public execution_context {
     public:
         class RAINY_TOOLKIT_API executor_type {
@@ -89,6 +91,7 @@ namespace rainy::foundation::io {
         };
 
         using count_type = std::size_t;
+        using options_type = implements::io_context_options;
 
         io_context();
 
@@ -96,6 +99,13 @@ namespace rainy::foundation::io {
 
         explicit io_context(int concurrency_hint);
 
+        /**
+         * @brief 按选项构造，可请求 SQPOLL、COOP_TASKRUN、SINGLE_ISSUER / DEFER_TASKRUN 与自定义队列深度
+         *
+         * 内核拒绝的标志会被逐个去掉，不会导致构造失败，实际生效的组合见 applied_options()。
+         */
+        explicit io_context(const options_type &options);
+
         io_context(const io_context &) = delete;
 
         io_context &operator=(const io_context &) = delete;
@@ -149,9 +159,228 @@ namespace rainy::foundation::io {
         bool stopped() const noexcept;
         void restart();
 
+        /**
+         * @brief 立即提交事件循环中累积的 I/O 操作
+         * @return 本次提交的操作数量
+         */
+        count_type flush();
+
+        /**
+         * @brief 获取提交批次统计（每次 flush 携带多少个操作）
+         */
+        RAINY_NODISCARD implements::submission_stats submission_stats() const noexcept;
+
+        /**
+         * @brief 获取实际生效的构造选项
+         */
+        RAINY_NODISCARD options_type applied_options() const noexcept;
+
+        /**
+         * @brief 在指定环的运行线程上执行 f
+         *
+         * 多环（ring_count > 1）时，f 中发起的 I/O 会固定在该环上，可用于把接受到的连接分发给其它核心；
+         * 单环时等同于 post()。
+         */
+        template <typename Func>
+        void post_to_ring(const std::size_t ring, Func &&f) {
+            auto *op = implements::make_immediate_op(utility::forward<Func>(f));
+            impl_->post_to(ring, op);
+        }
+
+        /**
+         * @brief 创建由 io_context 持有的缓冲区池，供多发接收（multishot receive）挑选缓冲区
+         * @param buffer_count 缓冲区数量，必须为 2 的幂
+         * @param buffer_size 每个缓冲区的字节数
+         * @return 后端不支持时返回 operation_not_supported，重复创建时返回 device_or_resource_busy
+         */
+        std::error_code setup_provided_buffers(std::size_t buffer_count, std::size_t buffer_size) noexcept;
+
+        /**
+         * @brief 创建稀疏的已注册文件表
+         *
+         * 之后在本 io_context 上发起异步操作的 random_access_file 与流套接字会自动占用一个槽位，
+         * 以 IOSQE_FIXED_FILE 提交，关闭时归还。槽位耗尽时退回普通 fd。
+         *
+         * @param capacity 槽位数量
+         * @return 后端不支持时返回 operation_not_supported，重复创建时返回 device_or_resource_busy
+         */
+        std::error_code register_files(std::size_t capacity) noexcept;
+
+        /**
+         * @brief 创建并注册固定缓冲区池
+         *
+         * 读写范围落在通过 acquire_fixed_buffer() 借出的缓冲区内时，后端自动改用 read_fixed / write_fixed。
+         *
+         * @param buffer_count 缓冲区数量
+         * @param buffer_size 每个缓冲区的字节数
+         * @return 后端不支持时返回 operation_not_supported，重复创建时返回 device_or_resource_busy
+         */
+        std::error_code register_buffers(std::size_t buffer_count, std::size_t buffer_size) noexcept;
+
+        /**
+         * @brief 从固定缓冲区池借出一个缓冲区
+         * @return 未调用 register_buffers() 或池已耗尽时返回空对象
+         */
+        RAINY_NODISCARD fixed_buffer acquire_fixed_buffer() noexcept;
+
+        /**
+         * @brief 后端是否在事件循环中驱动定时器（io_uring 为 true）
+         */
+        RAINY_NODISCARD bool native_timers() const noexcept;
+
+        /**
+         * @brief 供 basic_waitable_timer 使用：让 op 在 deadline_ns（steady_clock 纳秒）到期时完成
+         * @return 后端不支持原生定时器时返回 operation_not_supported
+         */
+        std::error_code schedule_timer(implements::timer_entry &entry, std::uint64_t deadline_ns, implements::timer_op *op) noexcept;
+
+        /**
+         * @brief 取消 entry 上至多 max_count 个等待，被取消的处理器收到 operation_canceled
+         * @return 实际取消的数量
+         */
+        std::size_t cancel_timer(implements::timer_entry &entry, std::size_t max_count) noexcept;
+
     private:
         memory::nebula_ptr<implements::io_context_impl_base> impl_;
     };
+
+    /**
+     * @brief 从 io_context 缓冲区池中借出的缓冲区
+     *
+     * 多发接收的每次完成都会借出一个缓冲区，对象析构或调用 release() 时归还给池。
+     * 在归还之前，内核不会再次使用这块内存，因此持有时间越长，池中可用的缓冲区越少。
+     */
+    class borrowed_buffer {
+    public:
+        borrowed_buffer() noexcept = default;
+
+        borrowed_buffer(implements::provided_buffer_pool *pool, const std::uint32_t buffer_id, const std::size_t size) noexcept :
+            pool_(pool), buffer_id_(buffer_id), size_(size) {
+        }
+
+        borrowed_buffer(borrowed_buffer &&right) noexcept :
+            pool_(utility::exchange(right.pool_, nullptr)), buffer_id_(right.buffer_id_), size_(utility::exchange(right.size_, 0)) {
+        }
+
+        borrowed_buffer &operator=(borrowed_buffer &&right) noexcept {
+            if (this != &right) {
+                release();
+                pool_ = utility::exchange(right.pool_, nullptr);
+                buffer_id_ = right.buffer_id_;
+                size_ = utility::exchange(right.size_, 0);
+            }
+            return *this;
+        }
+
+        borrowed_buffer(const borrowed_buffer &) = delete;
+        borrowed_buffer &operator=(const borrowed_buffer &) = delete;
+
+        ~borrowed_buffer() {
+            release();
+        }
+
+        RAINY_NODISCARD void *data() noexcept {
+            return pool_ ? pool_->data(buffer_id_) : nullptr;
+        }
+
+        RAINY_NODISCARD const void *data() const noexcept {
+            return pool_ ? pool_->data(buffer_id_) : nullptr;
+        }
+
+        RAINY_NODISCARD std::size_t size() const noexcept {
+            return size_;
+        }
+
+        RAINY_NODISCARD bool empty() const noexcept {
+            return size_ == 0;
+        }
+
+        explicit operator bool() const noexcept {
+            return pool_ != nullptr;
+        }
+
+        /**
+         * @brief 提前将缓冲区归还给池，之后 data() 返回 nullptr
+         */
+        void release() noexcept {
+            if (pool_) {
+                pool_->recycle(buffer_id_);
+                pool_ = nullptr;
+                size_ = 0;
+            }
+        }
+
+    private:
+        implements::provided_buffer_pool *pool_{nullptr};
+        std::uint32_t buffer_id_{0};
+        std::size_t size_{0};
+    };
+
+    /**
+     * @brief 从 io_context 固定缓冲区池中借出的缓冲区
+     *
+     * 将数据写入 data() 后以 buffer(data(), n) 发起读写即可命中 read_fixed / write_fixed。
+     * 对象析构或调用 release() 时归还给池，因此必须保证其存活到使用它的异步操作完成。
+     */
+    class fixed_buffer {
+    public:
+        fixed_buffer() noexcept = default;
+
+        fixed_buffer(implements::fixed_buffer_pool *pool, const std::uint32_t index) noexcept : pool_(pool), index_(index) {
+        }
+
+        fixed_buffer(fixed_buffer &&right) noexcept : pool_(utility::exchange(right.pool_, nullptr)), index_(right.index_) {
+        }
+
+        fixed_buffer &operator=(fixed_buffer &&right) noexcept {
+            if (this != &right) {
+                release();
+                pool_ = utility::exchange(right.pool_, nullptr);
+                index_ = right.index_;
+            }
+            return *this;
+        }
+
+        fixed_buffer(const fixed_buffer &) = delete;
+        fixed_buffer &operator=(const fixed_buffer &) = delete;
+
+        ~fixed_buffer() {
+            release();
+        }
+
+        RAINY_NODISCARD void *data() noexcept {
+            return pool_ ? pool_->data(index_) : nullptr;
+        }
+
+        RAINY_NODISCARD const void *data() const noexcept {
+            return pool_ ? pool_->data(index_) : nullptr;
+        }
+
+        /**
+         * @brief 缓冲区容量（字节）
+         */
+        RAINY_NODISCARD std::size_t size() const noexcept {
+            return pool_ ? pool_->buffer_size() : 0;
+        }
+
+        explicit operator bool() const noexcept {
+            return pool_ != nullptr;
+        }
+
+        /**
+         * @brief 提前将缓冲区归还给池，之后 data() 返回 nullptr
+         */
+        void release() noexcept {
+            if (pool_) {
+                pool_->release(index_);
+                pool_ = nullptr;
+            }
+        }
+
+    private:
+        implements::fixed_buffer_pool *pool_{nullptr};
+        std::uint32_t index_{0};
+    };
 }
 
 #endif
@@ -18,6 +18,7 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <rainy/foundation/io/buffer.hpp>
 #include <rainy/foundation/io/io_context.hpp>
 #include <system_error>
 
@@ -47,6 +48,9 @@ namespace rainy::foundation::io::net::implements {
     static constexpr message_flags_t msg_out_of_band = 0x02;
     static constexpr message_flags_t msg_do_not_route = 0x04;
 
+    // async_send 自动改用零拷贝发送的默认长度下限；更小的数据复制进内核反而更便宜
+    static constexpr std::size_t default_zero_copy_threshold = 64 * 1024;
+
     struct raw_endpoint {
         std::uint8_t data[128]{};
         std::size_t size{0};
@@ -145,9 +149,109 @@ namespace rainy::foundation::io::net::implements {
 
         virtual std::error_code io_control(unsigned long cmd, void *arg) noexcept = 0;
 
+        /**
+         * @brief 多发 accept：提交一次，每接受一个连接产生一次完成，bytes_transferred 为新连接的句柄
+         *
+         * 只要完成结果带有 op_result_more，op 就会继续接收后续连接。
+         * 默认实现报告 operation_not_supported，由支持的后端（io_uring）覆盖。
+         */
+        virtual void async_accept_multishot(io_context::executor_type executor, completion_op *op) noexcept {
+            (void) executor;
+            op->complete(io::implements::op_result{op, 0, static_cast<int>(std::errc::operation_not_supported)}, false);
+        }
+
+        /**
+         * @brief 多发接收：提交一次，每次数据到达产生一次完成，数据位于 io_context 的缓冲区池中
+         *
+         * 要求事先调用 io_context::setup_provided_buffers()，否则以 no_buffer_space 完成。
+         * 默认实现报告 operation_not_supported，由支持的后端（io_uring）覆盖。
+         */
+        virtual void async_receive_multishot(message_flags_t flags, io_context::executor_type executor,
+                                             completion_op *op) noexcept {
+            (void) flags;
+            (void) executor;
+            op->complete(io::implements::op_result{op, 0, static_cast<int>(std::errc::operation_not_supported)}, false);
+        }
+
+        /**
+         * @brief 带相对期限的 async_connect / async_send / async_receive
+         *
+         * 操作在 timeout_ns 内未完成时以 ECANCELED 完成（op 的 is_cancelled 为 true）。
+         * io_uring 后端以链接的 IORING_OP_LINK_TIMEOUT 实现，不需要额外的定时器；
+         * 默认实现忽略期限，直接发起普通操作。
+         */
+        virtual void async_connect_for(const raw_endpoint &ep, std::uint64_t timeout_ns, io_context::executor_type executor,
+                                       completion_op *op) noexcept {
+            (void) timeout_ns;
+            async_connect(ep, executor, op);
+        }
+
+        virtual void async_send_for(const void *buf, std::size_t len, message_flags_t flags, std::uint64_t timeout_ns,
+                                    io_context::executor_type executor, completion_op *op) noexcept {
+            (void) timeout_ns;
+            async_send(buf, len, flags, executor, op);
+        }
+
+        virtual void async_receive_for(void *buf, std::size_t len, message_flags_t flags, std::uint64_t timeout_ns,
+                                       io_context::executor_type executor, completion_op *op) noexcept {
+            (void) timeout_ns;
+            async_receive(buf, len, flags, executor, op);
+        }
+
+        /**
+         * @brief 聚集发送 / 分散接收，count 不超过 1 时等同于 async_send(_for) / async_receive(_for)
+         *
+         * timeout_ns 为 0 表示不设期限。io_uring 后端以一次 sendmsg / recvmsg 提交全部分段，
+         * 默认实现只处理第一个缓冲区（send / receive 本就允许部分完成）。
+         */
+        virtual void async_sendv(const const_buffer *buffers, std::size_t count, message_flags_t flags, std::uint64_t timeout_ns,
+                                 io_context::executor_type executor, completion_op *op) noexcept {
+            const const_buffer first = count != 0 ? buffers[0] : const_buffer{};
+            if (timeout_ns != 0) {
+                async_send_for(first.data(), first.size(), flags, timeout_ns, executor, op);
+            } else {
+                async_send(first.data(), first.size(), flags, executor, op);
+            }
+        }
+
+        virtual void async_receivev(const mutable_buffer *buffers, std::size_t count, message_flags_t flags, std::uint64_t timeout_ns,
+                                    io_context::executor_type executor, completion_op *op) noexcept {
+            const mutable_buffer first = count != 0 ? buffers[0] : mutable_buffer{};
+            if (timeout_ns != 0) {
+                async_receive_for(first.data(), first.size(), flags, timeout_ns, executor, op);
+            } else {
+                async_receive(first.data(), first.size(), flags, executor, op);
+            }
+        }
+
+        /**
+         * @brief 零拷贝发送：内核直接引用调用方的页面，不再复制数据
+         *
+         * 完成分两步，发送结果之后内核再投递一个通知事件，表示页面已不再被引用；op 要等到通知到达才完成，
+         * 因此处理器被调用时缓冲区即可释放或复用。count 大于 1 时以 sendmsg 聚集发送。
+         * 默认实现退化为普通 async_send，只发送第一个缓冲区（send 本就允许部分完成）。
+         */
+        virtual void async_send_zero_copy(const const_buffer *buffers, std::size_t count, message_flags_t flags,
+                                          io_context::executor_type executor, completion_op *op) noexcept {
+            const const_buffer first = count != 0 ? buffers[0] : const_buffer{};
+            async_send(first.data(), first.size(), flags, executor, op);
+        }
+
+        /**
+         * @brief async_send 数据长度达到 bytes 时自动改用零拷贝发送，0 表示关闭；不支持零拷贝的后端忽略该值
+         */
+        void zero_copy_threshold(const std::size_t bytes) noexcept {
+            zero_copy_threshold_ = bytes;
+        }
+
+        RAINY_NODISCARD std::size_t zero_copy_threshold() const noexcept {
+            return zero_copy_threshold_;
+        }
+
     protected:
         bool non_blocking_{false};
         bool native_non_blocking_{false};
+        std::size_t zero_copy_threshold_{default_zero_copy_threshold};
     };
 
     RAINY_TOOLKIT_API memory::nebula_ptr<socket_impl_base> create_socket_impl();
@@ -16,6 +16,7 @@
 #ifndef RAINY_FOUNDATION_IO_NET_SOCKET_HPP
 #define RAINY_FOUNDATION_IO_NET_SOCKET_HPP
 
+#include <chrono>
 #include <rainy/foundation/io/buffer.hpp>
 #include <rainy/foundation/io/executor/async_result.hpp>
 #include <rainy/foundation/io/io_context.hpp>
@@ -36,7 +37,8 @@ namespace rainy::foundation::io::net::implements {
 namespace rainy::foundation::io::net {
     enum class socket_errc : int {
         already_open = 1,
-        not_found = 2
+        not_found = 2,
+        end_of_stream = 3
     };
 
     class socket_error_category : public std::error_category {
@@ -51,6 +53,8 @@ namespace rainy::foundation::io::net {
                     return "socket already open";
                 case socket_errc::not_found:
                     return "socket not found";
+                case socket_errc::end_of_stream:
+                    return "end of stream";
                 default:
                     return "unknown socket error";
             }
@@ -70,6 +74,18 @@ namespace rainy::foundation::io::net {
         return {static_cast<int>(e), socket_category()};
     }
 
+    /**
+     * @brief 多发（multishot）模式标记
+     *
+     * 传给 async_accept / async_receive 后，一次发起的操作会为每个连接或每段数据重复调用处理器，
+     * 直到出错、被取消或套接字关闭。
+     */
+    struct multishot_t {
+        explicit multishot_t() = default;
+    };
+
+    inline constexpr multishot_t multishot{};
+
     class socket_base {
     public:
         template <int Level, int Name, typename Ty>
@@ -394,33 +410,16 @@ namespace rainy::foundation::io::net {
         template <typename CompletionToken>
         auto async_connect(const endpoint_type &ep, CompletionToken &&token) ->
             typename async_result<std::decay_t<CompletionToken>, void(std::error_code)>::return_type { // NOLINT
-            using token_t = std::decay_t<CompletionToken>;
-            async_completion<token_t, void(std::error_code)> init(token);
-            auto handler = utility::move(init.completion_handler);
-            if (!impl_->is_open()) {
-                auto proto = ep.protocol();
-                if (std::error_code open_ec = impl_->open(proto.family(), proto.type(), proto.protocol())) {
-                    io::post(this->get_executor(), [handler, open_ec]() mutable -> void { handler(open_ec); });
-                    return init.result.get();
-                }
-            }
-            auto raw_ep = ep.to_raw();
-            auto *op = io::implements::make_executor_completion_op(
-                [handler, this, is_open = this->impl_->is_open()](const io::implements::op_result &r, const bool cancelled) mutable {
-                    std::error_code ec;
-                    if (cancelled) {
-                        ec = std::make_error_code(std::errc::operation_canceled);
-                    } else if (r.error_code) {
-                        ec = std::error_code{r.error_code, std::system_category()};
-                    } else if (!is_open) {
-                        ec = std::make_error_code(std::errc::bad_file_descriptor);
-                    }
-                    handler(ec);
-                },
-                executor_);
-            executor_.on_work_started();
-            impl_->async_connect(raw_ep, executor_.context().get_executor(), op);
-            return init.result.get();
+            return start_connect(ep, 0, utility::forward<CompletionToken>(token));
+        }
+
+        /**
+         * @brief 带期限的异步连接，timeout 内未完成时处理器收到 std::errc::timed_out
+         */
+        template <typename Rep, typename Period, typename CompletionToken>
+        auto async_connect(const endpoint_type &ep, const std::chrono::duration<Rep, Period> &timeout, CompletionToken &&token) ->
+            typename async_result<std::decay_t<CompletionToken>, void(std::error_code)>::return_type { // NOLINT
+            return start_connect(ep, to_timeout_ns(timeout), utility::forward<CompletionToken>(token));
         }
 
         void wait(const wait_type w) {
@@ -514,6 +513,60 @@ namespace rainy::foundation::io::net {
             }
         }
 
+        template <typename CompletionToken>
+        auto start_connect(const endpoint_type &ep, const std::uint64_t timeout_ns, CompletionToken &&token) ->
+            typename async_result<std::decay_t<CompletionToken>, void(std::error_code)>::return_type { // NOLINT
+            using token_t = std::decay_t<CompletionToken>;
+            async_completion<token_t, void(std::error_code)> init(token);
+            auto handler = utility::move(init.completion_handler);
+            if (!impl_->is_open()) {
+                auto proto = ep.protocol();
+                if (std::error_code open_ec = impl_->open(proto.family(), proto.type(), proto.protocol())) {
+                    io::post(this->get_executor(), [handler, open_ec]() mutable -> void { handler(open_ec); });
+                    return init.result.get();
+                }
+            }
+            auto raw_ep = ep.to_raw();
+            auto *op = io::implements::make_executor_completion_op(
+                [handler, timeout_ns, is_open = this->impl_->is_open()](const io::implements::op_result &r, const bool cancelled) mutable {
+                    handler(make_completion_error(r, cancelled, timeout_ns != 0, is_open));
+                },
+                executor_);
+            executor_.on_work_started();
+            if (timeout_ns != 0) {
+                impl_->async_connect_for(raw_ep, timeout_ns, executor_.context().get_executor(), op);
+            } else {
+                impl_->async_connect(raw_ep, executor_.context().get_executor(), op);
+            }
+            return init.result.get();
+        }
+
+        /**
+         * @brief 将操作结果转换为交给处理器的错误码，带期限的操作被取消时报告 timed_out
+         */
+        static std::error_code make_completion_error(const io::implements::op_result &r, const bool cancelled, const bool has_deadline,
+                                                     const bool is_open) noexcept {
+            if (cancelled) {
+                return std::make_error_code(has_deadline ? std::errc::timed_out : std::errc::operation_canceled);
+            }
+            if (r.error_code) {
+                return std::error_code{r.error_code, std::system_category()};
+            }
+            if (!is_open) {
+                return std::make_error_code(std::errc::bad_file_descriptor);
+            }
+            return {};
+        }
+
+        /**
+         * @brief 把期限换算为纳秒，0 表示不设期限，因此非正的期限按 1ns 处理（立即超时）
+         */
+        template <typename Rep, typename Period>
+        static std::uint64_t to_timeout_ns(const std::chrono::duration<Rep, Period> &timeout) noexcept {
+            const auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(timeout).count();
+            return ns > 0 ? static_cast<std::uint64_t>(ns) : 1;
+        }
+
         executor_type executor_;
         protocol_type protocol_;
         memory::nebula_ptr<implements::socket_impl_base> impl_;
@@ -920,25 +973,26 @@ namespace rainy::foundation::io::net {
         template <typename MutableBufferSequence, typename CompletionToken>
         auto async_receive(const MutableBufferSequence &buffers, socket_base::message_flags flags, CompletionToken &&token) ->
             typename async_result<std::decay_t<CompletionToken>, void(std::error_code, std::size_t)>::return_type { // NOLINT
-            using token_t = std::decay_t<CompletionToken>;
-            async_completion<token_t, void(std::error_code, std::size_t)> init(token);
-            auto handler = utility::move(init.completion_handler);
-            auto mb = io::buffer(buffers);
-            auto *op = io::implements::make_executor_completion_op(
-                [handler, is_open = this->impl_->is_open()](const io::implements::op_result &r, const bool cancelled) mutable {
-                    std::error_code ec;
-                    if (cancelled) {
-                        ec = std::make_error_code(std::errc::operation_canceled);
-                    } else if (r.error_code) {
-                        ec = std::error_code{r.error_code, std::system_category()};
-                    } else if (!is_open) {
-                        ec = std::make_error_code(std::errc::bad_file_descriptor);
-                    }
-                    handler(ec, r.bytes_transferred);
-                },
-                this->executor_);
-            this->impl_->async_receive(mb.data(), mb.size(), flags, this->executor_, op);
-            return init.result.get();
+            return start_receive(buffers, flags, 0, utility::forward<CompletionToken>(token));
+        }
+
+        /**
+         * @brief 带期限的异步接收，timeout 内没有数据到达时处理器收到 std::errc::timed_out
+         *
+         * io_uring 后端把接收与 IORING_OP_LINK_TIMEOUT 链接在一起提交，不需要另外的定时器。
+         */
+        template <typename MutableBufferSequence, typename Rep, typename Period, typename CompletionToken>
+        auto async_receive(const MutableBufferSequence &buffers, const std::chrono::duration<Rep, Period> &timeout,
+                           CompletionToken &&token) ->
+            typename async_result<std::decay_t<CompletionToken>, void(std::error_code, std::size_t)>::return_type { // NOLINT
+            return start_receive(buffers, 0, base::to_timeout_ns(timeout), utility::forward<CompletionToken>(token));
+        }
+
+        template <typename MutableBufferSequence, typename Rep, typename Period, typename CompletionToken>
+        auto async_receive(const MutableBufferSequence &buffers, socket_base::message_flags flags,
+                           const std::chrono::duration<Rep, Period> &timeout, CompletionToken &&token) ->
+            typename async_result<std::decay_t<CompletionToken>, void(std::error_code, std::size_t)>::return_type { // NOLINT
+            return start_receive(buffers, flags, base::to_timeout_ns(timeout), utility::forward<CompletionToken>(token));
         }
 
         template <typename MutableBufferSequence, typename CompletionToken>
@@ -955,32 +1009,149 @@ namespace rainy::foundation::io::net {
 
         template <typename ConstBufferSequence, typename CompletionToken>
         auto async_send(const ConstBufferSequence &buffers, socket_base::message_flags flags, CompletionToken &&token) ->
+            typename async_result<std::decay_t<CompletionToken>, void(std::error_code, std::size_t)>::return_type { // NOLINT
+            return start_send(buffers, flags, 0, utility::forward<CompletionToken>(token));
+        }
+
+        /**
+         * @brief 带期限的异步发送，timeout 内未能写出时处理器收到 std::errc::timed_out
+         */
+        template <typename ConstBufferSequence, typename Rep, typename Period, typename CompletionToken>
+        auto async_send(const ConstBufferSequence &buffers, const std::chrono::duration<Rep, Period> &timeout, CompletionToken &&token) ->
+            typename async_result<std::decay_t<CompletionToken>, void(std::error_code, std::size_t)>::return_type { // NOLINT
+            return start_send(buffers, 0, base::to_timeout_ns(timeout), utility::forward<CompletionToken>(token));
+        }
+
+        template <typename ConstBufferSequence, typename Rep, typename Period, typename CompletionToken>
+        auto async_send(const ConstBufferSequence &buffers, socket_base::message_flags flags,
+                        const std::chrono::duration<Rep, Period> &timeout, CompletionToken &&token) ->
+            typename async_result<std::decay_t<CompletionToken>, void(std::error_code, std::size_t)>::return_type { // NOLINT
+            return start_send(buffers, flags, base::to_timeout_ns(timeout), utility::forward<CompletionToken>(token));
+        }
+
+        template <typename ConstBufferSequence, typename CompletionToken>
+        auto async_write_some(const ConstBufferSequence &buffers, CompletionToken &&token) ->
+            typename async_result<std::decay_t<CompletionToken>, void(std::error_code, std::size_t)>::return_type { // NOLINT
+            return async_send(buffers, utility::forward<CompletionToken>(token));
+        }
+
+        /**
+         * @brief 零拷贝发送，内核直接引用 buffers 的页面而不复制
+         *
+         * 处理器在内核释放页面之后才被调用，此时缓冲区可以安全地释放或复用。buffers 可以是单个缓冲区，
+         * 也可以是 const_buffer 序列，后者以 sendmsg 一次聚集发送（最多 16 段）。内核不支持时退化为普通发送。
+         * 超过 zero_copy_threshold() 的 async_send 会自动走这条路径，无需显式调用。
+         */
+        template <typename ConstBufferSequence, typename CompletionToken>
+        auto async_send_zero_copy(const ConstBufferSequence &buffers, CompletionToken &&token) ->
+            typename async_result<std::decay_t<CompletionToken>, void(std::error_code, std::size_t)>::return_type { // NOLINT
+            return async_send_zero_copy(buffers, 0, utility::forward<CompletionToken>(token));
+        }
+
+        template <typename ConstBufferSequence, typename CompletionToken>
+        auto async_send_zero_copy(const ConstBufferSequence &buffers, socket_base::message_flags flags, CompletionToken &&token) ->
             typename async_result<std::decay_t<CompletionToken>, void(std::error_code, std::size_t)>::return_type { // NOLINT
             using token_t = std::decay_t<CompletionToken>;
             async_completion<token_t, void(std::error_code, std::size_t)> init(token);
             auto handler = utility::move(init.completion_handler);
-            auto cb = io::buffer(buffers);
+            const io::implements::buffer_sequence_array<io::const_buffer> segments(buffers);
             auto *op = io::implements::make_executor_completion_op(
                 [handler, is_open = this->impl_->is_open()](const io::implements::op_result &r, const bool cancelled) mutable {
+                    handler(base::make_completion_error(r, cancelled, false, is_open), r.bytes_transferred);
+                },
+                this->executor_);
+            this->impl_->async_send_zero_copy(segments.data(), segments.size(), flags, this->executor_, op);
+            return init.result.get();
+        }
+
+        /**
+         * @brief 设置 async_send 自动改用零拷贝的长度下限，0 表示关闭，默认为 64 KiB
+         */
+        void zero_copy_threshold(const std::size_t bytes) noexcept {
+            this->impl_->zero_copy_threshold(bytes);
+        }
+
+        RAINY_NODISCARD std::size_t zero_copy_threshold() const noexcept {
+            return this->impl_->zero_copy_threshold();
+        }
+
+        /**
+         * @brief 多发接收，处理器签名为 void(std::error_code, borrowed_buffer)
+         *
+         * 数据直接落在 io_context 的缓冲区池（见 io_context::setup_provided_buffers）中，调用方无需为每个连接准备接收缓冲区。
+         * 处理器会被反复调用；对端关闭时以 socket_errc::end_of_stream 结束，内核中止多发时自动重新发起。
+         */
+        template <typename Handler>
+        void async_receive(multishot_t, Handler &&handler) {
+            async_receive(multishot, 0, utility::forward<Handler>(handler));
+        }
+
+        template <typename Handler>
+        void async_receive(multishot_t, const socket_base::message_flags flags, Handler &&handler) {
+            start_receive_multishot(flags, std::decay_t<Handler>(utility::forward<Handler>(handler)));
+        }
+
+    private:
+        template <typename MutableBufferSequence, typename CompletionToken>
+        auto start_receive(const MutableBufferSequence &buffers, const socket_base::message_flags flags, const std::uint64_t timeout_ns,
+                           CompletionToken &&token) ->
+            typename async_result<std::decay_t<CompletionToken>, void(std::error_code, std::size_t)>::return_type { // NOLINT
+            using token_t = std::decay_t<CompletionToken>;
+            async_completion<token_t, void(std::error_code, std::size_t)> init(token);
+            auto handler = utility::move(init.completion_handler);
+            // 缓冲区序列以一次 recvmsg 分散接收
+            const io::implements::buffer_sequence_array<io::mutable_buffer> segments(buffers);
+            auto *op = io::implements::make_executor_completion_op(
+                [handler, timeout_ns, is_open = this->impl_->is_open()](const io::implements::op_result &r, const bool cancelled) mutable {
+                    handler(base::make_completion_error(r, cancelled, timeout_ns != 0, is_open), r.bytes_transferred);
+                },
+                this->executor_);
+            this->impl_->async_receivev(segments.data(), segments.size(), flags, timeout_ns, this->executor_, op);
+            return init.result.get();
+        }
+
+        template <typename ConstBufferSequence, typename CompletionToken>
+        auto start_send(const ConstBufferSequence &buffers, const socket_base::message_flags flags, const std::uint64_t timeout_ns,
+                        CompletionToken &&token) ->
+            typename async_result<std::decay_t<CompletionToken>, void(std::error_code, std::size_t)>::return_type { // NOLINT
+            using token_t = std::decay_t<CompletionToken>;
+            async_completion<token_t, void(std::error_code, std::size_t)> init(token);
+            auto handler = utility::move(init.completion_handler);
+            // 缓冲区序列（如 HTTP 头部 + 正文）以一次 sendmsg 聚集发送，不必先拼接
+            const io::implements::buffer_sequence_array<io::const_buffer> segments(buffers);
+            auto *op = io::implements::make_executor_completion_op(
+                [handler, timeout_ns, is_open = this->impl_->is_open()](const io::implements::op_result &r, const bool cancelled) mutable {
+                    handler(base::make_completion_error(r, cancelled, timeout_ns != 0, is_open), r.bytes_transferred);
+                },
+                this->executor_);
+            this->impl_->async_sendv(segments.data(), segments.size(), flags, timeout_ns, this->executor_, op);
+            return init.result.get();
+        }
+
+        template <typename Handler>
+        void start_receive_multishot(const socket_base::message_flags flags, Handler handler) {
+            auto *op = io::implements::make_multishot_completion_op(
+                [this, flags, handler](const io::implements::op_result &r, const bool cancelled) mutable {
                     std::error_code ec;
+                    borrowed_buffer buffer;
+                    if (r.flags & io::implements::op_result_buffer) {
+                        buffer = borrowed_buffer{r.buffers, r.buffer_id, r.bytes_transferred};
+                    }
                     if (cancelled) {
                         ec = std::make_error_code(std::errc::operation_canceled);
                     } else if (r.error_code) {
                         ec = std::error_code{r.error_code, std::system_category()};
-                    } else if (!is_open()) {
-                        ec = std::make_error_code(std::errc::bad_file_descriptor);
+                    } else if (!buffer) {
+                        ec = make_error_code(socket_errc::end_of_stream);
+                    }
+                    const bool rearm = !ec && (r.flags & io::implements::op_result_more) == 0;
+                    handler(ec, utility::move(buffer));
+                    if (rearm) {
+                        start_receive_multishot(flags, handler);
                     }
-                    handler(ec, r.bytes_transferred);
                 },
                 this->executor_);
-            this->impl_->async_send(cb.data(), cb.size(), flags, this->executor_, op);
-            return init.result.get();
-        }
-
-        template <typename ConstBufferSequence, typename CompletionToken>
-        auto async_write_some(const ConstBufferSequence &buffers, CompletionToken &&token) ->
-            typename async_result<std::decay_t<CompletionToken>, void(std::error_code, std::size_t)>::return_type { // NOLINT
-            return async_send(buffers, utility::forward<CompletionToken>(token));
+            this->impl_->async_receive_multishot(flags, this->executor_, op);
         }
     };
 
@@ -1371,6 +1542,17 @@ namespace rainy::foundation::io::net {
             return init.result.get();
         }
 
+        /**
+         * @brief 多发 accept，处理器签名为 void(std::error_code, socket_type)
+         *
+         * 只提交一次 accept，之后每个新连接都会调用一次处理器，无需逐个重新发起。
+         * 处理器在出错或被取消时最后一次被调用；内核中止多发但未报告错误时自动重新发起。
+         */
+        template <typename Handler>
+        void async_accept(multishot_t, Handler &&handler) {
+            start_accept_multishot(std::decay_t<Handler>(utility::forward<Handler>(handler)));
+        }
+
         void wait(wait_type w) { // NOLINT
             std::error_code ec;
             wait(w, ec);
@@ -1396,6 +1578,30 @@ namespace rainy::foundation::io::net {
         }
 
     private:
+        template <typename Handler>
+        void start_accept_multishot(Handler handler) {
+            auto *op = io::implements::make_multishot_completion_op(
+                [this, handler](const io::implements::op_result &r, const bool cancelled) mutable {
+                    std::error_code ec;
+                    if (cancelled) {
+                        ec = std::make_error_code(std::errc::operation_canceled);
+                    } else if (r.error_code) {
+                        ec = std::error_code{r.error_code, std::system_category()};
+                    }
+                    socket_type s{executor_.context()};
+                    if (!ec) {
+                        s.assign(protocol_, static_cast<implements::native_socket_t>(r.bytes_transferred), ec);
+                    }
+                    const bool rearm = !cancelled && !r.error_code && (r.flags & io::implements::op_result_more) == 0;
+                    handler(ec, utility::move(s));
+                    if (rearm) {
+                        start_accept_multishot(handler);
+                    }
+                },
+                executor_);
+            impl_->async_accept_multishot(executor_, op);
+        }
+
         executor_type executor_;
         protocol_type protocol_;
         memory::nebula_ptr<implements::socket_impl_base> impl_;
@@ -74,7 +74,7 @@ namespace rainy::foundation::io::stream {
             using token_t = std::decay_t<CompletionToken>;
             async_completion<token_t, void(std::error_code, std::size_t)> init(token);
             auto handler = utility::move(init.completion_handler);
-            auto mb = io::buffer(buffers);
+            const io::implements::buffer_sequence_array<mutable_buffer> segments(buffers);
             auto *op = io::implements::make_executor_completion_op(
                 [handler, is_open = impl_->is_open()](const io::implements::op_result &r, const bool cancelled) mutable {
                     std::error_code ec;
@@ -88,7 +88,7 @@ namespace rainy::foundation::io::stream {
                     handler(ec, r.bytes_transferred);
                 },
                 executor_);
-            this->impl_->async_read_some(mb.data(), mb.size(), this->executor_, op);
+            this->impl_->async_readv(segments.data(), segments.size(), this->executor_, op);
             return init.result.get();
         }
 
@@ -97,7 +97,7 @@ namespace rainy::foundation::io::stream {
             using token_t = std::decay_t<CompletionToken>;
             async_completion<token_t, void(std::error_code, std::size_t)> init(token);
             auto handler = utility::move(init.completion_handler);
-            auto mb = io::buffer(buffers);
+            const io::implements::buffer_sequence_array<const_buffer> segments(buffers);
             auto *op = io::implements::make_executor_completion_op(
                 [handler, is_open = impl_->is_open()](const io::implements::op_result &r, const bool cancelled) mutable {
                     std::error_code ec;
@@ -111,7 +111,7 @@ namespace rainy::foundation::io::stream {
                     handler(ec, r.bytes_transferred);
                 },
                 executor_);
-            this->impl_->async_write_some(mb.data(), mb.size(), this->executor_, op);
+            this->impl_->async_writev(segments.data(), segments.size(), this->executor_, op);
             return init.result.get();
         }
 
@@ -19,6 +19,7 @@
  */
 #ifndef RAINY_FOUNDATION_IO_STREAM_IMPLEMENTS_DESCRIPTOR_HPP
 #define RAINY_FOUNDATION_IO_STREAM_IMPLEMENTS_DESCRIPTOR_HPP
+#include <rainy/foundation/io/buffer.hpp>
 #include <rainy/foundation/io/io_context.hpp>
 #include <rainy/foundation/io/stream/fwd.hpp>
 #include <system_error>
@@ -44,6 +45,24 @@ namespace rainy::foundation::io::stream::implements {
         virtual void async_write_some(const void *buf, std::size_t len, io_context::executor_type executor,
                                       completion_op *op) noexcept = 0;
 
+        /**
+         * @brief 分散读 / 聚集写，count 不超过 1 时等同于 async_read_some / async_write_some
+         *
+         * io_uring 后端以一次 IORING_OP_READV / IORING_OP_WRITEV 提交全部分段。
+         * 默认实现只处理第一个缓冲区（*_some 操作本就允许部分完成）。
+         */
+        virtual void async_readv(const mutable_buffer *buffers, std::size_t count, io_context::executor_type executor,
+                                 completion_op *op) noexcept {
+            const mutable_buffer first = count != 0 ? buffers[0] : mutable_buffer{};
+            async_read_some(first.data(), first.size(), executor, op);
+        }
+
+        virtual void async_writev(const const_buffer *buffers, std::size_t count, io_context::executor_type executor,
+                                  completion_op *op) noexcept {
+            const const_buffer first = count != 0 ? buffers[0] : const_buffer{};
+            async_write_some(first.data(), first.size(), executor, op);
+        }
+
         virtual std::error_code cancel() noexcept = 0;
         RAINY_NODISCARD virtual native_handle_type native_handle() const noexcept = 0;
 
@@ -122,7 +122,7 @@ namespace rainy::foundation::io::stream {
                 using token_t = std::decay_t<CompletionToken>;
                 async_completion<token_t, void(std::error_code, std::size_t)> init(token);
                 auto handler = utility::move(init.completion_handler);
-                auto mb = io::buffer(buffers);
+                const io::implements::buffer_sequence_array<mutable_buffer> segments(buffers);
                 auto *op = io::implements::make_executor_completion_op(
                     [handler, is_open = impl_->is_open()](const io::implements::op_result &r, const bool cancelled) mutable {
                         std::error_code ec;
@@ -136,7 +136,7 @@ namespace rainy::foundation::io::stream {
                         handler(ec, r.bytes_transferred);
                     },
                     executor_);
-                impl_->async_read_some(mb.data(), mb.size(), executor_, op);
+                impl_->async_readv(segments.data(), segments.size(), executor_, op);
                 return init.result.get();
             }
         };
@@ -168,7 +168,7 @@ namespace rainy::foundation::io::stream {
                 using token_t = std::decay_t<CompletionToken>;
                 async_completion<token_t, void(std::error_code, std::size_t)> init(token);
                 auto handler = utility::move(init.completion_handler);
-                auto cb = io::buffer(buffers);
+                const io::implements::buffer_sequence_array<const_buffer> segments(buffers);
                 auto *op = io::implements::make_executor_completion_op(
                     [handler, is_open = impl_->is_open()](const io::implements::op_result &r, const bool cancelled) mutable {
                         std::error_code ec;
@@ -182,7 +182,7 @@ namespace rainy::foundation::io::stream {
                         handler(ec, r.bytes_transferred);
                     },
                     executor_);
-                impl_->async_write_some(cb.data(), cb.size(), executor_, op);
+                impl_->async_writev(segments.data(), segments.size(), executor_, op);
                 return init.result.get();
             }
         };
@@ -375,7 +375,7 @@ namespace rainy::foundation::io::stream {
             using token_t = std::decay_t<CompletionToken>;
             async_completion<token_t, void(std::error_code, std::size_t)> init(token);
             auto handler = utility::move(init.completion_handler);
-            auto mb = io::buffer(buffers);
+            const io::implements::buffer_sequence_array<mutable_buffer> segments(buffers);
             auto *op = io::implements::make_executor_completion_op(
                 [handler, is_open = impl_->is_open()](const io::implements::op_result &r, const bool cancelled) mutable {
                     std::error_code ec;
@@ -389,7 +389,7 @@ namespace rainy::foundation::io::stream {
                     handler(ec, r.bytes_transferred);
                 },
                 executor_);
-            impl_->async_read_some(mb.data(), mb.size(), executor_, op);
+            impl_->async_readv(segments.data(), segments.size(), executor_, op);
             return init.result.get();
         }
 
@@ -399,7 +399,7 @@ namespace rainy::foundation::io::stream {
             using token_t = std::decay_t<CompletionToken>;
             async_completion<token_t, void(std::error_code, std::size_t)> init(token);
             auto handler = utility::move(init.completion_handler);
-            auto cb = io::buffer(buffers);
+            const io::implements::buffer_sequence_array<const_buffer> segments(buffers);
             auto *op = io::implements::make_executor_completion_op(
                 [handler, is_open = impl_->is_open()](const io::implements::op_result &r, const bool cancelled) mutable {
                     std::error_code ec;
@@ -413,7 +413,7 @@ namespace rainy::foundation::io::stream {
                     handler(ec, r.bytes_transferred);
                 },
                 executor_);
-            impl_->async_write_some(cb.data(), cb.size(), executor_, op);
+            impl_->async_writev(segments.data(), segments.size(), executor_, op);
             return init.result.get();
         }
 
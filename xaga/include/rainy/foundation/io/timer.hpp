@@ -15,6 +15,8 @@
  */
 #ifndef RAINY_FOUNDATION_IO_TIMER_HPP
 #define RAINY_FOUNDATION_IO_TIMER_HPP
+#include <chrono>
+#include <rainy/foundation/io/executor/implements/timer_queue.hpp>
 #include <rainy/foundation/io/fwd.hpp>
 #include <rainy/foundation/io/io_context.hpp>
 #include <system_error>
@@ -36,6 +38,12 @@ namespace rainy::foundation::io {
         }
     };
 
+    /**
+     * @brief 可等待定时器
+     *
+     * 后端支持原生定时器（io_uring）时，等待挂在 io_context 的时间轮上，由事件循环到期执行，不占用额外线程；
+     * 否则退回由每个定时器自带的工作线程计时。
+     */
     template <typename Clock, typename WaitTraits>
     class basic_waitable_timer {
     public:
@@ -63,6 +71,7 @@ namespace rainy::foundation::io {
         basic_waitable_timer(basic_waitable_timer &&right) noexcept
             : executor_(utility::move(right.executor_)),
               expiry_(right.expiry_),
+              entry_(utility::move(right.entry_)),
               impl_(utility::move(right.impl_)) {
             right.expiry_ = time_point{};
         }
@@ -73,6 +82,7 @@ namespace rainy::foundation::io {
                 shutdown_impl();
                 executor_ = utility::move(right.executor_);
                 expiry_ = right.expiry_;
+                entry_ = utility::move(right.entry_);
                 impl_ = utility::move(right.impl_);
                 right.expiry_ = time_point{};
             }
@@ -88,6 +98,9 @@ namespace rainy::foundation::io {
         }
 
         std::size_t cancel() {
+            if (entry_) {
+                return executor_.context().cancel_timer(*entry_, static_cast<std::size_t>(-1));
+            }
             if (!impl_) {
                 return 0;
             }
@@ -95,6 +108,9 @@ namespace rainy::foundation::io {
         }
 
         std::size_t cancel_one() {
+            if (entry_) {
+                return executor_.context().cancel_timer(*entry_, 1);
+            }
             if (!impl_) {
                 return 0;
             }
@@ -134,16 +150,64 @@ namespace rainy::foundation::io {
 
         template <typename CompletionToken>
         auto async_wait(CompletionToken &&token)
-            -> typename async_result<CompletionToken, void(std::error_code)>::return_type {
+            -> typename async_result<std::decay_t<CompletionToken>, void(std::error_code)>::return_type {
             using decayed_token = std::decay_t<CompletionToken>;
             using result_type = async_result<decayed_token, void(std::error_code)>;
             async_completion<decayed_token, void(std::error_code)> init(token);
+            if (executor_.context().native_timers()) {
+                using handler_type = typename async_completion<decayed_token, void(std::error_code)>::completion_handler_type;
+                if (!entry_) {
+                    entry_ = std::make_unique<implements::timer_entry>();
+                }
+                auto *op = new timer_wait_op<handler_type>(utility::move(init.completion_handler), executor_);
+                (void) executor_.context().schedule_timer(*entry_, native_deadline(expiry_), op);
+                return init.result.get();
+            }
             ensure_impl();
             impl_->async_wait(expiry_, executor_, utility::move(init.completion_handler));
             return init.result.get();
         }
 
     private:
+        template <typename Handler>
+        class timer_wait_op final : public implements::timer_op {
+        public:
+            timer_wait_op(Handler &&handler, const executor_type &executor) :
+                timer_op(&do_complete), handler_(utility::move(handler)), executor_(executor) {
+                executor_.on_work_started();
+            }
+
+            timer_wait_op(const timer_wait_op &) = delete;
+            timer_wait_op &operator=(const timer_wait_op &) = delete;
+
+        private:
+            static void do_complete(implements::completion_op *self, const implements::op_result & /*result*/,
+                                    const bool is_cancelled) {
+                auto *op = static_cast<timer_wait_op *>(self);
+                Handler handler(utility::move(op->handler_));
+                executor_type executor = op->executor_;
+                const bool cancelled = is_cancelled || op->error_code != 0;
+                delete op;
+                try {
+                    handler(cancelled ? std::make_error_code(std::errc::operation_canceled) : std::error_code{});
+                } catch (...) {
+                }
+                executor.on_work_finished();
+            }
+
+            Handler handler_;
+            executor_type executor_;
+        };
+
+        static std::uint64_t native_deadline(const time_point &expiry) {
+            // 以相对时长换算到 steady_clock，过远的到期时间截断，避免换算为纳秒时溢出
+            constexpr std::chrono::hours max_wait{24 * 365 * 100};
+            const auto remaining = traits_type::to_wait_duration(expiry);
+            const auto wait = remaining >= max_wait ? std::chrono::nanoseconds(max_wait)
+                                                    : std::chrono::duration_cast<std::chrono::nanoseconds>(remaining);
+            return implements::timer_wheel::steady_now_ns() + static_cast<std::uint64_t>(wait.count());
+        }
+
         class timer_impl {
         public:
             struct wait_entry {
@@ -315,6 +379,10 @@ namespace rainy::foundation::io {
         }
 
         void shutdown_impl() {
+            if (entry_) {
+                executor_.context().cancel_timer(*entry_, static_cast<std::size_t>(-1));
+                entry_.reset();
+            }
             if (!impl_) {
                 return;
             }
@@ -324,6 +392,7 @@ namespace rainy::foundation::io {
 
         executor_type executor_;
         time_point expiry_;
+        std::unique_ptr<implements::timer_entry> entry_; // 原生定时器的时间轮节点，地址在移动后保持不变
         std::unique_ptr<timer_impl> impl_;
     };
 }
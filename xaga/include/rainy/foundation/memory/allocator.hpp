@@ -16,6 +16,7 @@
 #ifndef RAINY_FOUNDATION_MEMORY_ALLCATOR_HPP
 #define RAINY_FOUNDATION_MEMORY_ALLCATOR_HPP
 #include <atomic>
+#include <memory_resource>
 #include <rainy/core/type_traits.hpp>
 #include <rainy/core/yesod/exceptions.hpp>
 
@@ -0,0 +1,416 @@
+/*
+ * Copyright 2026 rainy-juzixiao
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef RAINY_FOUNDATION_MEMORY_EPOCH_HPP
+#define RAINY_FOUNDATION_MEMORY_EPOCH_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <rainy/core/core.hpp>
+
+/*
+ * 基于纪元（epoch）的内存回收。
+ *
+ * 读方在访问共享结构前通过 epoch_guard 进入临界区（pin），只需把全局纪元写入本线程的记录，不涉及任何逐指针的发布；
+ * 被移除的对象按移除时的全局纪元放入本线程的 limbo 表，当全局纪元推进两次之后，不可能再有读方持有它们，即可释放。
+ * 全局纪元仅在某个线程的 limbo 表积累到阈值时才尝试推进，推进时只需检查每个线程记录上的一个字。
+ *
+ * 与 hazard_pointer_domain 相比，读路径更轻，适用于读多写少、成批移除的结构；代价是一个长期停留在临界区的读方会阻止所有回收，
+ * 这类读方可在安全点调用 epoch_guard::repin()（即 QSBR 中的静止状态声明）以放行纪元推进。
+ */
+namespace rainy::foundation::memory {
+    template <typename T>
+    class epoch_domain;
+}
+
+namespace rainy::foundation::memory::implements {
+    /**
+     * @brief 每个线程在纪元注册表中的记录
+     *
+     * local 为 0 表示该线程不在临界区，否则为 (纪元 << 1) | 1。nest 仅由所属线程读写，用于支持嵌套的 epoch_guard。
+     */
+    struct alignas(64) epoch_record {
+        std::atomic<std::uint64_t> local{0};
+        std::atomic<bool> active{true};
+        std::size_t nest{0};
+        epoch_record *next{nullptr};
+    };
+
+    /**
+     * @brief 被移除但尚未释放的对象，删除器为普通函数指针，不产生额外分配
+     */
+    struct retired_ptr {
+        void *ptr;
+        void (*deleter)(void *);
+    };
+
+    class RAINY_TOOLKIT_API epoch_registry {
+    public:
+        static epoch_registry &instance();
+
+        epoch_record *get_thread_record();
+
+        void mark_inactive();
+
+        /**
+         * @brief 若所有处于临界区的线程都已观察到当前全局纪元，则将其加一
+         * @return 本次调用是否推进了纪元
+         */
+        bool try_advance() noexcept;
+
+        RAINY_NODISCARD std::uint64_t current_epoch() const noexcept {
+            return global_epoch_.load(std::memory_order_acquire);
+        }
+
+        RAINY_NODISCARD std::size_t get_active_thread_count() const noexcept {
+            return thread_count_.load(std::memory_order_relaxed);
+        }
+
+        void pin(epoch_record *record) noexcept {
+            if (record->nest++ == 0) {
+                record->local.store((global_epoch_.load(std::memory_order_relaxed) << 1) | 1, std::memory_order_release);
+                // 先公开本线程的纪元，再读取共享结构；与 try_advance 中的栅栏配对
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+            }
+        }
+
+        void unpin(epoch_record *record) noexcept {
+            if (--record->nest == 0) {
+                record->local.store(0, std::memory_order_release);
+            }
+        }
+
+        /**
+         * @brief 在最外层临界区内声明静止状态：之前读到的指针全部作废，并以最新的全局纪元重新进入
+         */
+        void repin(epoch_record *record) noexcept {
+            if (record->nest == 1) {
+                record->local.store(0, std::memory_order_release);
+                record->local.store((global_epoch_.load(std::memory_order_relaxed) << 1) | 1, std::memory_order_release);
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+            }
+        }
+
+        ~epoch_registry();
+
+    private:
+        epoch_registry() = default;
+
+        alignas(64) std::atomic<std::uint64_t> global_epoch_{0};
+        std::atomic<epoch_record *> head_{nullptr};
+        std::atomic<std::size_t> thread_count_{0};
+    };
+}
+
+namespace rainy::foundation::memory {
+    /**
+     * @brief 纪元临界区的 RAII 守卫
+     *
+     * 在守卫存活期间，从共享结构读到的任何指针都不会被 epoch_domain 释放。
+     * 提供与 hazard_pointer 相同的 protect/reset_protection 接口，使容器可以在两种回收方案之间切换。
+     */
+    class epoch_guard {
+    public:
+        epoch_guard() : record_(implements::epoch_registry::instance().get_thread_record()) {
+            implements::epoch_registry::instance().pin(record_);
+        }
+
+        epoch_guard(epoch_guard &&other) noexcept : record_(other.record_) {
+            other.record_ = nullptr;
+        }
+
+        epoch_guard &operator=(epoch_guard &&other) noexcept {
+            if (this != &other) {
+                release();
+                record_ = other.record_;
+                other.record_ = nullptr;
+            }
+            return *this;
+        }
+
+        ~epoch_guard() {
+            release();
+        }
+
+        epoch_guard(const epoch_guard &) = delete;
+        epoch_guard &operator=(const epoch_guard &) = delete;
+
+        /**
+         * @brief 整个临界区均受保护，原样返回指针
+         */
+        template <typename T>
+        T *protect(T *ptr) noexcept {
+            return ptr;
+        }
+
+        void reset_protection(std::nullptr_t = nullptr) noexcept { // NOLINT
+        }
+
+        void repin() noexcept {
+            if (record_) {
+                implements::epoch_registry::instance().repin(record_);
+            }
+        }
+
+        RAINY_NODISCARD bool is_pinned() const noexcept {
+            return record_ != nullptr;
+        }
+
+    private:
+        void release() noexcept {
+            if (record_) {
+                implements::epoch_registry::instance().unpin(record_);
+                record_ = nullptr;
+            }
+        }
+
+        implements::epoch_record *record_;
+    };
+
+    template <typename T>
+    class epoch_domain {
+    public:
+        static epoch_domain &global() {
+            static epoch_domain instance;
+            return instance;
+        }
+
+        epoch_guard acquire() { // NOLINT
+            return {};
+        }
+
+        void retire(T *ptr);
+
+        std::size_t reclaim();
+
+        struct stats {
+            std::size_t participating_threads;
+            std::size_t objects_retired;
+            std::size_t objects_reclaimed;
+            std::size_t scan_count;
+            std::uint64_t global_epoch;
+        };
+
+        stats get_stats() const;
+
+        ~epoch_domain() {
+            // 到达此处时所有线程的 limbo 表均已析构，托管给全局表的对象不再可能被访问
+            orphan_batch *curr = orphans_.exchange(nullptr, std::memory_order_acquire);
+            while (curr) {
+                orphan_batch *next = curr->next;
+                free_all(curr->items);
+                delete curr;
+                curr = next;
+            }
+        }
+
+    private:
+        epoch_domain() = default;
+
+        /*
+         * 每个线程 limbo 表累积到该数量才尝试推进纪元，避免每次 retire 都遍历线程记录
+         */
+        static constexpr std::size_t RECLAIM_THRESHOLD = 128;
+
+        static void delete_object(void *p) {
+            delete static_cast<T *>(p);
+        }
+
+        static std::size_t free_all(std::vector<implements::retired_ptr> &items) {
+            const std::size_t n = items.size();
+            for (const auto &item: items) {
+                item.deleter(item.ptr);
+            }
+            items.clear();
+            return n;
+        }
+
+        /**
+         * @brief 线程退出时仍不能释放的对象，按纪元成批托管到 domain 的全局表
+         */
+        struct orphan_batch {
+            std::uint64_t epoch;
+            std::vector<implements::retired_ptr> items;
+            orphan_batch *next{nullptr};
+        };
+
+        struct thread_limbo_list {
+            /*
+             * 纪元 e 移除的对象放入 buckets[e % 3]。对象在全局纪元达到 e + 2 后即可释放，
+             * 因此当桶被新纪元复用时，其中的旧对象必然已经安全。
+             */
+            struct bucket {
+                std::uint64_t epoch{0};
+                std::vector<implements::retired_ptr> items;
+            };
+
+            bucket buckets[3];
+            std::size_t count = 0;
+            std::size_t since_reclaim = 0;
+
+            std::size_t add(T *ptr, std::uint64_t epoch);
+            std::size_t reclaim_expired(std::uint64_t global_epoch);
+            ~thread_limbo_list();
+        };
+
+        static thread_limbo_list &get_thread_limbo_list() {
+            thread_local thread_limbo_list list;
+            return list;
+        }
+
+        void add_orphans(std::uint64_t epoch, std::vector<implements::retired_ptr> &&items);
+        std::size_t reclaim_orphans(std::uint64_t global_epoch);
+
+        std::atomic<orphan_batch *> orphans_{nullptr};
+        mutable std::atomic<std::size_t> objects_retired_{0};
+        mutable std::atomic<std::size_t> objects_reclaimed_{0};
+        mutable std::atomic<std::size_t> scan_count_{0};
+    };
+
+    /**
+     * @brief 供并发容器选择回收方案的策略类型：读方只需进入纪元临界区，适用于读多写少、成批移除的结构
+     */
+    struct epoch_reclamation {
+        template <typename T>
+        using domain_type = epoch_domain<T>;
+
+        using guard_type = epoch_guard;
+    };
+
+    template <typename T>
+    void epoch_domain<T>::retire(T *ptr) {
+        if (!ptr) {
+            return;
+        }
+        // 对象已从共享结构上摘除，此后读到的全局纪元即为它的移除纪元
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        const std::uint64_t epoch = implements::epoch_registry::instance().current_epoch();
+        auto &limbo = get_thread_limbo_list();
+        const std::size_t freed = limbo.add(ptr, epoch);
+        objects_retired_.fetch_add(1, std::memory_order_relaxed);
+        if (freed != 0) {
+            objects_reclaimed_.fetch_add(freed, std::memory_order_relaxed);
+        }
+        if (limbo.since_reclaim >= RECLAIM_THRESHOLD) {
+            reclaim();
+        }
+    }
+
+    template <typename T>
+    std::size_t epoch_domain<T>::reclaim() {
+        scan_count_.fetch_add(1, std::memory_order_relaxed);
+        auto &registry = implements::epoch_registry::instance();
+        registry.try_advance();
+        const std::uint64_t global_epoch = registry.current_epoch();
+        auto &limbo = get_thread_limbo_list();
+        limbo.since_reclaim = 0;
+        std::size_t reclaimed = limbo.reclaim_expired(global_epoch);
+        reclaimed += reclaim_orphans(global_epoch);
+        objects_reclaimed_.fetch_add(reclaimed, std::memory_order_relaxed);
+        return reclaimed;
+    }
+
+    template <typename T>
+    auto epoch_domain<T>::get_stats() const -> stats {
+        const auto &registry = implements::epoch_registry::instance();
+        stats ret{};
+        ret.participating_threads = registry.get_active_thread_count();
+        ret.objects_retired = objects_retired_.load(std::memory_order_relaxed);
+        ret.objects_reclaimed = objects_reclaimed_.load(std::memory_order_relaxed);
+        ret.scan_count = scan_count_.load(std::memory_order_relaxed);
+        ret.global_epoch = registry.current_epoch();
+        return ret;
+    }
+
+    template <typename T>
+    void epoch_domain<T>::add_orphans(const std::uint64_t epoch, std::vector<implements::retired_ptr> &&items) {
+        if (items.empty()) {
+            return;
+        }
+        auto *batch = new orphan_batch{epoch, utility::move(items)};
+        orphan_batch *old_head = orphans_.load(std::memory_order_relaxed);
+        do { // NOLINT
+            batch->next = old_head;
+        } while (!orphans_.compare_exchange_weak(old_head, batch, std::memory_order_release, std::memory_order_relaxed));
+    }
+
+    template <typename T>
+    std::size_t epoch_domain<T>::reclaim_orphans(const std::uint64_t global_epoch) {
+        if (!orphans_.load(std::memory_order_relaxed)) {
+            return 0;
+        }
+        orphan_batch *curr = orphans_.exchange(nullptr, std::memory_order_acquire);
+        std::size_t reclaimed = 0;
+        while (curr) {
+            orphan_batch *next = curr->next;
+            if (curr->epoch + 2 <= global_epoch) {
+                reclaimed += free_all(curr->items);
+                delete curr;
+            } else {
+                add_orphans(curr->epoch, utility::move(curr->items));
+                delete curr;
+            }
+            curr = next;
+        }
+        return reclaimed;
+    }
+
+    template <typename T>
+    std::size_t epoch_domain<T>::thread_limbo_list::add(T *ptr, const std::uint64_t epoch) {
+        std::size_t freed = 0;
+        bucket &b = buckets[epoch % 3];
+        if (b.epoch != epoch) {
+            // 桶中是 epoch - 3 或更早移除的对象
+            freed = free_all(b.items);
+            count -= freed;
+            b.epoch = epoch;
+        }
+        b.items.push_back({static_cast<void *>(ptr), &epoch_domain::delete_object});
+        ++count;
+        ++since_reclaim;
+        return freed;
+    }
+
+    template <typename T>
+    std::size_t epoch_domain<T>::thread_limbo_list::reclaim_expired(const std::uint64_t global_epoch) {
+        std::size_t reclaimed = 0;
+        for (auto &b: buckets) {
+            if (!b.items.empty() && b.epoch + 2 <= global_epoch) {
+                reclaimed += free_all(b.items);
+            }
+        }
+        count -= reclaimed;
+        return reclaimed;
+    }
+
+    template <typename T>
+    epoch_domain<T>::thread_limbo_list::~thread_limbo_list() {
+        auto &registry = implements::epoch_registry::instance();
+        registry.try_advance();
+        const std::uint64_t global_epoch = registry.current_epoch();
+        auto &domain = global();
+        const std::size_t reclaimed = reclaim_expired(global_epoch);
+        domain.objects_reclaimed_.fetch_add(reclaimed, std::memory_order_relaxed);
+        // 仍未过期的对象交给 domain，由其他线程或 domain 析构时释放
+        for (auto &b: buckets) {
+            domain.add_orphans(b.epoch, utility::move(b.items));
+        }
+        count = 0;
+    }
+}
+
+#endif
@@ -317,6 +317,16 @@ namespace rainy::foundation::memory {
     RAINY_INLINE hazard_pointer make_hazard_pointer() {
         return {};
     }
+
+    /**
+     * @brief 供并发容器选择回收方案的策略类型：逐指针发布保护，回收时扫描所有线程的 hazard 槽位
+     */
+    struct hazard_pointer_reclamation {
+        template <typename T>
+        using domain_type = hazard_pointer_domain<T>;
+
+        using guard_type = hazard_pointer;
+    };
 }
 
 #endif
\ No newline at end of file
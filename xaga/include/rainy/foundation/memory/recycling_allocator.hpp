@@ -36,14 +36,24 @@ namespace rainy::foundation::memory {
         }
 
         Ty *allocate(const std::size_t count) {
-            using call_stack = concurrency::thread_context::thread_call_stack;
-            void *p = concurrency::implements::thread_info_base::allocate(Purpose(), call_stack::top(), sizeof(Ty) * count);
+            void *p = concurrency::implements::thread_info_base::allocate(Purpose(), concurrency::thread_context::current_thread_info(),
+                                                                          sizeof(Ty) * count);
             return static_cast<Ty *>(p);
         }
 
         void deallocate(Ty *p, const std::size_t count) {
-            using call_stack = concurrency::thread_context::thread_call_stack;
-            concurrency::implements::thread_info_base::deallocate(Purpose(), call_stack::top(), p, sizeof(Ty) * count);
+            concurrency::implements::thread_info_base::deallocate(Purpose(), concurrency::thread_context::current_thread_info(), p,
+                                                                  sizeof(Ty) * count);
+        }
+
+        template <typename U>
+        bool operator==(const recycling_allocator<U, Purpose> &) const noexcept {
+            return true;
+        }
+
+        template <typename U>
+        bool operator!=(const recycling_allocator<U, Purpose> &) const noexcept {
+            return false;
         }
     };
 
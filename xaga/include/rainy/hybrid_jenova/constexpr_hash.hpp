@@ -24,11 +24,8 @@ namespace rainy::hybrid_jenova {
     template <typename Elem, typename Traits, typename Alloc>
     struct constexpr_hash<std::basic_string<Elem, Traits, Alloc>> {
         constexpr std::size_t operator()(const std::basic_string<Elem, Traits, Alloc> &value, std::size_t seed = 0) const {
-            std::size_t hash_value = seed;
-            for (auto c: value) {
-                hash_value = (hash_value ^ static_cast<std::size_t>(c)) * 1099511628211U;
-            }
-            return hash_value;
+            return static_cast<std::size_t>(
+                rainy::utility::implements::rapidhash_chars(value.data(), value.size(), rainy::utility::implements::rapidhash_seed ^ seed));
         }
     };
 }
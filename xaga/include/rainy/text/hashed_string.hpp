@@ -15,7 +15,7 @@ namespace rainy::foundation::text {
         constexpr basic_hashed_string() = default;
 
         constexpr basic_hashed_string(const_pointer ptr) noexcept :
-            hash_val{fnv1a_hash(ptr)}, str{ptr}, size_{traits_type::length(ptr)} {
+            hash_val{hash_chars(ptr, traits_type::length(ptr))}, str{ptr}, size_{traits_type::length(ptr)} {
         }
 
         constexpr basic_hashed_string(const basic_hashed_string &right) noexcept :
@@ -34,7 +34,7 @@ namespace rainy::foundation::text {
                                                             type_traits::extras::meta_method::has_data_v<StringViewLike>,
                                                         int> = 0>
         constexpr basic_hashed_string(const StringViewLike &svlike) :
-            hash_val{fnv1a_hash(svlike)}, str{svlike.data()}, size_{svlike.size()} {
+            hash_val{hash_chars(svlike.data(), svlike.size())}, str{svlike.data()}, size_{svlike.size()} {
         }
 
         constexpr basic_hashed_string &operator=(const basic_hashed_string &) noexcept = default;
@@ -90,25 +90,11 @@ namespace rainy::foundation::text {
         }
 
     private:
-        template <typename Input>
-        static constexpr std::size_t fnv1a_hash(const Input &val,
-                                                std::size_t offset_basis = rainy::utility::implements::fnv_offset_basis) noexcept {
-
-            std::size_t hash = offset_basis;
-            if constexpr (type_traits::extras::meta_method::has_begin_v<Input> && type_traits::extras::meta_method::has_end_v<Input>) {
-                for (value_type ch: val) {
-                    hash ^= static_cast<std::size_t>(static_cast<type_traits::helper::make_unsigned_t<value_type>>(ch));
-                    hash *= rainy::utility::implements::fnv_prime;
-                }
-            } else {
-                const_pointer cur{val};
-                while (*cur != '\0') {
-                    hash ^= static_cast<std::size_t>(static_cast<type_traits::helper::make_unsigned_t<value_type>>(*cur));
-                    hash *= rainy::utility::implements::fnv_prime;
-                    ++cur;
-                }
-            }
-            return hash;
+        /**
+         * @brief 与 utility::hash 对字符串的结果保持一致，以便哈希字符串可直接与运行期计算的哈希值比较
+         */
+        static constexpr std::size_t hash_chars(const_pointer ptr, const size_type count) noexcept {
+            return static_cast<std::size_t>(rainy::utility::implements::rapidhash_chars(ptr, count));
         }
 
         std::size_t hash_val{0};
@@ -432,7 +432,7 @@ namespace rainy::core::pal {
         result = _InterlockedCompareExchange8(reinterpret_cast<volatile char *>(destination), exchange, comparand);
 #else
         char r;
-        __asm__ __volatile__("lock cmpxchgb %2, %1\n\t"
+        __asm__ __volatile__("lock cmpxchgb %3, %1\n\t"
                              "sete %0"
                              : "=q"(r), "+m"(*destination), "+a"(comparand)
                              : "r"(exchange)
@@ -451,7 +451,7 @@ namespace rainy::core::pal {
         result = _InterlockedCompareExchange16(destination, exchange, comparand);
 #else
         char r;
-        __asm__ __volatile__("lock cmpxchgw %2, %1\n\t"
+        __asm__ __volatile__("lock cmpxchgw %3, %1\n\t"
                              "sete %0"
                              : "=q"(r), "+m"(*destination), "+a"(comparand)
                              : "r"(exchange)
@@ -470,7 +470,7 @@ namespace rainy::core::pal {
         result = _InterlockedCompareExchange(reinterpret_cast<volatile long *>(destination), exchange, comparand) == comparand;
 #else
         char r;
-        __asm__ __volatile__("lock cmpxchgl %2, %1\n\t"
+        __asm__ __volatile__("lock cmpxchgl %3, %1\n\t"
                              "sete %0"
                              : "=q"(r), "+m"(*destination), "+a"(comparand)
                              : "r"(exchange)
@@ -524,7 +524,7 @@ namespace rainy::core::pal {
         exchanged = (result == comparand);
 #else
         void *old = comparand;
-        __asm__ __volatile__("lock cmpxchg %2, %1\n\t"
+        __asm__ __volatile__("lock cmpxchg %3, %1\n\t"
                              "sete %0"
                              : "=q"(exchanged), "+m"(*destination), "+a"(old)
                              : "r"(exchange)
@@ -59,4 +59,21 @@ namespace rainy::foundation::concurrency {
     implements::thread_info_base *thread_context::top_of_thread_call_stack() {
         return thread_call_stack::top();
     }
+
+    implements::thread_info_base *thread_context::current_thread_info() noexcept {
+        if (implements::thread_info_base *top = thread_call_stack::top()) {
+            return top;
+        }
+        // torn_down 为平凡析构的 thread_local，holder 析构后仍可安全读取
+        thread_local bool torn_down = false;
+        struct holder {
+            ~holder() {
+                torn_down = true;
+            }
+
+            implements::thread_info_base info;
+        };
+        thread_local holder local;
+        return torn_down ? nullptr : &local.info;
+    }
 }
@@ -107,6 +107,41 @@ namespace rainy::foundation::concurrency {
         implements::resume_thread(this->thread_handle);
     }
 
+    thrd_result thread::set_affinity(const std::vector<std::size_t> &cpus) noexcept {
+        if (!joinable()) {
+            errno = EINVAL;
+            return thrd_result::error;
+        }
+        return implements::thread_set_affinity(thread_handle, cpus.data(), cpus.size());
+    }
+
+    thrd_result thread::set_affinity(const std::size_t cpu) noexcept {
+        if (!joinable()) {
+            errno = EINVAL;
+            return thrd_result::error;
+        }
+        return implements::thread_set_affinity(thread_handle, &cpu, 1);
+    }
+
+    thrd_result thread::set_name(const std::string_view name) noexcept {
+        if (!joinable()) {
+            errno = EINVAL;
+            return thrd_result::error;
+        }
+        char buffer[64]{};
+        const std::size_t length = (core::min) (name.size(), sizeof(buffer) - 1);
+        core::builtin::copy_memory(buffer, name.data(), length);
+        return implements::thread_set_name(thread_handle, buffer);
+    }
+
+    thrd_result thread::set_priority(const priority level) noexcept {
+        if (!joinable()) {
+            errno = EINVAL;
+            return thrd_result::error;
+        }
+        return implements::thread_set_priority(thread_handle, static_cast<int>(level));
+    }
+
     thread::id thread::get_id() const noexcept {
 #if RAINY_USING_LINUX
         return thread::id{this->thread_handle.handle};
@@ -0,0 +1,141 @@
+/*
+* Copyright 2025 rainy-juzixiao
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <algorithm>
+#include <charconv>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <rainy/foundation/concurrency/basic/topology.hpp>
+
+#if RAINY_USING_LINUX
+#include <dirent.h>
+#endif
+
+namespace rainy::foundation::concurrency {
+    namespace {
+        bool parse_index(const std::string_view text, std::size_t &value) noexcept {
+            if (text.empty()) {
+                return false;
+            }
+            const char *end = text.data() + text.size();
+            const auto [ptr, ec] = std::from_chars(text.data(), end, value);
+            return ec == std::errc{} && ptr == end;
+        }
+
+        std::string_view trim(std::string_view text) noexcept {
+            while (!text.empty() && (text.front() == ' ' || text.front() == '\t')) {
+                text.remove_prefix(1);
+            }
+            while (!text.empty() && (text.back() == ' ' || text.back() == '\t' || text.back() == '\n' || text.back() == '\r')) {
+                text.remove_suffix(1);
+            }
+            return text;
+        }
+
+        numa_node fallback_node() {
+            numa_node node;
+            const std::size_t count = (core::max) (std::size_t{1}, static_cast<std::size_t>(std::thread::hardware_concurrency()));
+            node.cpus.reserve(count);
+            for (std::size_t cpu = 0; cpu < count; ++cpu) {
+                node.cpus.push_back(cpu);
+            }
+            return node;
+        }
+    }
+
+    cpu_topology::cpu_topology(std::vector<numa_node> nodes) : nodes_(utility::move(nodes)) {
+        std::sort(nodes_.begin(), nodes_.end(), [](const numa_node &left, const numa_node &right) { return left.id < right.id; });
+    }
+
+    const cpu_topology &cpu_topology::current() {
+        static const cpu_topology topology = discover();
+        return topology;
+    }
+
+    cpu_topology cpu_topology::discover() {
+        std::vector<numa_node> nodes;
+#if RAINY_USING_LINUX
+        if (DIR *dir = ::opendir("/sys/devices/system/node")) {
+            while (const dirent *entry = ::readdir(dir)) {
+                const std::string_view name{entry->d_name};
+                std::size_t id = 0;
+                if (name.size() <= 4 || name.substr(0, 4) != "node" || !parse_index(name.substr(4), id)) {
+                    continue;
+                }
+                std::ifstream file("/sys/devices/system/node/" + std::string{name} + "/cpulist");
+                std::string line;
+                if (!file || !std::getline(file, line)) {
+                    continue;
+                }
+                numa_node node;
+                node.id = id;
+                node.cpus = parse_cpu_list(line);
+                // 只有内存没有 CPU 的节点（如 CXL 内存扩展）不参与调度
+                if (!node.cpus.empty()) {
+                    nodes.push_back(utility::move(node));
+                }
+            }
+            ::closedir(dir);
+        }
+#endif
+        if (nodes.empty()) {
+            nodes.push_back(fallback_node());
+        }
+        return cpu_topology{utility::move(nodes)};
+    }
+
+    std::vector<std::size_t> cpu_topology::parse_cpu_list(std::string_view text) {
+        std::vector<std::size_t> cpus;
+        while (!text.empty()) {
+            const std::size_t comma = text.find(',');
+            const std::string_view piece = trim(text.substr(0, comma));
+            text = comma == std::string_view::npos ? std::string_view{} : text.substr(comma + 1);
+            std::size_t first = 0;
+            std::size_t last = 0;
+            if (const std::size_t dash = piece.find('-'); dash == std::string_view::npos) {
+                if (!parse_index(piece, first)) {
+                    continue;
+                }
+                last = first;
+            } else if (!parse_index(piece.substr(0, dash), first) || !parse_index(piece.substr(dash + 1), last) || last < first) {
+                continue;
+            }
+            for (std::size_t cpu = first; cpu <= last; ++cpu) {
+                cpus.push_back(cpu);
+            }
+        }
+        std::sort(cpus.begin(), cpus.end());
+        cpus.erase(std::unique(cpus.begin(), cpus.end()), cpus.end());
+        return cpus;
+    }
+
+    std::size_t cpu_topology::node_of(const std::size_t cpu) const noexcept {
+        for (const numa_node &node: nodes_) {
+            if (std::binary_search(node.cpus.begin(), node.cpus.end(), cpu)) {
+                return node.id;
+            }
+        }
+        return unknown_node;
+    }
+
+    std::vector<std::size_t> cpu_topology::cpus() const {
+        std::vector<std::size_t> result;
+        for (const numa_node &node: nodes_) {
+            result.insert(result.end(), node.cpus.begin(), node.cpus.end());
+        }
+        return result;
+    }
+}
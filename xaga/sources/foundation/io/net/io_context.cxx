@@ -43,6 +43,9 @@ namespace rainy::foundation::io {
     io_context::io_context(const int concurrency_hint) : impl_(implements::create_io_context_impl(concurrency_hint)) {
     }
 
+    io_context::io_context(const options_type &options) : impl_(implements::create_io_context_impl(options)) {
+    }
+
     io_context::~io_context() {
         shutdown();
         impl_->stop();
@@ -82,4 +85,63 @@ namespace rainy::foundation::io {
     void io_context::restart() { // NOLINT
         impl_->restart();
     }
+
+    io_context::count_type io_context::flush() { // NOLINT
+        return impl_->flush();
+    }
+
+    implements::submission_stats io_context::submission_stats() const noexcept {
+        return impl_->get_submission_stats();
+    }
+
+    io_context::options_type io_context::applied_options() const noexcept {
+        return impl_->applied_options();
+    }
+
+    static std::error_code make_setup_error(const concurrency::thrd_result res) noexcept {
+        switch (res) {
+            case concurrency::thrd_result::success:
+                return {};
+            case concurrency::thrd_result::nomem:
+                return std::make_error_code(std::errc::not_enough_memory);
+            case concurrency::thrd_result::busy:
+                return std::make_error_code(std::errc::device_or_resource_busy);
+            default:
+                return std::make_error_code(std::errc::operation_not_supported);
+        }
+    }
+
+    std::error_code io_context::setup_provided_buffers(const std::size_t buffer_count, const std::size_t buffer_size) noexcept {
+        return make_setup_error(impl_->setup_provided_buffers(buffer_count, buffer_size));
+    }
+
+    std::error_code io_context::register_files(const std::size_t capacity) noexcept {
+        return make_setup_error(impl_->register_files(capacity));
+    }
+
+    std::error_code io_context::register_buffers(const std::size_t buffer_count, const std::size_t buffer_size) noexcept {
+        return make_setup_error(impl_->register_buffers(buffer_count, buffer_size));
+    }
+
+    fixed_buffer io_context::acquire_fixed_buffer() noexcept {
+        auto *pool = impl_->fixed_buffers();
+        std::uint32_t index = 0;
+        if (!pool || !pool->acquire(index)) {
+            return {};
+        }
+        return fixed_buffer{pool, index};
+    }
+
+    bool io_context::native_timers() const noexcept {
+        return impl_->native_timers();
+    }
+
+    std::error_code io_context::schedule_timer(implements::timer_entry &entry, const std::uint64_t deadline_ns,
+                                               implements::timer_op *op) noexcept {
+        return make_setup_error(impl_->schedule_timer(entry, deadline_ns, op));
+    }
+
+    std::size_t io_context::cancel_timer(implements::timer_entry &entry, const std::size_t max_count) noexcept {
+        return impl_->cancel_timer(entry, max_count);
+    }
 }
@@ -0,0 +1,194 @@
+/*
+ * Copyright 2026 rainy-juzixiao
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <chrono>
+#include <rainy/foundation/io/executor/implements/timer_queue.hpp>
+
+#if RAINY_USING_MSVC
+#include <intrin.h>
+#endif
+
+namespace rainy::foundation::io::implements {
+    namespace {
+        unsigned int highest_bit(const std::uint64_t value) noexcept {
+#if RAINY_USING_MSVC
+            unsigned long index{};
+            _BitScanReverse64(&index, value);
+            return static_cast<unsigned int>(index);
+#else
+            return 63u - static_cast<unsigned int>(__builtin_clzll(value));
+#endif
+        }
+
+        unsigned int lowest_bit(const std::uint64_t value) noexcept {
+#if RAINY_USING_MSVC
+            unsigned long index{};
+            _BitScanForward64(&index, value);
+            return static_cast<unsigned int>(index);
+#else
+            return static_cast<unsigned int>(__builtin_ctzll(value));
+#endif
+        }
+
+        unsigned int digit_of(const std::uint64_t tick, const unsigned int level) noexcept {
+            return static_cast<unsigned int>(tick >> (level * timer_wheel::slot_bits)) & (timer_wheel::slot_count - 1);
+        }
+
+        // level 及以下各层数字所占的位
+        std::uint64_t lower_mask(const unsigned int level) noexcept {
+            const unsigned int bits = (level + 1) * timer_wheel::slot_bits;
+            return bits >= 64 ? ~std::uint64_t{0} : (std::uint64_t{1} << bits) - 1;
+        }
+    }
+
+    timer_wheel::timer_wheel(const std::uint64_t now_ns) noexcept : current_tick_(now_ns / tick_ns) {
+    }
+
+    std::uint64_t timer_wheel::steady_now_ns() noexcept {
+        return static_cast<std::uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+    }
+
+    void timer_wheel::schedule(timer_entry &entry, const std::uint64_t deadline_ns) noexcept {
+        if (entry.linked()) {
+            unlink(entry);
+        }
+        std::uint64_t tick = deadline_ns / tick_ns + (deadline_ns % tick_ns != 0 ? 1 : 0);
+        if (tick <= current_tick_) {
+            // 已经到期的节点放到下一刻度，由下一次 advance 交出
+            tick = current_tick_ + 1;
+        }
+        entry.deadline_tick = tick;
+        link(entry);
+    }
+
+    void timer_wheel::remove(timer_entry &entry) noexcept {
+        if (entry.linked()) {
+            unlink(entry);
+        }
+    }
+
+    timer_entry *timer_wheel::advance(const std::uint64_t now_ns) noexcept {
+        const std::uint64_t target = now_ns / tick_ns;
+        timer_entry *expired_head = nullptr;
+        timer_entry *expired_tail = nullptr;
+        while (size_ != 0) {
+            const std::uint64_t next = next_event_tick();
+            if (next > target) {
+                break;
+            }
+            current_tick_ = next;
+            // 当前刻度进入的每个高层槽都需要向下级联，第 0 层的槽则直接到期
+            for (unsigned int level = level_count; level-- > 0;) {
+                const unsigned int slot = digit_of(current_tick_, level);
+                if ((occupied_[level] >> slot & 1u) == 0) {
+                    continue;
+                }
+                timer_entry *entry = take_slot(level, slot);
+                while (entry) {
+                    timer_entry *next_entry = entry->next;
+                    if (entry->deadline_tick <= current_tick_) {
+                        entry->prev = expired_tail;
+                        entry->next = nullptr;
+                        if (expired_tail) {
+                            expired_tail->next = entry;
+                        } else {
+                            expired_head = entry;
+                        }
+                        expired_tail = entry;
+                    } else {
+                        link(*entry);
+                    }
+                    entry = next_entry;
+                }
+            }
+        }
+        if (target > current_tick_) {
+            current_tick_ = target;
+        }
+        return expired_head;
+    }
+
+    std::uint64_t timer_wheel::next_event_ns() const noexcept {
+        const std::uint64_t tick = next_event_tick();
+        return tick == no_deadline ? no_deadline : tick * tick_ns;
+    }
+
+    void timer_wheel::link(timer_entry &entry) noexcept {
+        const std::uint64_t diff = entry.deadline_tick ^ current_tick_;
+        const unsigned int level = highest_bit(diff) / slot_bits;
+        const unsigned int slot = digit_of(entry.deadline_tick, level);
+        timer_entry *&head = slots_[level][slot];
+        entry.prev = nullptr;
+        entry.next = head;
+        if (head) {
+            head->prev = &entry;
+        }
+        head = &entry;
+        occupied_[level] |= std::uint64_t{1} << slot;
+        entry.position = static_cast<std::uint16_t>(level * slot_count + slot);
+        ++size_;
+    }
+
+    void timer_wheel::unlink(timer_entry &entry) noexcept {
+        const unsigned int level = entry.position / slot_count;
+        const unsigned int slot = entry.position % slot_count;
+        if (entry.prev) {
+            entry.prev->next = entry.next;
+        } else {
+            slots_[level][slot] = entry.next;
+        }
+        if (entry.next) {
+            entry.next->prev = entry.prev;
+        }
+        if (!slots_[level][slot]) {
+            occupied_[level] &= ~(std::uint64_t{1} << slot);
+        }
+        entry.prev = entry.next = nullptr;
+        entry.position = timer_entry::no_position;
+        --size_;
+    }
+
+    timer_entry *timer_wheel::take_slot(const unsigned int level, const unsigned int slot) noexcept {
+        timer_entry *head = slots_[level][slot];
+        slots_[level][slot] = nullptr;
+        occupied_[level] &= ~(std::uint64_t{1} << slot);
+        for (timer_entry *entry = head; entry; entry = entry->next) {
+            entry->position = timer_entry::no_position;
+            --size_;
+        }
+        return head;
+    }
+
+    std::uint64_t timer_wheel::next_event_tick() const noexcept {
+        // 每层被占用的槽都严格位于当前刻度在该层的数字之后，且更高层的数字与当前刻度相同，
+        // 因此该层最早的事件就是当前刻度进入最近那个被占用槽的时刻
+        std::uint64_t earliest = no_deadline;
+        for (unsigned int level = 0; level < level_count; ++level) {
+            const unsigned int current = digit_of(current_tick_, level);
+            const std::uint64_t ahead =
+                current == slot_count - 1 ? 0 : occupied_[level] & (~std::uint64_t{0} << (current + 1));
+            if (ahead == 0) {
+                continue;
+            }
+            const std::uint64_t base = current_tick_ & ~lower_mask(level);
+            const std::uint64_t tick = base | (static_cast<std::uint64_t>(lowest_bit(ahead)) << (level * slot_bits));
+            if (tick < earliest) {
+                earliest = tick;
+            }
+        }
+        return earliest;
+    }
+}
@@ -0,0 +1,104 @@
+/*
+ * Copyright 2026 rainy-juzixiao
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <rainy/foundation/memory/epoch.hpp>
+// NOLINTBEGIN(cppcoreguidelines-avoid-do-while)
+
+namespace rainy::foundation::memory::implements {
+    epoch_registry &epoch_registry::instance() {
+        static epoch_registry registry;
+        return registry;
+    }
+
+    epoch_registry::~epoch_registry() {
+        if (thread_count_.load(std::memory_order_acquire) == 0) {
+            epoch_record *curr = head_.load(std::memory_order_acquire);
+            while (curr) {
+                epoch_record *next = curr->next;
+                delete curr;
+                curr = next;
+            }
+        }
+    }
+
+    namespace {
+        struct epoch_thread_cleanup {
+            epoch_record *record = nullptr;
+            ~epoch_thread_cleanup() {
+                if (record) {
+                    epoch_registry::instance().mark_inactive();
+                }
+            }
+        };
+        thread_local epoch_thread_cleanup tl_epoch_cleanup;
+        thread_local epoch_record *tl_epoch_record = nullptr;
+    }
+
+    epoch_record *epoch_registry::get_thread_record() {
+        if (tl_epoch_record) {
+            return tl_epoch_record;
+        }
+        epoch_record *record = nullptr;
+        // 优先复用已退出线程留下的记录
+        for (epoch_record *curr = head_.load(std::memory_order_acquire); curr; curr = curr->next) {
+            if (bool expected = false;
+                curr->active.compare_exchange_strong(expected, true, std::memory_order_acquire, std::memory_order_relaxed)) {
+                record = curr;
+                break;
+            }
+        }
+        if (!record) {
+            record = new epoch_record();
+            epoch_record *old_head = head_.load(std::memory_order_relaxed);
+            do {
+                record->next = old_head;
+            } while (!head_.compare_exchange_weak(old_head, record, std::memory_order_release, std::memory_order_relaxed));
+        }
+        record->nest = 0;
+        record->local.store(0, std::memory_order_relaxed);
+        thread_count_.fetch_add(1, std::memory_order_relaxed);
+        tl_epoch_record = record;
+        tl_epoch_cleanup.record = record;
+        return record;
+    }
+
+    void epoch_registry::mark_inactive() {
+        epoch_record *record = tl_epoch_record;
+        if (!record) {
+            return;
+        }
+        record->nest = 0;
+        record->local.store(0, std::memory_order_release);
+        record->active.store(false, std::memory_order_release);
+        thread_count_.fetch_sub(1, std::memory_order_relaxed);
+        tl_epoch_record = nullptr;
+    }
+
+    bool epoch_registry::try_advance() noexcept {
+        std::uint64_t epoch = global_epoch_.load(std::memory_order_acquire);
+        // 与 pin 中的栅栏配对：要么看到读方已公开的纪元，要么读方之后必然读到本次推进前移除操作的结果
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        const std::uint64_t pinned = (epoch << 1) | 1;
+        for (epoch_record *curr = head_.load(std::memory_order_acquire); curr; curr = curr->next) {
+            const std::uint64_t local = curr->local.load(std::memory_order_acquire);
+            if (local != 0 && local != pinned) {
+                return false;
+            }
+        }
+        return global_epoch_.compare_exchange_strong(epoch, epoch + 1, std::memory_order_release, std::memory_order_relaxed);
+    }
+}
+
+// NOLINTEND(cppcoreguidelines-avoid-do-while)
@@ -158,6 +158,14 @@ namespace rainy::foundation::io::filesystem::implements {
             return {};
         }
 
+        std::error_code sync(const bool data_only) noexcept override {
+            (void) data_only; // macOS 没有 fdatasync
+            if (::fsync(fd_) < 0) {
+                return {errno, std::system_category()};
+            }
+            return {};
+        }
+
         std::uintptr_t native_handle() const noexcept override {
             return static_cast<std::uintptr_t>(fd_);
         }
@@ -350,4 +350,8 @@ namespace rainy::foundation::io::implements {
         impl->init(concurrency_hint);
         return impl;
     }
+
+    memory::nebula_ptr<io_context_impl_base> create_io_context_impl(const io_context_options &options) {
+        return create_io_context_impl(options.concurrency_hint);
+    }
 }
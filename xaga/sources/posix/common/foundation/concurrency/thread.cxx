@@ -14,6 +14,7 @@
  * limitations under the License.
  */
 #include <csignal>
+#include <cstring>
 #include <pthread.h>
 #include <rainy/core/core.hpp>
 #include <rainy/foundation/concurrency/pal.hpp>
@@ -22,6 +23,8 @@
 #if RAINY_USING_MACOS
 #include <sys/sysctl.h> // NOLINT
 #else
+#include <sched.h> // NOLINT
+#include <sys/resource.h> // NOLINT
 #include <sys/syscall.h> // NOLINT
 #endif
 
@@ -303,6 +306,92 @@ namespace rainy::foundation::concurrency::implements {
         pthread_kill(reinterpret_cast<pthread_t>(thread_handle.handle), SIGUSR2);
 #else
         (void) syscall(SYS_tgkill, getpid(), thread_handle.tid, SIGUSR2);
+#endif
+    }
+
+    thrd_result thread_set_affinity(schd_thread_t thread_handle, const std::size_t *cpus, const std::size_t count) noexcept {
+        if (!thread_handle.handle || !cpus || count == 0) {
+            errno = EINVAL;
+            return thrd_result::error;
+        }
+#if RAINY_USING_MACOS
+        // macOS 只提供亲和性标签（THREAD_AFFINITY_POLICY），无法把线程绑定到具体核心
+        errno = ENOTSUP;
+        return thrd_result::error;
+#else
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        for (std::size_t i = 0; i < count; ++i) {
+            if (cpus[i] >= CPU_SETSIZE) {
+                errno = EINVAL;
+                return thrd_result::error;
+            }
+            CPU_SET(cpus[i], &set);
+        }
+        if (const int ret = pthread_setaffinity_np(static_cast<pthread_t>(thread_handle.handle), sizeof(set), &set); ret != 0) {
+            errno = ret;
+            return thrd_result::error;
+        }
+        return thrd_result::success;
+#endif
+    }
+
+    thrd_result thread_set_name(schd_thread_t thread_handle, const char *name) noexcept {
+        if (!thread_handle.handle || !name) {
+            errno = EINVAL;
+            return thrd_result::error;
+        }
+#if RAINY_USING_MACOS
+        if (reinterpret_cast<pthread_t>(thread_handle.handle) != pthread_self()) {
+            errno = ENOTSUP;
+            return thrd_result::error;
+        }
+        if (const int ret = pthread_setname_np(name); ret != 0) {
+            errno = ret;
+            return thrd_result::error;
+        }
+#else
+        char truncated[16]{}; // 内核限制 TASK_COMM_LEN = 16，含结尾的 0
+        std::strncpy(truncated, name, sizeof(truncated) - 1);
+        if (const int ret = pthread_setname_np(static_cast<pthread_t>(thread_handle.handle), truncated); ret != 0) {
+            errno = ret;
+            return thrd_result::error;
+        }
+#endif
+        return thrd_result::success;
+    }
+
+    thrd_result thread_set_priority(schd_thread_t thread_handle, const int level) noexcept {
+        if (!thread_handle.handle || level < -2 || level > 2) {
+            errno = EINVAL;
+            return thrd_result::error;
+        }
+#if RAINY_USING_MACOS
+        sched_param param{};
+        int policy = 0;
+        const auto handle = reinterpret_cast<pthread_t>(thread_handle.handle);
+        if (pthread_getschedparam(handle, &policy, &param) != 0) {
+            errno = EINVAL;
+            return thrd_result::error;
+        }
+        const int low = sched_get_priority_min(policy);
+        const int high = sched_get_priority_max(policy);
+        param.sched_priority = low + (high - low) * (level + 2) / 4;
+        if (const int ret = pthread_setschedparam(handle, policy, &param); ret != 0) {
+            errno = ret;
+            return thrd_result::error;
+        }
+        return thrd_result::success;
+#else
+        // SCHED_OTHER 下 pthread 优先级恒为 0，Linux 的 nice 值则是按线程（tid）生效的
+        static constexpr int nice_table[] = {19, 10, 0, -5, -10};
+        if (::setpriority(PRIO_PROCESS, static_cast<id_t>(thread_handle.tid), nice_table[level + 2]) != 0) {
+            if (errno == EACCES) {
+                errno = EPERM;
+            }
+            return thrd_result::error;
+        }
+        return thrd_result::success;
 #endif
     }
 }
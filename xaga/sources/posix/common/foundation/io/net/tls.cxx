@@ -33,6 +33,7 @@
 #elif RAINY_USING_LINUX
 #include <liburing.h>
 #include <poll.h>
+#include <rainy/foundation/io/executor/implements/io_uring.hpp>
 #include <sys/eventfd.h>
 #endif
 
@@ -545,12 +546,12 @@ namespace rainy::foundation::io::net::implements {
                     return;
                 }
 #elif RAINY_USING_LINUX
-                auto *ring = static_cast<io_uring *>(wait_op->io_handle);
-                if (io_uring_sqe *sqe = io_uring_get_sqe(ring); sqe) {
+                auto *ring = io::implements::io_uring_impl::from_op(wait_op);
+                if (io_uring_sqe *sqe = ring->get_sqe(); sqe) {
                     const unsigned poll_mask = wants_read_ ? POLLIN : POLLOUT;
                     io_uring_prep_poll_add(sqe, socket_fd_, poll_mask);
                     io_uring_sqe_set_data(sqe, wait_op);
-                    io_uring_submit(ring);
+                    ring->submit_sqe();
                 } else {
                     delete wait_op;
                     op->complete(io::implements::op_result{nullptr, 0, EBUSY}, false);
@@ -619,11 +620,11 @@ namespace rainy::foundation::io::net::implements {
                     return;
                 }
 #elif RAINY_USING_LINUX
-                auto *const ring = static_cast<io_uring *>(wait_op->io_handle);
-                if (io_uring_sqe *sqe = io_uring_get_sqe(ring)) {
+                auto *const ring = io::implements::io_uring_impl::from_op(wait_op);
+                if (io_uring_sqe *sqe = ring->get_sqe()) {
                     io_uring_prep_poll_add(sqe, socket_fd_, POLLOUT);
                     io_uring_sqe_set_data(sqe, wait_op);
-                    io_uring_submit(ring);
+                    ring->submit_sqe();
                 } else {
                     delete wait_op;
                     op->complete(io::implements::op_result{nullptr, 0, EBUSY}, false);
@@ -663,12 +664,12 @@ namespace rainy::foundation::io::net::implements {
                     return;
                 }
 #elif RAINY_USING_LINUX
-                auto *ring = static_cast<io_uring *>(wait_op->io_handle);
-                if (io_uring_sqe *sqe = io_uring_get_sqe(ring)) {
+                auto *ring = io::implements::io_uring_impl::from_op(wait_op);
+                if (io_uring_sqe *sqe = ring->get_sqe()) {
                     const unsigned poll_mask = wants_read_ ? POLLIN : POLLOUT;
                     io_uring_prep_poll_add(sqe, socket_fd_, poll_mask);
                     io_uring_sqe_set_data(sqe, wait_op);
-                    io_uring_submit(ring);
+                    ring->submit_sqe();
                 } else {
                     delete wait_op;
                     op->complete(io::implements::op_result{nullptr, 0, EBUSY}, false);
@@ -830,12 +831,12 @@ namespace rainy::foundation::io::net::implements {
                     op->complete({nullptr, 0, errno}, false);
                 }
 #elif RAINY_USING_LINUX
-                auto *ring = static_cast<io_uring *>(wait_op->io_handle);
-                if (io_uring_sqe *sqe = io_uring_get_sqe(ring); sqe) {
+                auto *ring = io::implements::io_uring_impl::from_op(wait_op);
+                if (io_uring_sqe *sqe = ring->get_sqe(); sqe) {
                     const unsigned poll_mask = wants_read_ ? POLLIN : POLLOUT;
                     io_uring_prep_poll_add(sqe, socket_fd_, poll_mask);
                     io_uring_sqe_set_data(sqe, wait_op);
-                    io_uring_submit(ring);
+                    ring->submit_sqe();
                 } else {
                     delete wait_op;
                     delete data;
@@ -909,12 +910,12 @@ namespace rainy::foundation::io::net::implements {
                     op->complete({nullptr, 0, errno}, false);
                 }
 #elif RAINY_USING_LINUX
-                auto *ring = static_cast<io_uring *>(wait_op->io_handle);
-                if (io_uring_sqe *sqe = io_uring_get_sqe(ring)) {
+                auto *ring = io::implements::io_uring_impl::from_op(wait_op);
+                if (io_uring_sqe *sqe = ring->get_sqe()) {
                     const unsigned poll_mask = wants_read_ ? POLLIN : POLLOUT;
                     io_uring_prep_poll_add(sqe, socket_fd_, poll_mask);
                     io_uring_sqe_set_data(sqe, wait_op);
-                    io_uring_submit(ring);
+                    ring->submit_sqe();
                 } else {
                     delete wait_op;
                     delete data;
@@ -0,0 +1,123 @@
+/*
+ * Copyright 2026 rainy-juzixiao
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <new>
+#include "tux_sync.hpp"
+
+namespace rainy::foundation::concurrency::implements {
+    /**
+     * seq 为 futex 字：等待方在释放 mutex 之前读取 seq，通知方先递增 seq 再唤醒，
+     * 因此通知不会落在“释放 mutex”与“进入 futex 等待”之间而丢失。
+     * waiters 记录正在等待的线程数，没有等待方时通知只做一次原子递增，不进入内核。
+     */
+    struct cnd_internal {
+        tux::futex_word seq{0};
+        std::atomic<std::uint32_t> waiters{0};
+    };
+
+    static thrd_result tux_cnd_wait(cnd_t *const cnd, mtx_t *const mtx, const ::timespec *target) noexcept {
+        auto *obj = static_cast<cnd_internal *>(*cnd);
+        auto *mutex = static_cast<tux::mutex_handle *>(*mtx);
+        obj->waiters.fetch_add(1, std::memory_order_seq_cst);
+        const std::uint32_t seq = obj->seq.load(std::memory_order_seq_cst);
+        // 递归 mutex 可能被持有多层，等待期间整体释放，醒来后恢复
+        const int saved_count = mutex->count;
+        mutex->count = 0;
+        mutex->owner.store(0, std::memory_order_relaxed);
+        tux::unlock_word(mutex);
+        const int ret = tux::futex_wait(&obj->seq, seq, target);
+        obj->waiters.fetch_sub(1, std::memory_order_relaxed);
+        // broadcast 会同时唤醒多个线程争抢 mutex，直接走 contended 路径，保证释放时继续唤醒后面的线程
+        if (!tux::try_lock_word(mutex)) {
+            tux::lock_contended(mutex, nullptr);
+        }
+        mutex->owner.store(tux::current_tid(), std::memory_order_relaxed);
+        mutex->count = saved_count;
+        return ret == ETIMEDOUT ? thrd_result::timed_out : thrd_result::success;
+    }
+
+    static thrd_result tux_cnd_notify(cnd_t *const cnd, const int count) noexcept {
+        if (!cnd || !*cnd) {
+            return thrd_result::nomem;
+        }
+        auto *obj = static_cast<cnd_internal *>(*cnd);
+        obj->seq.fetch_add(1, std::memory_order_seq_cst);
+        if (obj->waiters.load(std::memory_order_seq_cst) != 0) {
+            tux::futex_wake(&obj->seq, count);
+        }
+        return thrd_result::success;
+    }
+
+    thrd_result cnd_create(cnd_t *cnd) noexcept {
+        if (!cnd) {
+            return thrd_result::nomem;
+        }
+        void *storage = core::pal::allocate(sizeof(cnd_internal), alignof(cnd_internal));
+        if (!storage) {
+            return thrd_result::nomem;
+        }
+        *cnd = ::new (storage) cnd_internal{};
+        return thrd_result::success;
+    }
+
+    thrd_result cnd_init(cnd_t *const cnd) noexcept {
+        if (!cnd || !*cnd) {
+            return thrd_result::nomem;
+        }
+        ::new (*cnd) cnd_internal{};
+        return thrd_result::success;
+    }
+
+    thrd_result cnd_wait(cnd_t *const cnd, mtx_t* const mtx) noexcept {
+        if (!cnd || !*cnd || !mtx || !*mtx) {
+            return thrd_result::nomem;
+        }
+        return tux_cnd_wait(cnd, mtx, nullptr);
+    }
+
+    thrd_result cnd_timedwait(cnd_t *const cnd, mtx_t* const mtx, const ::timespec *timeout) noexcept {
+        if (!cnd || !*cnd || !mtx || !*mtx || !timeout) {
+            return thrd_result::nomem;
+        }
+        return tux_cnd_wait(cnd, mtx, timeout);
+    }
+
+    thrd_result cnd_signal(cnd_t *const cnd) noexcept {
+        return tux_cnd_notify(cnd, 1);
+    }
+
+    thrd_result cnd_broadcast(cnd_t *const cnd) noexcept {
+        return tux_cnd_notify(cnd, INT_MAX);
+    }
+
+    thrd_result cnd_destroy(cnd_t *cnd) noexcept {
+        if (!cnd || !*cnd) {
+            return thrd_result::nomem;
+        }
+        rainy_const obj = static_cast<cnd_internal *>(*cnd);
+        obj->~cnd_internal();
+        core::pal::deallocate(obj, sizeof(cnd_internal), alignof(cnd_internal));
+        *cnd = nullptr;
+        return thrd_result::success;
+    }
+
+    void *native_cnd_handle(cnd_t *const cnd) noexcept {
+        if (!cnd || !*cnd) {
+            return nullptr;
+        }
+        rainy_const obj = static_cast<cnd_internal *>(*cnd);
+        return &obj->seq;
+    }
+}
@@ -13,105 +13,49 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  */
-#include <pthread.h>
-#include <rainy/core/core.hpp>
-#include <rainy/foundation/concurrency/pal.hpp>
+#include <new>
+#include "tux_sync.hpp"
 
 namespace rainy::foundation::concurrency::implements {
-    struct mutex_handle {
-        pthread_mutex_t handle{};
-        int type{0};
-        pthread_t thread_id{};
-        int count{0};
-    };
+    using tux::mutex_handle;
 
     thrd_result mtx_do_lock(mtx_t* const mtx, const ::timespec *target) noexcept {
-        if (!mtx) {
+        if (!mtx || !*mtx) {
             errno = EINVAL;
             return thrd_result::nomem;
         }
         auto *mutex = static_cast<mutex_handle *>(*mtx);
-        const pthread_t current_thread_id = pthread_self();
-        // --- 非递归普通 mutex (plain_mtx) ---
-        if ((mutex->type & ~mutex_types::recursive_mtx) == mutex_types::plain_mtx) {
-            // 同线程重入直接增加计数
-            if (!pthread_equal(mutex->thread_id, current_thread_id)) {
-                pthread_mutex_lock(&mutex->handle);
-                mutex->thread_id = current_thread_id;
-            }
-            core::pal::interlocked_increment(reinterpret_cast<volatile long *>(&mutex->count));
-            return thrd_result::success;
-        }
-        // --- 递归 mutex / 需要超时支持 ---
-        int res = -1;
-        if (!target) {
-            // 阻塞锁
-            if (!pthread_equal(mutex->thread_id, current_thread_id)) {
-                res = pthread_mutex_lock(&mutex->handle);
-            } else {
-                // 同线程递归 lock
-                res = 0;
-            }
-        } else if (target->tv_sec == 0 && target->tv_nsec == 0) {
-            // 尝试锁
-            if (!pthread_equal(mutex->thread_id, current_thread_id)) {
-                res = pthread_mutex_trylock(&mutex->handle);
-            } else {
-                res = 0;
-            }
-        } else {
-            // 带超时锁
-            if (!pthread_equal(mutex->thread_id, current_thread_id)) {
-                res = pthread_mutex_timedlock(&mutex->handle, target);
-            } else {
-                res = 0;
-            }
-        }
-        // --- 成功锁住 ---
-        if (res == 0) {
-            // 如果是第一次 lock，则设置 thread_id
-            if (core::pal::interlocked_increment(reinterpret_cast<volatile long *>(&mutex->count)) == 1) {
-                mutex->thread_id = current_thread_id;
+        // 快路径：一次 CAS，不区分类型
+        if (!tux::try_lock_word(mutex)) {
+            // 同线程重入：递归 mutex 与仅带 plain_mtx 的普通 mutex 增加计数，其余类型报告 busy（与 Windows 行为一致）
+            if (mutex->owner.load(std::memory_order_relaxed) == tux::current_tid()) {
+                if ((mutex->type & mutex_types::recursive_mtx) == mutex_types::recursive_mtx ||
+                    (mutex->type & ~mutex_types::recursive_mtx) == mutex_types::plain_mtx) {
+                    ++mutex->count;
+                    return thrd_result::success;
+                }
+                errno = EBUSY;
+                return thrd_result::busy;
             }
-
-            // 非递归 mutex 被同线程重复 lock → 模拟 Windows 风格 BUSY
-            if ((mutex->count > 1) && ((mutex->type & mutex_types::recursive_mtx) != mutex_types::recursive_mtx)) {
-                core::pal::interlocked_decrement(reinterpret_cast<volatile long *>(&mutex->count));
-                pthread_mutex_unlock(&mutex->handle);
+            if (target && target->tv_sec == 0 && target->tv_nsec == 0) {
                 errno = EBUSY;
                 return thrd_result::busy;
             }
-
-            return thrd_result::success;
-        }
-        // --- 处理失败返回 ---
-        if (res == ETIMEDOUT) {
-            errno = ETIMEDOUT;
-            return thrd_result::timed_out;
+            if (const thrd_result r = tux::lock_contended(mutex, target); r != thrd_result::success) {
+                return r;
+            }
         }
-        errno = EBUSY;
-        return thrd_result::busy;
+        mutex->owner.store(tux::current_tid(), std::memory_order_relaxed);
+        mutex->count = 1;
+        return thrd_result::success;
     }
 
     thrd_result mtx_init(mtx_t *mtx, int flags) noexcept {
-        if (!mtx) {
+        if (!mtx || !*mtx) {
             return thrd_result::nomem;
         }
-        auto *mutex = static_cast<mutex_handle *>(*mtx);
+        auto *mutex = ::new (*mtx) mutex_handle{};
         mutex->type = flags;
-        mutex->count = 0;
-        mutex->thread_id = {};
-        pthread_mutexattr_t attr;
-        pthread_mutexattr_init(&attr);
-
-        if (flags & mutex_types::recursive_mtx) {
-            pthread_mutexattr_settype(&attr, PTHREAD_MUTEX_RECURSIVE);
-        } else {
-            pthread_mutexattr_settype(&attr, PTHREAD_MUTEX_NORMAL);
-        }
-
-        pthread_mutex_init(&mutex->handle, &attr);
-        pthread_mutexattr_destroy(&attr);
         return thrd_result::success;
     }
 
@@ -137,42 +81,43 @@ namespace rainy::foundation::concurrency::implements {
     }
 
     thrd_result mtx_unlock(mtx_t* const mtx) noexcept {
-        if (!mtx) {
+        if (!mtx || !*mtx) {
             return thrd_result::nomem;
         }
         auto *mutex = static_cast<mutex_handle *>(*mtx);
         if (--mutex->count == 0) {
-            mutex->thread_id = {};
-            pthread_mutex_unlock(&mutex->handle);
+            mutex->owner.store(0, std::memory_order_relaxed);
+            tux::unlock_word(mutex);
         }
         return thrd_result::success;
     }
 
     bool mtx_current_owns(mtx_t* const mtx) noexcept {
-        if (!mtx) {
+        if (!mtx || !*mtx) {
             errno = EINVAL;
             return false;
         }
         const auto *mutex = static_cast<mutex_handle *>(*mtx);
-        return mutex->count != 0 && pthread_equal(mutex->thread_id, pthread_self());
+        return mutex->state.load(std::memory_order_relaxed) != mutex_handle::unlocked &&
+               mutex->owner.load(std::memory_order_relaxed) == tux::current_tid();
     }
 
     thrd_result mtx_destroy(mtx_t* const mtx) noexcept {
-        if (!mtx) {
+        if (!mtx || !*mtx) {
             return thrd_result::nomem;
         }
         auto *mutex = static_cast<mutex_handle *>(*mtx);
-        // 移除对count的检查，不再保证 (若仍有线程持有该锁，行为未定义)
-        pthread_mutex_destroy(&mutex->handle);
+        // 不检查是否仍被持有 (若仍有线程持有该锁，行为未定义)
+        mutex->~mutex_handle();
         core::pal::deallocate(mutex, sizeof(mutex_handle), alignof(mutex_handle));
         return thrd_result::success;
     }
 
     void *native_mtx_handle(mtx_t* const mtx) noexcept {
-        if (!mtx) {
+        if (!mtx || !*mtx) {
             return nullptr;
         }
         auto *mutex = static_cast<mutex_handle *>(*mtx);
-        return &mutex->handle;
+        return &mutex->state;
     }
-}
\ No newline at end of file
+}
@@ -0,0 +1,338 @@
+/*
+ * Copyright 2026 rainy-juzixiao
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <new>
+#include "tux_sync.hpp"
+
+namespace rainy::foundation::concurrency::implements {
+    /**
+     * 读写锁状态字：
+     *  - 低 30 位：读者数，等于 write_locked 时表示被写者持有
+     *  - readers_waiting：有读者在 state 上等待
+     *  - writers_waiting：有写者在 writer_notify 上等待
+     *
+     * 写者优先：只要有写者在等待，新读者就不再进入，避免写者饥饿。
+     * 无竞争的加锁与解锁都只有一次原子操作；只有状态字带等待标记时解锁方才进入内核唤醒。
+     */
+    struct shared_mutex_handle {
+        static constexpr std::uint32_t read_locked = 1;
+        static constexpr std::uint32_t mask = (1u << 30) - 1;
+        static constexpr std::uint32_t write_locked = mask;
+        static constexpr std::uint32_t max_readers = mask - 1;
+        static constexpr std::uint32_t readers_waiting = 1u << 30;
+        static constexpr std::uint32_t writers_waiting = 1u << 31;
+
+        tux::futex_word state{0};
+        tux::futex_word writer_notify{0};
+    };
+
+    namespace {
+        using handle = shared_mutex_handle;
+
+        bool is_unlocked(const std::uint32_t state) noexcept {
+            return (state & handle::mask) == 0;
+        }
+
+        bool is_write_locked(const std::uint32_t state) noexcept {
+            return (state & handle::mask) == handle::write_locked;
+        }
+
+        bool is_read_lockable(const std::uint32_t state) noexcept {
+            return (state & handle::mask) < handle::max_readers && !(state & handle::readers_waiting) &&
+                   !(state & handle::writers_waiting);
+        }
+
+        template <typename Pred>
+        std::uint32_t spin_until(const handle *lock, Pred pred) noexcept {
+            std::uint32_t state = lock->state.load(std::memory_order_relaxed);
+            for (int spin = 0; spin < tux::spin_limit && !pred(state); ++spin) {
+                cpu_relax();
+                state = lock->state.load(std::memory_order_relaxed);
+            }
+            return state;
+        }
+
+        std::uint32_t spin_read(const handle *lock) noexcept {
+            return spin_until(lock, [](const std::uint32_t s) {
+                return !is_write_locked(s) || (s & handle::readers_waiting) || (s & handle::writers_waiting);
+            });
+        }
+
+        std::uint32_t spin_write(const handle *lock) noexcept {
+            return spin_until(lock, [](const std::uint32_t s) { return is_unlocked(s) || (s & handle::writers_waiting); });
+        }
+
+        /**
+         * @return 是否确实唤醒了一个在 futex 上等待的写者
+         */
+        bool wake_writer(handle *lock) noexcept {
+            lock->writer_notify.fetch_add(1, std::memory_order_release);
+            return tux::futex_wake(&lock->writer_notify, 1) != 0;
+        }
+
+        // 锁已完全释放且带等待标记：优先唤醒一个写者，没有写者真正挂起时改为唤醒全部读者。
+        // 期间锁若被他人取得，唤醒责任随之转移给新的持有者。
+        void wake_writer_or_readers(handle *lock, std::uint32_t state) noexcept {
+            if (state == handle::writers_waiting) {
+                if (lock->state.compare_exchange_strong(state, 0, std::memory_order_relaxed, std::memory_order_relaxed)) {
+                    wake_writer(lock);
+                    return;
+                }
+            }
+            if (state == (handle::readers_waiting | handle::writers_waiting)) {
+                if (!lock->state.compare_exchange_strong(state, handle::readers_waiting, std::memory_order_relaxed,
+                                                         std::memory_order_relaxed)) {
+                    return;
+                }
+                if (wake_writer(lock)) {
+                    return;
+                }
+                state = handle::readers_waiting;
+            }
+            if (state == handle::readers_waiting) {
+                if (lock->state.compare_exchange_strong(state, 0, std::memory_order_relaxed, std::memory_order_relaxed)) {
+                    tux::futex_wake(&lock->state, INT_MAX);
+                }
+            }
+        }
+
+        thrd_result read_contended(handle *lock, const ::timespec *target) noexcept {
+            std::uint32_t state = spin_read(lock);
+            rain_loop {
+                if (is_read_lockable(state)) {
+                    if (lock->state.compare_exchange_weak(state, state + handle::read_locked, std::memory_order_acquire,
+                                                          std::memory_order_relaxed)) {
+                        return thrd_result::success;
+                    }
+                    continue;
+                }
+                if ((state & handle::mask) == handle::max_readers) {
+                    errno = EAGAIN;
+                    return thrd_result::error;
+                }
+                if (!(state & handle::readers_waiting)) {
+                    if (!lock->state.compare_exchange_weak(state, state | handle::readers_waiting, std::memory_order_relaxed,
+                                                           std::memory_order_relaxed)) {
+                        continue;
+                    }
+                }
+                if (tux::futex_wait(&lock->state, state | handle::readers_waiting, target) == ETIMEDOUT) {
+                    errno = ETIMEDOUT;
+                    return thrd_result::timed_out;
+                }
+                state = spin_read(lock);
+            }
+        }
+
+        thrd_result write_contended(handle *lock, const ::timespec *target) noexcept {
+            std::uint32_t state = spin_write(lock);
+            // 自己曾经挂起过，就不能确定是否还有别的写者在等待，取得锁时保守地保留 writers_waiting
+            std::uint32_t other_writers_waiting = 0;
+            rain_loop {
+                if (is_unlocked(state)) {
+                    if (lock->state.compare_exchange_weak(state, state | handle::write_locked | other_writers_waiting,
+                                                          std::memory_order_acquire, std::memory_order_relaxed)) {
+                        return thrd_result::success;
+                    }
+                    continue;
+                }
+                if (!(state & handle::writers_waiting)) {
+                    if (!lock->state.compare_exchange_weak(state, state | handle::writers_waiting, std::memory_order_relaxed,
+                                                           std::memory_order_relaxed)) {
+                        continue;
+                    }
+                }
+                other_writers_waiting = handle::writers_waiting;
+                const std::uint32_t seq = lock->writer_notify.load(std::memory_order_acquire);
+                state = lock->state.load(std::memory_order_relaxed);
+                if (is_unlocked(state) || !(state & handle::writers_waiting)) {
+                    continue;
+                }
+                if (tux::futex_wait(&lock->writer_notify, seq, target) == ETIMEDOUT) {
+                    // 放弃前锁可能已经释放并把唤醒交给了自己，这里把它转交出去，避免其他等待方无人唤醒
+                    state = lock->state.load(std::memory_order_relaxed);
+                    if (is_unlocked(state) && (state & (handle::readers_waiting | handle::writers_waiting))) {
+                        wake_writer_or_readers(lock, state);
+                    }
+                    errno = ETIMEDOUT;
+                    return thrd_result::timed_out;
+                }
+                state = spin_write(lock);
+            }
+        }
+
+        bool try_read(handle *lock) noexcept {
+            std::uint32_t state = lock->state.load(std::memory_order_relaxed);
+            while (is_read_lockable(state)) {
+                if (lock->state.compare_exchange_weak(state, state + handle::read_locked, std::memory_order_acquire,
+                                                      std::memory_order_relaxed)) {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        bool try_write(handle *lock) noexcept {
+            std::uint32_t state = lock->state.load(std::memory_order_relaxed);
+            while (is_unlocked(state)) {
+                if (lock->state.compare_exchange_weak(state, state | handle::write_locked, std::memory_order_acquire,
+                                                      std::memory_order_relaxed)) {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        handle *get_handle(smtx_t *const smtx) noexcept {
+            if (smtx == nullptr || *smtx == nullptr) {
+                errno = EINVAL;
+                return nullptr;
+            }
+            return static_cast<handle *>(*smtx);
+        }
+    }
+
+    thrd_result smtx_init(smtx_t *const smtx) noexcept {
+        if (smtx == nullptr || *smtx == nullptr) {
+            errno = EINVAL;
+            return thrd_result::nomem;
+        }
+        ::new (*smtx) shared_mutex_handle{};
+        return thrd_result::success;
+    }
+
+    thrd_result smtx_create(smtx_t *const smtx) noexcept {
+        if (smtx == nullptr) {
+            errno = EINVAL;
+            return thrd_result::nomem;
+        }
+        *smtx = core::pal::allocate(sizeof(shared_mutex_handle), alignof(shared_mutex_handle));
+        return smtx_init(smtx);
+    }
+
+    thrd_result smtx_lock(smtx_t *const smtx) noexcept {
+        handle *lock = get_handle(smtx);
+        if (!lock) {
+            return thrd_result::nomem;
+        }
+        std::uint32_t expected = 0;
+        if (lock->state.compare_exchange_strong(expected, handle::write_locked, std::memory_order_acquire, std::memory_order_relaxed)) {
+            return thrd_result::success;
+        }
+        return write_contended(lock, nullptr);
+    }
+
+    thrd_result smtx_timed_lock(smtx_t *const smtx, const ::timespec *timeout) noexcept {
+        handle *lock = get_handle(smtx);
+        if (!lock) {
+            return thrd_result::nomem;
+        }
+        if (timeout == nullptr) {
+            errno = EINVAL;
+            return thrd_result::error;
+        }
+        if (try_write(lock)) {
+            return thrd_result::success;
+        }
+        return write_contended(lock, timeout);
+    }
+
+    thrd_result smtx_lock_shared(smtx_t *const smtx) noexcept {
+        handle *lock = get_handle(smtx);
+        if (!lock) {
+            return thrd_result::nomem;
+        }
+        std::uint32_t state = lock->state.load(std::memory_order_relaxed);
+        if (is_read_lockable(state) &&
+            lock->state.compare_exchange_weak(state, state + handle::read_locked, std::memory_order_acquire, std::memory_order_relaxed)) {
+            return thrd_result::success;
+        }
+        return read_contended(lock, nullptr);
+    }
+
+    thrd_result smtx_timed_lock_shared(smtx_t *const smtx, const ::timespec *timeout) noexcept {
+        handle *lock = get_handle(smtx);
+        if (!lock) {
+            return thrd_result::nomem;
+        }
+        if (timeout == nullptr) {
+            errno = EINVAL;
+            return thrd_result::error;
+        }
+        if (try_read(lock)) {
+            return thrd_result::success;
+        }
+        return read_contended(lock, timeout);
+    }
+
+    thrd_result smtx_try_lock(smtx_t *const smtx) noexcept {
+        handle *lock = get_handle(smtx);
+        if (!lock) {
+            return thrd_result::nomem;
+        }
+        return try_write(lock) ? thrd_result::success : thrd_result::busy;
+    }
+
+    thrd_result smtx_try_lock_shared(smtx_t *const smtx) noexcept {
+        handle *lock = get_handle(smtx);
+        if (!lock) {
+            return thrd_result::nomem;
+        }
+        return try_read(lock) ? thrd_result::success : thrd_result::busy;
+    }
+
+    thrd_result smtx_unlock(smtx_t *const smtx) noexcept {
+        handle *lock = get_handle(smtx);
+        if (!lock) {
+            return thrd_result::nomem;
+        }
+        const std::uint32_t state = lock->state.fetch_sub(handle::write_locked, std::memory_order_release) - handle::write_locked;
+        if (state & (handle::readers_waiting | handle::writers_waiting)) {
+            wake_writer_or_readers(lock, state);
+        }
+        return thrd_result::success;
+    }
+
+    thrd_result smtx_unlock_shared(smtx_t *const smtx) noexcept {
+        handle *lock = get_handle(smtx);
+        if (!lock) {
+            return thrd_result::nomem;
+        }
+        const std::uint32_t state = lock->state.fetch_sub(handle::read_locked, std::memory_order_release) - handle::read_locked;
+        // 最后一个读者离开且有写者在等待时才需要唤醒；读者只会因写者等待而挂起，由写者解锁时一并处理
+        if (is_unlocked(state) && (state & handle::writers_waiting)) {
+            wake_writer_or_readers(lock, state);
+        }
+        return thrd_result::success;
+    }
+
+    thrd_result smtx_destroy(smtx_t *const smtx) noexcept {
+        handle *lock = get_handle(smtx);
+        if (!lock) {
+            return thrd_result::nomem;
+        }
+        lock->~shared_mutex_handle();
+        core::pal::deallocate(lock, sizeof(shared_mutex_handle), alignof(shared_mutex_handle));
+        *smtx = nullptr;
+        return thrd_result::success;
+    }
+
+    void *native_smtx_handle(smtx_t *const smtx) noexcept {
+        if (smtx == nullptr || *smtx == nullptr) {
+            return nullptr;
+        }
+        return &static_cast<shared_mutex_handle *>(*smtx)->state;
+    }
+}
@@ -0,0 +1,133 @@
+/*
+ * Copyright 2026 rainy-juzixiao
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef RAINY_SOURCES_LINUX_CONCURRENCY_TUX_SYNC_HPP
+#define RAINY_SOURCES_LINUX_CONCURRENCY_TUX_SYNC_HPP
+#include <atomic>
+#include <cerrno>
+#include <climits>
+#include <cstdint>
+#include <ctime>
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <rainy/core/core.hpp>
+#include <rainy/foundation/concurrency/basic/parking.hpp>
+#include <rainy/foundation/concurrency/pal.hpp>
+
+/*
+ * Linux 同步原语的内部实现，仅供 tux_*.cxx 使用。
+ * 所有锁状态都是一个 32 位字，直接作为 futex 字使用；等待超时统一为 CLOCK_REALTIME 绝对时间，与 PAL 层的 timespec 约定一致。
+ */
+namespace rainy::foundation::concurrency::implements::tux {
+    using futex_word = std::atomic<std::uint32_t>;
+
+    static_assert(sizeof(futex_word) == sizeof(std::uint32_t), "futex word must be a plain 32-bit integer");
+
+    /**
+     * @brief 进入内核挂起前的自旋轮数
+     */
+    inline constexpr int spin_limit = 100;
+
+    /**
+     * @brief 在 *word 仍等于 expected 时挂起
+     * @param target 绝对时间（CLOCK_REALTIME），nullptr 表示无限期等待
+     * @return 0 表示被唤醒或值已改变，ETIMEDOUT 表示超时
+     */
+    inline int futex_wait(const futex_word *word, const std::uint32_t expected, const ::timespec *target) noexcept {
+        long ret;
+        if (target == nullptr) {
+            ret = ::syscall(SYS_futex, word, FUTEX_WAIT_PRIVATE, expected, nullptr, nullptr, 0);
+        } else {
+            ret = ::syscall(SYS_futex, word, FUTEX_WAIT_BITSET_PRIVATE | FUTEX_CLOCK_REALTIME, expected, target, nullptr,
+                            FUTEX_BITSET_MATCH_ANY);
+        }
+        if (ret == -1 && errno == ETIMEDOUT) {
+            return ETIMEDOUT;
+        }
+        return 0;
+    }
+
+    /**
+     * @return 实际被唤醒的线程数
+     */
+    inline int futex_wake(const futex_word *word, const int count) noexcept {
+        const long ret = ::syscall(SYS_futex, word, FUTEX_WAKE_PRIVATE, count, nullptr, nullptr, 0);
+        return ret > 0 ? static_cast<int>(ret) : 0;
+    }
+
+    inline pid_t current_tid() noexcept {
+        static thread_local pid_t tid = 0;
+        if (tid == 0) {
+            tid = static_cast<pid_t>(::syscall(SYS_gettid));
+        }
+        return tid;
+    }
+
+    /**
+     * @brief 互斥量状态：0 未锁定，1 已锁定且无人等待，2 已锁定且可能有线程在 futex 上等待
+     *
+     * owner 与 count 只由持有者修改，用于同线程重入检测、递归计数与 mtx_current_owns。
+     */
+    struct mutex_handle {
+        enum : std::uint32_t {
+            unlocked = 0,
+            locked = 1,
+            contended = 2
+        };
+
+        futex_word state{unlocked};
+        int type{0};
+        std::atomic<pid_t> owner{0};
+        int count{0};
+    };
+
+    /**
+     * @brief 慢路径：先自旋，仍未取得则把状态置为 contended 并挂起
+     */
+    inline thrd_result lock_contended(mutex_handle *mutex, const ::timespec *target) noexcept {
+        std::uint32_t state = mutex->state.load(std::memory_order_relaxed);
+        for (int spin = 0; spin < spin_limit && state != mutex_handle::contended; ++spin) {
+            if (state == mutex_handle::unlocked &&
+                mutex->state.compare_exchange_weak(state, mutex_handle::locked, std::memory_order_acquire, std::memory_order_relaxed)) {
+                return thrd_result::success;
+            }
+            cpu_relax();
+            state = mutex->state.load(std::memory_order_relaxed);
+        }
+        // 置为 contended 后解锁方才会 FUTEX_WAKE；因此即使此刻恰好取得了锁，也只多一次无害的唤醒
+        while (mutex->state.exchange(mutex_handle::contended, std::memory_order_acquire) != mutex_handle::unlocked) {
+            if (futex_wait(&mutex->state, mutex_handle::contended, target) == ETIMEDOUT) {
+                errno = ETIMEDOUT;
+                return thrd_result::timed_out;
+            }
+        }
+        return thrd_result::success;
+    }
+
+    inline bool try_lock_word(mutex_handle *mutex) noexcept {
+        std::uint32_t expected = mutex_handle::unlocked;
+        return mutex->state.compare_exchange_strong(expected, mutex_handle::locked, std::memory_order_acquire,
+                                                    std::memory_order_relaxed);
+    }
+
+    inline void unlock_word(mutex_handle *mutex) noexcept {
+        if (mutex->state.exchange(mutex_handle::unlocked, std::memory_order_release) == mutex_handle::contended) {
+            futex_wake(&mutex->state, 1);
+        }
+    }
+}
+
+#endif
@@ -13,11 +13,14 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  */
+#include <rainy/foundation/io/executor/implements/io_uring.hpp>
 #include <rainy/foundation/io/filesystem/streamfile.hpp>
 #include <rainy/foundation/io/io_context.hpp>
 
+#include <cerrno>
 #include <fcntl.h>
 #include <liburing.h>
+#include <new>
 #include <sys/stat.h>
 #include <unistd.h>
 
@@ -25,10 +28,8 @@ namespace rainy::foundation::io::filesystem::implements {
     struct uring_file_proxy : io_context::executor_type {
         io_uring_sqe *get_sqe_from_op(io::implements::completion_op *op, io_context::executor_type executor, const int fd) { // NOLINT
             this->associate_handle(op, static_cast<std::uintptr_t>(fd), nullptr);
-            if (!op->io_handle) {
-                return nullptr;
-            }
-            return ::io_uring_get_sqe(static_cast<io_uring *>(op->io_handle));
+            auto *ring = io::implements::io_uring_impl::from_op(op);
+            return ring ? ring->get_sqe() : nullptr;
         }
 
         using executor_type::post_immediate_completion;
@@ -40,8 +41,8 @@ namespace rainy::foundation::io::filesystem::implements {
     }
 
     static void submit_ring(const completion_op *op) noexcept {
-        if (op->io_handle) {
-            ::io_uring_submit(static_cast<io_uring *>(op->io_handle));
+        if (auto *ring = io::implements::io_uring_impl::from_op(op)) {
+            ring->submit_sqe();
         }
     }
 
@@ -99,6 +100,7 @@ namespace rainy::foundation::io::filesystem::implements {
 
         void close() noexcept override {
             if (fd_ >= 0) {
+                slot_.reset();
                 ::close(fd_);
                 fd_ = -1;
             }
@@ -133,7 +135,13 @@ namespace rainy::foundation::io::filesystem::implements {
                 uring_file_proxy{executor}.post_immediate_completion(op, false);
                 return;
             }
-            ::io_uring_prep_read(sqe, fd_, buf.data(), buf.size(), offset);
+            auto *ring = io::implements::io_uring_impl::from_op(op);
+            if (const int index = ring->fixed_buffer_index(buf.data(), buf.size()); index >= 0) {
+                ::io_uring_prep_read_fixed(sqe, fd_, buf.data(), static_cast<unsigned int>(buf.size()), offset, index);
+            } else {
+                ::io_uring_prep_read(sqe, fd_, buf.data(), buf.size(), offset);
+            }
+            slot_.apply(ring, sqe, fd_);
             ::io_uring_sqe_set_data(sqe, op);
             submit_ring(op);
         }
@@ -145,7 +153,54 @@ namespace rainy::foundation::io::filesystem::implements {
                 uring_file_proxy{executor}.post_immediate_completion(op, false);
                 return;
             }
-            ::io_uring_prep_write(sqe, fd_, buf.data(), buf.size(), offset);
+            auto *ring = io::implements::io_uring_impl::from_op(op);
+            if (const int index = ring->fixed_buffer_index(buf.data(), buf.size()); index >= 0) {
+                ::io_uring_prep_write_fixed(sqe, fd_, buf.data(), static_cast<unsigned int>(buf.size()), offset, index);
+            } else {
+                ::io_uring_prep_write(sqe, fd_, buf.data(), buf.size(), offset);
+            }
+            slot_.apply(ring, sqe, fd_);
+            ::io_uring_sqe_set_data(sqe, op);
+            submit_ring(op);
+        }
+
+        void async_readv_at(const mutable_buffer *buffers, const std::size_t count, const std::uint64_t offset,
+                            io_context::executor_type executor, completion_op *op) noexcept override {
+            if (count <= 1) {
+                // 单段仍走 read / read_fixed，固定缓冲区只能以这种方式使用
+                async_read_some_at(count != 0 ? buffers[0] : mutable_buffer{}, offset, executor, op);
+                return;
+            }
+            io_uring_sqe *sqe = get_sqe_from_op(op, executor, fd_);
+            if (!sqe) {
+                uring_file_proxy{executor}.post_immediate_completion(op, false);
+                return;
+            }
+            auto *ring = io::implements::io_uring_impl::from_op(op);
+            auto &scratch = ring->scratch_for(sqe);
+            const std::size_t segments = scratch.gather(buffers, count);
+            ::io_uring_prep_readv(sqe, fd_, scratch.iov, static_cast<unsigned int>(segments), offset);
+            slot_.apply(ring, sqe, fd_);
+            ::io_uring_sqe_set_data(sqe, op);
+            submit_ring(op);
+        }
+
+        void async_writev_at(const const_buffer *buffers, const std::size_t count, const std::uint64_t offset,
+                             io_context::executor_type executor, completion_op *op) noexcept override {
+            if (count <= 1) {
+                async_write_some_at(count != 0 ? buffers[0] : const_buffer{}, offset, executor, op);
+                return;
+            }
+            io_uring_sqe *sqe = get_sqe_from_op(op, executor, fd_);
+            if (!sqe) {
+                uring_file_proxy{executor}.post_immediate_completion(op, false);
+                return;
+            }
+            auto *ring = io::implements::io_uring_impl::from_op(op);
+            auto &scratch = ring->scratch_for(sqe);
+            const std::size_t segments = scratch.gather(buffers, count);
+            ::io_uring_prep_writev(sqe, fd_, scratch.iov, static_cast<unsigned int>(segments), offset);
+            slot_.apply(ring, sqe, fd_);
             ::io_uring_sqe_set_data(sqe, op);
             submit_ring(op);
         }
@@ -166,23 +221,87 @@ namespace rainy::foundation::io::filesystem::implements {
             return {};
         }
 
+        std::error_code sync(const bool data_only) noexcept override {
+            if ((data_only ? ::fdatasync(fd_) : ::fsync(fd_)) < 0) {
+                return {errno, std::system_category()};
+            }
+            return {};
+        }
+
+        void async_write_some_at_and_sync(const const_buffer buf, const std::uint64_t offset, io_context::executor_type executor,
+                                          completion_op *op) noexcept override {
+            auto *chain = new (std::nothrow) write_sync_op(op, buf.size());
+            if (!chain) {
+                file_impl_base::async_write_some_at_and_sync(buf, offset, executor, op);
+                return;
+            }
+            uring_file_proxy{executor}.associate_handle(chain, static_cast<std::uintptr_t>(fd_), nullptr);
+            auto *ring = io::implements::io_uring_impl::from_op(chain);
+            io_uring_sqe *write_sqe = ring ? ring->get_sqe() : nullptr;
+            io_uring_sqe *sync_sqe = write_sqe ? ::io_uring_get_sqe(ring->native_ring()) : nullptr;
+            if (!sync_sqe) {
+                // 拿不到相邻的两个 SQE 时退回逐个发起；已取得的 write SQE 以空操作占位
+                if (write_sqe) {
+                    ::io_uring_prep_nop(write_sqe);
+                    ::io_uring_sqe_set_data(write_sqe, nullptr);
+                }
+                delete chain;
+                file_impl_base::async_write_some_at_and_sync(buf, offset, executor, op);
+                return;
+            }
+            if (const int index = ring->fixed_buffer_index(buf.data(), buf.size()); index >= 0) {
+                ::io_uring_prep_write_fixed(write_sqe, fd_, buf.data(), static_cast<unsigned int>(buf.size()), offset, index);
+            } else {
+                ::io_uring_prep_write(write_sqe, fd_, buf.data(), buf.size(), offset);
+            }
+            slot_.apply(ring, write_sqe, fd_);
+            write_sqe->flags |= IOSQE_IO_LINK; // 写入失败或不足时内核以 ECANCELED 取消后面的 fsync
+            ::io_uring_sqe_set_data(write_sqe, chain);
+            ::io_uring_prep_fsync(sync_sqe, fd_, IORING_FSYNC_DATASYNC);
+            slot_.apply(ring, sync_sqe, fd_);
+            ::io_uring_sqe_set_data(sync_sqe, chain);
+            ring->submit_sqe();
+        }
+
         std::uintptr_t native_handle() const noexcept override {
             return static_cast<std::uintptr_t>(fd_);
         }
 
     private:
-        struct submit_desc {
-            enum op_kind {
-                readv,
-                writev
-            } op_type;
-            int fd;
-            std::uint64_t offset;
-            ::iovec *iov;
-            int iov_cnt;
+        /**
+         * @brief  write 与 fsync 两个链接请求共用的 op，两个完成事件都到达后再以写入结果完成调用方的 op
+         */
+        struct write_sync_op final : completion_op {
+            write_sync_op(completion_op *target, const std::size_t expected) noexcept :
+                completion_op(&do_complete), target(target), expected(expected) {
+            }
+
+            static void do_complete(completion_op *self, const op_result &res, bool /*cancelled*/) {
+                auto *op = static_cast<write_sync_op *>(self);
+                if (!op->write_done) {
+                    // 链中的请求按顺序完成，第一个到达的是写入
+                    op->write_done = true;
+                    op->write_result = res;
+                    return;
+                }
+                op_result result = op->write_result;
+                result.user_data = op->target;
+                if (result.error_code == 0 && result.bytes_transferred == op->expected) {
+                    result.error_code = res.error_code;
+                }
+                completion_op *target = op->target;
+                delete op;
+                target->complete(result, result.error_code == ECANCELED);
+            }
+
+            completion_op *target;
+            std::size_t expected;
+            op_result write_result{};
+            bool write_done{false};
         };
 
         int fd_{-1};
+        io::implements::io_uring_file_slot slot_;
     };
 
     memory::unique_ptr<file_impl_base> make_file_impl() {
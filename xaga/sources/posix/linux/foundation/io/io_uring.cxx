@@ -13,318 +13,1251 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  */
-#include <liburing.h>
-#include <queue>
+#include <cerrno>
+#include <new>
+#include <poll.h>
+#include <rainy/foundation/io/executor/implements/io_uring.hpp>
 #include <rainy/foundation/io/io_context.hpp>
 #include <sys/eventfd.h>
+#include <unistd.h>
 
 namespace rainy::foundation::io::implements {
     static void nop_fn(completion_op *, const op_result &, bool) noexcept {
     }
 
     completion_op non_op{&nop_fn};
+
+    // eventfd 上多发 poll 的完成标记，跨线程唤醒都经由该 eventfd
+    completion_op wake_op{&nop_fn};
+
+    // completion_op 至少按指针对齐，最低位用来区分 MSG_RING 在发送方环上的完成事件
+    constexpr std::uint64_t msg_ring_tag = 1;
 }
 
 namespace rainy::foundation::io::implements {
-    class io_uring_impl final : public io_context_impl_base {
-    public:
-        explicit io_uring_impl(const int concurrency_hint) noexcept : concurrency_hint_(concurrency_hint) { // NOLINT
+    concurrency::thrd_result io_uring_buffer_ring::init(io_uring *ring, const unsigned int count, const std::size_t size,
+                                                        const int group_id) noexcept {
+        if (count == 0 || count > 32768 || (count & (count - 1)) != 0 || size == 0 || size > 0xFFFFFFFFu) {
+            return concurrency::thrd_result::error;
+        }
+        storage_.reset(new (std::nothrow) unsigned char[static_cast<std::size_t>(count) * size]);
+        if (!storage_) {
+            return concurrency::thrd_result::nomem;
+        }
+        int ret = 0;
+        ring_ = ::io_uring_setup_buf_ring(ring, count, group_id, 0, &ret);
+        if (!ring_) {
+            storage_.reset();
+            return concurrency::thrd_result::error;
+        }
+        count_ = count;
+        size_ = size;
+        group_id_ = group_id;
+        const int mask = ::io_uring_buf_ring_mask(count);
+        for (unsigned int i = 0; i < count; ++i) {
+            ::io_uring_buf_ring_add(ring_, storage_.get() + static_cast<std::size_t>(i) * size, static_cast<unsigned int>(size),
+                                    static_cast<unsigned short>(i), mask, static_cast<int>(i));
+        }
+        ::io_uring_buf_ring_advance(ring_, static_cast<int>(count));
+        return concurrency::thrd_result::success;
+    }
+
+    void io_uring_buffer_ring::destroy(io_uring *ring) noexcept {
+        if (ring_) {
+            ::io_uring_free_buf_ring(ring, ring_, count_, group_id_);
+            ring_ = nullptr;
+        }
+        storage_.reset();
+        count_ = 0;
+        size_ = 0;
+    }
+
+    void *io_uring_buffer_ring::data(const std::uint32_t buffer_id) const noexcept {
+        if (buffer_id >= count_) {
+            return nullptr;
         }
+        return storage_.get() + static_cast<std::size_t>(buffer_id) * size_;
+    }
 
-        ~io_uring_impl() override {
-            destroy();
+    void io_uring_buffer_ring::recycle(const std::uint32_t buffer_id) noexcept {
+        if (!ring_ || buffer_id >= count_) {
+            return;
+        }
+        // 环尾只能有一个生产者，归还可能来自任意线程
+        concurrency::scoped_lock lock(mutex_);
+        ::io_uring_buf_ring_add(ring_, data(buffer_id), static_cast<unsigned int>(size_), static_cast<unsigned short>(buffer_id),
+                                ::io_uring_buf_ring_mask(count_), 0);
+        ::io_uring_buf_ring_advance(ring_, 1);
+    }
+}
+
+namespace rainy::foundation::io::implements {
+    io_uring_fixed_buffers::~io_uring_fixed_buffers() {
+        if (storage_) {
+            ::operator delete[](storage_, std::align_val_t{4096});
+        }
+    }
+
+    concurrency::thrd_result io_uring_fixed_buffers::init(io_uring *ring, const std::size_t count, const std::size_t size) noexcept {
+        // 内核限制：至多 16384 个缓冲区，单个不超过 1 GiB
+        if (count == 0 || count > 16384 || size == 0 || size > (1ull << 30)) {
+            return concurrency::thrd_result::error;
+        }
+        storage_ = static_cast<unsigned char *>(::operator new[](count * size, std::align_val_t{4096}, std::nothrow));
+        if (!storage_) {
+            return concurrency::thrd_result::nomem;
+        }
+        std::vector<::iovec> iovecs;
+        try {
+            iovecs.resize(count);
+            free_list_.reserve(count);
+        } catch (...) {
+            return concurrency::thrd_result::nomem;
+        }
+        for (std::size_t i = 0; i < count; ++i) {
+            iovecs[i].iov_base = storage_ + i * size;
+            iovecs[i].iov_len = size;
+            free_list_.push_back(static_cast<std::uint32_t>(count - 1 - i));
         }
+        if (const int ret = ::io_uring_register_buffers(ring, iovecs.data(), static_cast<unsigned int>(count)); ret < 0) {
+            free_list_.clear();
+            return ret == -ENOMEM ? concurrency::thrd_result::nomem : concurrency::thrd_result::error;
+        }
+        count_ = count;
+        size_ = size;
+        return concurrency::thrd_result::success;
+    }
+
+    void *io_uring_fixed_buffers::data(const std::uint32_t index) const noexcept {
+        if (index >= count_) {
+            return nullptr;
+        }
+        return storage_ + static_cast<std::size_t>(index) * size_;
+    }
+
+    bool io_uring_fixed_buffers::acquire(std::uint32_t &index) noexcept {
+        concurrency::scoped_lock lock(mutex_);
+        if (free_list_.empty()) {
+            return false;
+        }
+        index = free_list_.back();
+        free_list_.pop_back();
+        return true;
+    }
+
+    void io_uring_fixed_buffers::release(const std::uint32_t index) noexcept {
+        if (index >= count_) {
+            return;
+        }
+        concurrency::scoped_lock lock(mutex_);
+        free_list_.push_back(index); // reserve() 过容量，不会再分配
+    }
+
+    int io_uring_fixed_buffers::index_of(const void *ptr, const std::size_t len) const noexcept {
+        if (!storage_ || count_ == 0) {
+            return -1;
+        }
+        const auto *p = static_cast<const unsigned char *>(ptr);
+        if (p < storage_ || p >= storage_ + count_ * size_) {
+            return -1;
+        }
+        const auto offset = static_cast<std::size_t>(p - storage_);
+        const std::size_t index = offset / size_;
+        if (offset - index * size_ + len > size_) {
+            return -1;
+        }
+        return static_cast<int>(index);
+    }
+
+    void io_uring_file_slot::apply(io_uring_impl *ring, io_uring_sqe *sqe, const int fd) noexcept {
+        if (!ring || !sqe) {
+            return;
+        }
+        if (!attempted_) {
+            attempted_ = true;
+            if (const int slot = ring->acquire_file_slot(fd); slot >= 0) {
+                ring_ = ring;
+                slot_ = slot;
+            }
+        }
+        if (slot_ >= 0 && ring_ == ring) {
+            sqe->fd = slot_;
+            sqe->flags |= IOSQE_FIXED_FILE;
+        }
+    }
 
-        concurrency::thrd_result init(const int concurrency_hint) noexcept override {
-            concurrency_hint_ = concurrency_hint;
-            unsigned queue_depth = (concurrency_hint <= 0) ? 256u : static_cast<unsigned>(concurrency_hint) * 32u;
+    void io_uring_file_slot::reset() noexcept {
+        if (ring_ && slot_ >= 0) {
+            ring_->release_file_slot(slot_);
+        }
+        ring_ = nullptr;
+        slot_ = -1;
+        attempted_ = false;
+    }
+}
+
+namespace rainy::foundation::io::implements {
+    thread_local io_uring_impl *io_uring_impl::current_loop_ = nullptr;
+
+    io_uring_impl::io_uring_impl(const int concurrency_hint) noexcept : concurrency_hint_(concurrency_hint) { // NOLINT
+        requested_.concurrency_hint = concurrency_hint;
+    }
+
+    io_uring_impl::io_uring_impl(const io_context_options &options) noexcept : // NOLINT
+        concurrency_hint_(options.concurrency_hint), requested_(options) {
+    }
+
+    io_uring_impl::~io_uring_impl() {
+        destroy();
+    }
+
+    concurrency::thrd_result io_uring_impl::init(const int concurrency_hint) noexcept {
+        io_context_options options = requested_;
+        options.concurrency_hint = concurrency_hint;
+        return init(options);
+    }
+
+    concurrency::thrd_result io_uring_impl::init(const io_context_options &options) noexcept {
+        requested_ = options;
+        concurrency_hint_ = options.concurrency_hint;
+        unsigned queue_depth = options.queue_depth;
+        if (queue_depth == 0) {
+            queue_depth = (options.concurrency_hint <= 0) ? 256u : static_cast<unsigned>(options.concurrency_hint) * 32u;
             if (queue_depth < 64) {
                 queue_depth = 64;
             }
             if (queue_depth > 4096) {
                 queue_depth = 4096;
             }
-            if (const int ret = ::io_uring_queue_init(queue_depth, &ring_, /*flags=*/0); ret < 0) {
-                return concurrency::thrd_result::error;
+        }
+        unsigned int flags = 0;
+        if (options.completion_queue_depth > queue_depth) {
+            flags |= IORING_SETUP_CQSIZE;
+        }
+        if (options.submission_polling) {
+            flags |= IORING_SETUP_SQPOLL;
+            if (options.submission_polling_cpu >= 0) {
+                flags |= IORING_SETUP_SQ_AFF;
             }
-            ring_initialized_ = true;
-            event_fd_ = ::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
-            if (event_fd_ < 0) {
-                ::io_uring_queue_exit(&ring_);
-                ring_initialized_ = false;
-                return concurrency::thrd_result::error;
+        }
+        if (options.cooperative_taskrun) {
+            flags |= IORING_SETUP_COOP_TASKRUN | IORING_SETUP_TASKRUN_FLAG;
+        }
+        if (options.single_issuer || options.defer_taskrun) {
+            // 以禁用状态创建，首个提交的线程启用后即成为唯一提交者，而不是构造 io_context 的线程
+            flags |= IORING_SETUP_SINGLE_ISSUER | IORING_SETUP_R_DISABLED;
+        }
+        if (options.defer_taskrun) {
+            flags |= IORING_SETUP_DEFER_TASKRUN | IORING_SETUP_TASKRUN_FLAG;
+        }
+        // 内核拒绝时按顺序逐个去掉，越新的标志越靠前
+        static constexpr unsigned int fallback_steps[] = {
+            IORING_SETUP_DEFER_TASKRUN, IORING_SETUP_SINGLE_ISSUER | IORING_SETUP_R_DISABLED, IORING_SETUP_COOP_TASKRUN,
+            IORING_SETUP_SQPOLL | IORING_SETUP_SQ_AFF, IORING_SETUP_CQSIZE};
+        ::io_uring_params params{};
+        const auto try_init = [&]() noexcept {
+            params = {};
+            params.flags = flags;
+            if (flags & IORING_SETUP_CQSIZE) {
+                params.cq_entries = options.completion_queue_depth;
             }
-            return concurrency::thrd_result::success;
+            if (flags & IORING_SETUP_SQPOLL) {
+                params.sq_thread_idle = options.submission_polling_idle_ms;
+            }
+            if (flags & IORING_SETUP_SQ_AFF) {
+                params.sq_thread_cpu = static_cast<unsigned int>(options.submission_polling_cpu);
+            }
+            return ::io_uring_queue_init_params(queue_depth, &ring_, &params);
+        };
+        int ret = try_init();
+        for (const unsigned int step: fallback_steps) {
+            if (ret != -EINVAL && ret != -EPERM) {
+                break;
+            }
+            if ((flags & step) == 0) {
+                continue;
+            }
+            flags &= ~step;
+            if ((flags & (IORING_SETUP_COOP_TASKRUN | IORING_SETUP_DEFER_TASKRUN)) == 0) {
+                flags &= ~IORING_SETUP_TASKRUN_FLAG;
+            }
+            ret = try_init();
+        }
+        if (ret < 0) {
+            return concurrency::thrd_result::error;
+        }
+        ring_initialized_ = true;
+        try {
+            link_timespecs_.assign(*ring_.sq.kring_entries, ::__kernel_timespec{});
+            sqe_scratch_.resize(*ring_.sq.kring_entries);
+        } catch (...) {
+            ::io_uring_queue_exit(&ring_);
+            ring_initialized_ = false;
+            return concurrency::thrd_result::nomem;
+        }
+        if (io_uring_probe *probe = ::io_uring_get_probe_ring(&ring_)) {
+            zero_copy_send_ = ::io_uring_opcode_supported(probe, IORING_OP_SEND_ZC) &&
+                              ::io_uring_opcode_supported(probe, IORING_OP_SENDMSG_ZC);
+            ::io_uring_free_probe(probe);
+        }
+        event_fd_ = ::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+        if (event_fd_ < 0) {
+            ::io_uring_queue_exit(&ring_);
+            ring_initialized_ = false;
+            return concurrency::thrd_result::error;
+        }
+        single_issuer_ = (flags & IORING_SETUP_SINGLE_ISSUER) != 0;
+        ring_disabled_.store((flags & IORING_SETUP_R_DISABLED) != 0, concurrency::memory_order_release);
+        applied_ = options;
+        applied_.ring_count = 1;
+        applied_.queue_depth = params.sq_entries;
+        applied_.completion_queue_depth = params.cq_entries;
+        applied_.submission_polling = (flags & IORING_SETUP_SQPOLL) != 0;
+        if (!applied_.submission_polling) {
+            applied_.submission_polling_idle_ms = 0;
+        }
+        if ((flags & IORING_SETUP_SQ_AFF) == 0) {
+            applied_.submission_polling_cpu = -1;
+        }
+        applied_.cooperative_taskrun = (flags & IORING_SETUP_COOP_TASKRUN) != 0;
+        applied_.single_issuer = single_issuer_;
+        applied_.defer_taskrun = (flags & IORING_SETUP_DEFER_TASKRUN) != 0;
+        if (!ring_disabled_.load(concurrency::memory_order_acquire)) {
+            arm_wakeup_poll();
+            ::io_uring_submit(&ring_);
         }
+        return concurrency::thrd_result::success;
+    }
 
-        void destroy() noexcept override {
-            if (event_fd_ >= 0) {
-                ::close(event_fd_);
-                event_fd_ = -1;
+    void io_uring_impl::destroy() noexcept {
+        if (buffer_ring_) {
+            buffer_ring_->destroy(&ring_);
+            buffer_ring_.reset();
+        }
+        if (event_fd_ >= 0) {
+            ::close(event_fd_);
+            event_fd_ = -1;
+        }
+        if (ring_initialized_) {
+            ::io_uring_queue_exit(&ring_);
+            ring_initialized_ = false;
+        }
+        ring_disabled_.store(false, concurrency::memory_order_release);
+        single_issuer_ = false;
+        // 环退出后内核才会解除固定缓冲区的页面锁定
+        fixed_buffers_.reset();
+        files_registered_ = false;
+        free_file_slots_.clear();
+        link_timespecs_.clear();
+        sqe_scratch_.clear();
+        zero_copy_send_ = false;
+    }
+
+    std::size_t io_uring_impl::run() {
+        std::size_t total = 0;
+        current_loop_ = this;
+        while (!stop_flag_->load(concurrency::memory_order_acquire)) {
+            total += drain_ready_queue();
+            if (stop_flag_->load(concurrency::memory_order_acquire)) {
+                break;
             }
-            if (ring_initialized_) {
-                ::io_uring_queue_exit(&ring_);
-                ring_initialized_ = false;
+            if (work_->load(concurrency::memory_order_acquire) <= 0) {
+                break;
             }
+            total += harvest(1, nullptr);
         }
+        flush();
+        current_loop_ = nullptr;
+        return total;
+    }
 
-        std::size_t run() override {
-            std::size_t total = 0;
-            in_event_loop_ = true;
-            while (!stopped_.load(concurrency::memory_order_acquire)) {
-                total += drain_ready_queue();
-                if (stopped_.load(concurrency::memory_order_acquire)) {
-                    break;
-                }
-                if (work_count_.load(concurrency::memory_order_acquire) <= 0) {
-                    break;
-                }
-                total += harvest(1, nullptr);
+    std::size_t io_uring_impl::run_one() {
+        if (stop_flag_->load(concurrency::memory_order_acquire)) {
+            return 0;
+        }
+        current_loop_ = this;
+        if (drain_ready_queue_one() != 0) {
+            flush(); // 离开事件循环前必须把回调中准备的 SQE 交给内核
+            current_loop_ = nullptr;
+            return 1;
+        }
+        if (work_->load(concurrency::memory_order_acquire) <= 0) {
+            current_loop_ = nullptr;
+            return 0;
+        }
+        std::size_t n = 0;
+        // 仅处理了唤醒或时间轮级联时继续等待，直到真正执行了一个处理器
+        while (n == 0 && !stop_flag_->load(concurrency::memory_order_acquire) && work_->load(concurrency::memory_order_acquire) > 0) {
+            n = harvest(1, nullptr);
+        }
+        flush();
+        current_loop_ = nullptr;
+        return n;
+    }
+
+    std::size_t io_uring_impl::run_one_for(const std::uint64_t timeout_ns) {
+        current_loop_ = this;
+        std::size_t n = 0;
+        if (!stop_flag_->load(concurrency::memory_order_acquire)) {
+            if (timeout_ns == 0) {
+                n = harvest(0, nullptr); // peek
+            } else {
+                ::__kernel_timespec ts{};
+                ts.tv_sec = static_cast<long long>(timeout_ns / 1'000'000'000ULL);
+                ts.tv_nsec = static_cast<long long>(timeout_ns % 1'000'000'000ULL);
+                n = harvest(1, &ts);
             }
-            in_event_loop_ = false;
-            return total;
         }
+        flush();
+        current_loop_ = nullptr;
+        return n;
+    }
 
-        std::size_t run_one() override {
-            if (stopped_.load(concurrency::memory_order_acquire)) {
-                return 0;
+    std::size_t io_uring_impl::poll() {
+        std::size_t total = 0;
+        current_loop_ = this;
+        while (!stop_flag_->load(concurrency::memory_order_acquire)) {
+            const std::size_t n = harvest(0, nullptr); // peek，非阻塞
+            if (n == 0) {
+                break;
             }
-            in_event_loop_ = true;
-            {
-                concurrency::unique_lock lock(ready_mutex_);
-                if (!ready_queue_.empty()) {
-                    completion_op *op = ready_queue_.front();
-                    ready_queue_.pop();
-                    lock.unlock();
-                    in_event_loop_ = false;
-                    op_result r{op, 0, 0}; // NOLINT
-                    op->complete(r, false);
-                    return 1;
-                }
+            total += n;
+        }
+        flush();
+        current_loop_ = nullptr;
+        return total;
+    }
+
+    std::size_t io_uring_impl::poll_one() {
+        if (stop_flag_->load(concurrency::memory_order_acquire)) {
+            return 0;
+        }
+        current_loop_ = this;
+        std::size_t n = drain_ready_queue_one();
+        if (n == 0 && expire_timers() != 0) {
+            n = drain_ready_queue_one();
+        }
+        if (n == 0) {
+            flush();
+            n = harvest_one_cqe();
+        }
+        flush();
+        current_loop_ = nullptr;
+        return n;
+    }
+
+    void io_uring_impl::stop() noexcept {
+        if (!stop_flag_->exchange(true, concurrency::memory_order_acq_rel)) {
+            wakeup();
+        }
+    }
+
+    void io_uring_impl::restart() noexcept {
+        stop_flag_->store(false, concurrency::memory_order_release);
+    }
+
+    bool io_uring_impl::stopped() const noexcept {
+        return stop_flag_->load(concurrency::memory_order_acquire);
+    }
+
+    void io_uring_impl::on_work_started() noexcept {
+        work_->fetch_add(1, concurrency::memory_order_relaxed);
+    }
+
+    void io_uring_impl::on_work_finished() noexcept {
+        if (work_->fetch_sub(1, concurrency::memory_order_acq_rel) == 1) {
+            wakeup();
+        }
+    }
+
+    void io_uring_impl::post_immediate_completion(completion_op *op, bool is_continuation) noexcept { // NOLINT
+        ready_queue_.push(op);
+        if (current_loop_ != this) {
+            wakeup();
+        }
+    }
+
+    concurrency::thrd_result io_uring_impl::associate_handle(completion_op *op, const std::uintptr_t fd, void *extra) noexcept {
+        (void) fd;
+        (void) extra;
+        if (op) {
+            op->io_handle = this;
+        }
+        return concurrency::thrd_result::success;
+    }
+
+    bool io_uring_impl::running_in_this_thread() const noexcept {
+        return current_loop_ == this;
+    }
+
+    int io_uring_impl::concurrency_hint() const noexcept {
+        return concurrency_hint_;
+    }
+
+    io_context_options io_uring_impl::applied_options() const noexcept {
+        return applied_;
+    }
+
+    std::size_t io_uring_impl::flush() noexcept {
+        if (!ring_initialized_) {
+            return 0;
+        }
+        enable_ring();
+        if (::io_uring_sq_ready(&ring_) == 0) {
+            return 0;
+        }
+        const int ret = ::io_uring_submit(&ring_);
+        if (ret <= 0) {
+            return 0;
+        }
+        record_flush(static_cast<unsigned int>(ret));
+        return static_cast<std::size_t>(ret);
+    }
+
+    submission_stats io_uring_impl::get_submission_stats() const noexcept {
+        submission_stats stats;
+        stats.flushes = flush_count_.load(concurrency::memory_order_relaxed);
+        stats.submitted = submitted_sqes_.load(concurrency::memory_order_relaxed);
+        stats.last_batch = last_batch_.load(concurrency::memory_order_relaxed);
+        stats.max_batch = max_batch_.load(concurrency::memory_order_relaxed);
+        return stats;
+    }
+
+    concurrency::thrd_result io_uring_impl::setup_provided_buffers(const std::size_t buffer_count,
+                                                                   const std::size_t buffer_size) noexcept {
+        if (!ring_initialized_) {
+            return concurrency::thrd_result::error;
+        }
+        if (buffer_ring_) {
+            return concurrency::thrd_result::busy;
+        }
+        std::unique_ptr<io_uring_buffer_ring> buffers{new (std::nothrow) io_uring_buffer_ring()};
+        if (!buffers) {
+            return concurrency::thrd_result::nomem;
+        }
+        if (const auto res = buffers->init(&ring_, static_cast<unsigned int>(buffer_count), buffer_size, /*group_id=*/0);
+            res != concurrency::thrd_result::success) {
+            return res;
+        }
+        buffer_ring_ = utility::move(buffers);
+        return concurrency::thrd_result::success;
+    }
+
+    provided_buffer_pool *io_uring_impl::provided_buffers() noexcept {
+        return buffer_ring_.get();
+    }
+
+    concurrency::thrd_result io_uring_impl::register_files(const std::size_t capacity) noexcept {
+        if (!ring_initialized_ || capacity == 0 || capacity > 0x7FFFFFFFu) {
+            return concurrency::thrd_result::error;
+        }
+        concurrency::scoped_lock lock(file_slot_mutex_);
+        if (files_registered_) {
+            return concurrency::thrd_result::busy;
+        }
+        try {
+            free_file_slots_.reserve(capacity);
+        } catch (...) {
+            return concurrency::thrd_result::nomem;
+        }
+        if (const int ret = ::io_uring_register_files_sparse(&ring_, static_cast<unsigned int>(capacity)); ret < 0) {
+            return ret == -ENOMEM ? concurrency::thrd_result::nomem : concurrency::thrd_result::error;
+        }
+        for (std::size_t i = capacity; i > 0; --i) {
+            free_file_slots_.push_back(static_cast<int>(i - 1));
+        }
+        files_registered_ = true;
+        return concurrency::thrd_result::success;
+    }
+
+    concurrency::thrd_result io_uring_impl::register_buffers(const std::size_t buffer_count, const std::size_t buffer_size) noexcept {
+        if (!ring_initialized_) {
+            return concurrency::thrd_result::error;
+        }
+        if (fixed_buffers_) {
+            return concurrency::thrd_result::busy;
+        }
+        std::unique_ptr<io_uring_fixed_buffers> buffers{new (std::nothrow) io_uring_fixed_buffers()};
+        if (!buffers) {
+            return concurrency::thrd_result::nomem;
+        }
+        if (const auto res = buffers->init(&ring_, buffer_count, buffer_size); res != concurrency::thrd_result::success) {
+            return res;
+        }
+        fixed_buffers_ = utility::move(buffers);
+        return concurrency::thrd_result::success;
+    }
+
+    fixed_buffer_pool *io_uring_impl::fixed_buffers() noexcept {
+        return fixed_buffers_.get();
+    }
+
+    bool io_uring_impl::native_timers() const noexcept {
+        return true;
+    }
+
+    concurrency::thrd_result io_uring_impl::schedule_timer(timer_entry &entry, const std::uint64_t deadline_ns, timer_op *op) noexcept {
+        op->next = nullptr;
+        op->io_handle = this;
+        if (deadline_ns <= timer_wheel::steady_now_ns()) {
+            post_immediate_completion(op, false);
+            return concurrency::thrd_result::success;
+        }
+        std::uint64_t next_event = 0;
+        {
+            concurrency::scoped_lock lock(timer_mutex_);
+            entry.owner = this;
+            if (entry.ops_tail) {
+                entry.ops_tail->next = op;
+            } else {
+                entry.ops_head = op;
             }
-            if (work_count_.load(concurrency::memory_order_acquire) <= 0) {
-                in_event_loop_ = false;
-                return 0;
+            entry.ops_tail = op;
+            timers_.schedule(entry, deadline_ns);
+            next_event = timers_.next_event_ns();
+            timer_count_.store(timers_.size(), concurrency::memory_order_seq_cst);
+        }
+        // 与 bound_wait_by_timers() 中先写 wait_deadline_ns_ 再读 timer_count_ 的顺序配对，
+        // 保证阻塞中的事件循环要么已经算上了这个定时器，要么会被唤醒
+        if (current_loop_ != this && next_event < wait_deadline_ns_.load(concurrency::memory_order_seq_cst)) {
+            wakeup();
+        }
+        return concurrency::thrd_result::success;
+    }
+
+    std::size_t io_uring_impl::cancel_timer(timer_entry &entry, const std::size_t max_count) noexcept {
+        completion_op *cancelled = nullptr;
+        std::size_t count = 0;
+        {
+            concurrency::scoped_lock lock(timer_mutex_);
+            completion_op **tail = &cancelled;
+            while (entry.ops_head && count < max_count) {
+                completion_op *op = entry.ops_head;
+                entry.ops_head = op->next;
+                op->next = nullptr;
+                static_cast<timer_op *>(op)->error_code = ECANCELED;
+                *tail = op;
+                tail = &op->next;
+                ++count;
             }
-            const std::size_t n = harvest(1, nullptr);
-            in_event_loop_ = false;
-            return n;
-        }
-
-        std::size_t run_one_for(const std::uint64_t timeout_ns) override {
-            in_event_loop_ = true;
-            std::size_t n = 0;
-            if (!stopped_.load(concurrency::memory_order_acquire)) {
-                if (timeout_ns == 0) {
-                    n = harvest(0, nullptr); // peek
-                } else {
-                    ::__kernel_timespec ts{};
-                    ts.tv_sec = static_cast<long long>(timeout_ns / 1'000'000'000ULL);
-                    ts.tv_nsec = static_cast<long long>(timeout_ns % 1'000'000'000ULL);
-                    n = harvest(1, &ts);
-                }
+            if (!entry.ops_head) {
+                entry.ops_tail = nullptr;
+                timers_.remove(entry);
+                timer_count_.store(timers_.size(), concurrency::memory_order_seq_cst);
             }
-            in_event_loop_ = false;
-            return n;
         }
+        while (cancelled) {
+            completion_op *op = cancelled;
+            cancelled = op->next;
+            post_immediate_completion(op, false);
+        }
+        return count;
+    }
 
-        std::size_t poll() override {
-            std::size_t total = 0;
-            in_event_loop_ = true;
-            while (!stopped_.load(concurrency::memory_order_acquire)) {
-                const std::size_t n = harvest(0, nullptr); // peek，非阻塞
-                if (n == 0) {
-                    break;
-                }
-                total += n;
+    int io_uring_impl::acquire_file_slot(int fd) noexcept {
+        concurrency::scoped_lock lock(file_slot_mutex_);
+        if (!files_registered_ || free_file_slots_.empty()) {
+            return -1;
+        }
+        const int slot = free_file_slots_.back();
+        if (::io_uring_register_files_update(&ring_, static_cast<unsigned int>(slot), &fd, 1) != 1) {
+            return -1;
+        }
+        free_file_slots_.pop_back();
+        return slot;
+    }
+
+    void io_uring_impl::release_file_slot(const int slot) noexcept {
+        concurrency::scoped_lock lock(file_slot_mutex_);
+        if (!files_registered_ || slot < 0) {
+            return;
+        }
+        int empty = -1;
+        ::io_uring_register_files_update(&ring_, static_cast<unsigned int>(slot), &empty, 1);
+        free_file_slots_.push_back(slot); // reserve() 过容量，不会再分配
+    }
+
+    io_uring_sqe *io_uring_impl::get_sqe() noexcept {
+        io_uring_sqe *sqe = ::io_uring_get_sqe(&ring_);
+        if (!sqe && flush() > 0) {
+            sqe = ::io_uring_get_sqe(&ring_);
+        }
+        return sqe;
+    }
+
+    concurrency::thrd_result io_uring_impl::submit_sqe() noexcept {
+        if (current_loop_ == this) {
+            // 留给本轮 harvest() 的 io_uring_submit_and_wait 一并提交
+            return concurrency::thrd_result::success;
+        }
+        if (single_issuer_) {
+            // 只有事件循环线程可以进入内核提交，交由它在下一轮 harvest() 中处理
+            wakeup();
+            return concurrency::thrd_result::success;
+        }
+        const int ret = ::io_uring_submit(&ring_);
+        if (ret > 0) {
+            record_flush(static_cast<unsigned int>(ret));
+        }
+        return (ret >= 0) ? concurrency::thrd_result::success : concurrency::thrd_result::error;
+    }
+
+    bool io_uring_impl::link_timeout(io_uring_sqe *sqe, const std::uint64_t timeout_ns) noexcept {
+        // 不能经由 get_sqe()：SQ 满时它会先 flush，把 sqe 与超时拆到两次提交中
+        io_uring_sqe *timeout_sqe = ::io_uring_get_sqe(&ring_);
+        if (!timeout_sqe) {
+            return false;
+        }
+        ::__kernel_timespec &ts = link_timespecs_[static_cast<std::size_t>(timeout_sqe - ring_.sq.sqes)];
+        ts.tv_sec = static_cast<long long>(timeout_ns / 1'000'000'000ULL);
+        ts.tv_nsec = static_cast<long long>(timeout_ns % 1'000'000'000ULL);
+        sqe->flags |= IOSQE_IO_LINK;
+        ::io_uring_prep_link_timeout(timeout_sqe, &ts, 0);
+        ::io_uring_sqe_set_data(timeout_sqe, &non_op);
+        return true;
+    }
+
+    std::size_t io_uring_impl::harvest(const unsigned int wait_nr, ::__kernel_timespec *timeout) {
+        std::size_t total = drain_ready_queue();
+        if (expire_timers() != 0) {
+            total += drain_ready_queue();
+        }
+        enable_ring();
+        ::__kernel_timespec timer_timeout{};
+        if (wait_nr > 0) {
+            timeout = bound_wait_by_timers(timeout, timer_timeout);
+        }
+        const unsigned int pending = ::io_uring_sq_ready(&ring_);
+        io_uring_cqe *cqe = nullptr;
+        int ret = 0;
+        if (timeout) {
+            ret = ::io_uring_submit_and_wait_timeout(&ring_, &cqe, wait_nr, timeout, /*sigmask=*/nullptr);
+            if (pending != 0 && ret >= 0) {
+                record_flush(pending);
             }
-            in_event_loop_ = false;
+        } else if (wait_nr > 0) {
+            ret = ::io_uring_submit_and_wait(&ring_, wait_nr);
+            if (ret > 0) {
+                record_flush(static_cast<unsigned int>(ret));
+            }
+            if (ret >= 0) {
+                ret = ::io_uring_peek_cqe(&ring_, &cqe);
+            }
+        } else {
+            flush();
+            ret = ::io_uring_peek_cqe(&ring_, &cqe);
+        }
+        if (wait_nr > 0) {
+            wait_deadline_ns_.store(0, concurrency::memory_order_release);
+            if (expire_timers() != 0) {
+                total += drain_ready_queue();
+            }
+        }
+        if (ret < 0 || cqe == nullptr) {
             return total;
         }
+        total += dispatch_cqes();
+        return total;
+    }
 
-        std::size_t poll_one() override {
-            if (stopped_.load(concurrency::memory_order_acquire)) {
-                return 0;
-            }
-            in_event_loop_ = true;
-            std::size_t n = drain_ready_queue_one();
-            if (n == 0) {
-                n = harvest_one_cqe();
+    std::size_t io_uring_impl::dispatch_cqes() noexcept {
+        std::size_t total = 0;
+        unsigned head = 0;
+        unsigned cqe_count = 0;
+        io_uring_cqe *cqe = nullptr;
+        io_uring_for_each_cqe(&ring_, head, cqe) {
+            if (!handle_internal_cqe(cqe)) {
+                auto *op = static_cast<completion_op *>(::io_uring_cqe_get_data(cqe));
+                const op_result result = make_result(op, cqe);
+                op->complete(result, result.error_code == ECANCELED);
+                ++total;
             }
-            in_event_loop_ = false;
-            return n;
+            ++cqe_count;
         }
+        ::io_uring_cq_advance(&ring_, cqe_count);
+        return total;
+    }
 
-        void stop() noexcept override {
-            if (!stopped_.exchange(true, concurrency::memory_order_acq_rel)) {
-                wakeup();
+    bool io_uring_impl::handle_internal_cqe(const io_uring_cqe *cqe) noexcept {
+        const std::uint64_t data = ::io_uring_cqe_get_data64(cqe);
+        if (data & msg_ring_tag) {
+            // send_to() 在发送方环上产生的完成事件，目标环拒收时把 op 留在本环执行
+            if (cqe->res < 0) {
+                ready_queue_.push(reinterpret_cast<completion_op *>(data & ~msg_ring_tag));
             }
+            return true;
+        }
+        auto *op = reinterpret_cast<completion_op *>(data);
+        if (op == &wake_op) {
+            on_wakeup_cqe(cqe);
+            return true;
         }
+        return !op || op == &non_op;
+    }
 
-        void restart() noexcept override {
-            stopped_.store(false, concurrency::memory_order_release);
+    op_result io_uring_impl::make_result(completion_op *op, const io_uring_cqe *cqe) noexcept {
+        op_result result{};
+        result.user_data = op;
+        result.bytes_transferred = (cqe->res >= 0) ? static_cast<std::size_t>(cqe->res) : 0;
+        if (cqe->res == -EINPROGRESS) {
+            result.error_code = 0;
+        } else {
+            result.error_code = (cqe->res < 0) ? -cqe->res : 0;
+        }
+        if (cqe->flags & IORING_CQE_F_MORE) {
+            result.flags |= op_result_more;
         }
+        if (cqe->flags & IORING_CQE_F_BUFFER) {
+            result.flags |= op_result_buffer;
+            result.buffer_id = cqe->flags >> IORING_CQE_BUFFER_SHIFT;
+            result.buffers = buffer_ring_.get();
+        }
+        if (cqe->flags & IORING_CQE_F_NOTIF) {
+            result.flags |= op_result_notification;
+        }
+        return result;
+    }
 
-        RAINY_NODISCARD bool stopped() const noexcept override {
-            return stopped_.load(concurrency::memory_order_acquire);
+    std::size_t io_uring_impl::harvest_one_cqe() noexcept {
+        io_uring_cqe *cqe = nullptr;
+        if (const int ret = ::io_uring_peek_cqe(&ring_, &cqe); ret < 0 || cqe == nullptr) {
+            return 0;
         }
+        if (handle_internal_cqe(cqe)) {
+            ::io_uring_cq_advance(&ring_, 1);
+            return 0;
+        }
+        auto *op = static_cast<completion_op *>(::io_uring_cqe_get_data(cqe));
+        const op_result result = make_result(op, cqe);
+        ::io_uring_cq_advance(&ring_, 1);
+        op->complete(result, result.error_code == ECANCELED);
+        return 1;
+    }
 
-        void on_work_started() noexcept override {
-            work_count_.fetch_add(1, concurrency::memory_order_relaxed);
+    std::size_t io_uring_impl::drain_ready_queue() {
+        std::size_t total = 0;
+        // 回调中 post 的 op 也在本次排空，与逐个出队时的行为一致
+        while (completion_op *chain = take_ready_batch()) {
+            total += run_chain(chain);
         }
+        return total;
+    }
 
-        void on_work_finished() noexcept override {
-            if (work_count_.fetch_sub(1, concurrency::memory_order_acq_rel) == 1) {
-                wakeup();
-            }
+    std::size_t io_uring_impl::drain_ready_queue_one() {
+        completion_op *op = take_ready_batch();
+        if (!op) {
+            return 0;
         }
+        if (op->next) {
+            return_unrun(op->next);
+            op->next = nullptr;
+        }
+        op_result r{op, 0, 0}; // NOLINT
+        op->complete(r, false);
+        return 1;
+    }
 
-        void post_immediate_completion(completion_op *op, bool is_continuation) noexcept override { // NOLINT
-            {
-                concurrency::scoped_lock lock(ready_mutex_);
-                ready_queue_.push(op);
-            }
-            if (!in_event_loop_) {
-                wakeup();
-            }
+    completion_op *io_uring_impl::take_ready_batch() noexcept {
+        completion_op *head = nullptr;
+        if (has_backlog_.load(concurrency::memory_order_acquire)) {
+            concurrency::scoped_lock lock(backlog_mutex_);
+            head = utility::exchange(backlog_, nullptr);
+            has_backlog_.store(false, concurrency::memory_order_relaxed);
+        }
+        completion_op *fresh = ready_queue_.pop_all();
+        if (!head) {
+            return fresh;
+        }
+        completion_op *tail = head;
+        while (tail->next) {
+            tail = tail->next;
         }
+        tail->next = fresh;
+        return head;
+    }
 
-        concurrency::thrd_result associate_handle(completion_op *op, const std::uintptr_t fd, void *extra) noexcept override {
-            (void) fd;
-            (void) extra;
-            if (op) {
-                op->io_handle = &ring_;
+    void io_uring_impl::return_unrun(completion_op *chain) noexcept {
+        completion_op *tail = chain;
+        while (tail->next) {
+            tail = tail->next;
+        }
+        concurrency::scoped_lock lock(backlog_mutex_);
+        tail->next = backlog_;
+        backlog_ = chain;
+        has_backlog_.store(true, concurrency::memory_order_release);
+    }
+
+    std::size_t io_uring_impl::run_chain(completion_op *chain) {
+        std::size_t total = 0;
+        while (chain) {
+            completion_op *op = chain;
+            chain = op->next;
+            op->next = nullptr;
+            op_result r{op, 0, 0}; // NOLINT
+            try {
+                op->complete(r, false);
+            } catch (...) {
+                // 回调抛出时剩余的 op 不能丢失，留给下一次 run
+                if (chain) {
+                    return_unrun(chain);
+                }
+                throw;
             }
-            return concurrency::thrd_result::success;
+            ++total;
         }
+        return total;
+    }
 
-        RAINY_NODISCARD bool running_in_this_thread() const noexcept override {
-            return in_event_loop_;
+    void io_uring_impl::record_flush(const unsigned int carried) noexcept {
+        flush_count_.fetch_add(1, concurrency::memory_order_relaxed);
+        submitted_sqes_.fetch_add(carried, concurrency::memory_order_relaxed);
+        last_batch_.store(carried, concurrency::memory_order_relaxed);
+        std::uint32_t prev = max_batch_.load(concurrency::memory_order_relaxed);
+        while (prev < carried && !max_batch_.compare_exchange_weak(prev, carried, concurrency::memory_order_relaxed)) {
         }
+    }
 
-        RAINY_NODISCARD int concurrency_hint() const noexcept override {
-            return concurrency_hint_;
+    void io_uring_impl::wakeup() noexcept {
+        // 不从其它线程抢占 SQE：写 eventfd 只触发环上常驻的多发 poll
+        ::eventfd_write(event_fd_, 1);
+    }
+
+    bool io_uring_impl::send_to(io_uring_impl &target, completion_op *op) noexcept {
+        io_uring_sqe *sqe = get_sqe();
+        if (!sqe) {
+            return false;
         }
+        ::io_uring_prep_msg_ring(sqe, target.ring_.ring_fd, 0, reinterpret_cast<std::uint64_t>(op), 0);
+        ::io_uring_sqe_set_data64(sqe, reinterpret_cast<std::uint64_t>(op) | msg_ring_tag);
+        submit_sqe();
+        return true;
+    }
 
-        io_uring_sqe *get_sqe() noexcept {
-            return ::io_uring_get_sqe(&ring_);
+    void io_uring_impl::enable_ring() noexcept {
+        if (!ring_disabled_.load(concurrency::memory_order_acquire) || !ring_disabled_.exchange(false, concurrency::memory_order_acq_rel)) {
+            return;
         }
+        // 启用环的线程成为 SINGLE_ISSUER 的唯一提交者
+        ::io_uring_enable_rings(&ring_);
+        arm_wakeup_poll();
+    }
 
-        concurrency::thrd_result submit_sqe() noexcept {
-            const int ret = ::io_uring_submit(&ring_);
-            return (ret >= 0) ? concurrency::thrd_result::success : concurrency::thrd_result::error;
+    void io_uring_impl::arm_wakeup_poll() noexcept {
+        if (io_uring_sqe *sqe = ::io_uring_get_sqe(&ring_)) {
+            ::io_uring_prep_poll_multishot(sqe, event_fd_, POLLIN);
+            ::io_uring_sqe_set_data(sqe, &wake_op);
+            // 随调用方接下来的提交一起进入内核
         }
+    }
 
-    private:
-        std::size_t harvest(const unsigned int wait_nr, ::__kernel_timespec *timeout) {
-            std::size_t total = drain_ready_queue();
-            io_uring_cqe *cqe = nullptr;
-            int ret = 0;
-            if (timeout) {
-                ret = ::io_uring_wait_cqes(&ring_, &cqe, wait_nr, timeout, /*sigmask=*/nullptr);
-            } else if (wait_nr > 0) {
-                ret = ::io_uring_wait_cqe(&ring_, &cqe);
-            } else {
-                ret = ::io_uring_peek_cqe(&ring_, &cqe);
-            }
+    void io_uring_impl::on_wakeup_cqe(const io_uring_cqe *cqe) noexcept {
+        ::eventfd_t value = 0;
+        ::eventfd_read(event_fd_, &value);
+        if ((cqe->flags & IORING_CQE_F_MORE) == 0) {
+            arm_wakeup_poll();
+        }
+    }
 
-            if (ret < 0 || cqe == nullptr) {
-                return total;
-            }
-            unsigned head = 0;
-            unsigned cqe_count = 0;
-            io_uring_for_each_cqe(&ring_, head, cqe) {
-                if (auto *op = static_cast<completion_op *>(::io_uring_cqe_get_data(cqe)); op && op != &non_op) {
-                    op_result result{};
-                    result.user_data = op;
-                    result.bytes_transferred = (cqe->res >= 0) ? static_cast<std::size_t>(cqe->res) : 0;
-                    if (cqe->res == -EINPROGRESS) {
-                        result.error_code = 0;
+    std::size_t io_uring_impl::expire_timers() noexcept {
+        if (timer_count_.load(concurrency::memory_order_acquire) == 0) {
+            return 0;
+        }
+        completion_op *head = nullptr;
+        completion_op *tail = nullptr;
+        std::size_t count = 0;
+        {
+            concurrency::scoped_lock lock(timer_mutex_);
+            timer_entry *entry = timers_.advance(timer_wheel::steady_now_ns());
+            while (entry) {
+                timer_entry *next = entry->next;
+                entry->prev = entry->next = nullptr;
+                for (completion_op *op = entry->ops_head; op; op = op->next) {
+                    ++count;
+                }
+                if (entry->ops_head) {
+                    if (tail) {
+                        tail->next = entry->ops_head;
                     } else {
-                        result.error_code = (cqe->res < 0) ? -cqe->res : 0;
+                        head = entry->ops_head;
                     }
-
-                    op->complete(result, result.error_code == ECANCELED);
-                    ++total;
+                    tail = entry->ops_tail;
                 }
-                ++cqe_count;
+                entry->ops_head = entry->ops_tail = nullptr;
+                entry = next;
             }
-            ::io_uring_cq_advance(&ring_, cqe_count);
-            return total;
+            timer_count_.store(timers_.size(), concurrency::memory_order_seq_cst);
         }
+        if (head) {
+            // 到期的 op 与普通投递一样经由积压链表执行，run_one / poll_one 也能逐个取出
+            return_unrun(head);
+        }
+        return count;
+    }
 
-        std::size_t harvest_one_cqe() noexcept {
-            io_uring_cqe *cqe = nullptr;
-            if (const int ret = ::io_uring_peek_cqe(&ring_, &cqe); ret < 0 || cqe == nullptr) {
-                return 0;
-            }
-            auto *op = static_cast<completion_op *>(::io_uring_cqe_get_data(cqe));
-            ::io_uring_cq_advance(&ring_, 1);
-            if (!op || op == &non_op) {
-                return 0;
+    ::__kernel_timespec *io_uring_impl::bound_wait_by_timers(::__kernel_timespec *timeout, ::__kernel_timespec &storage) noexcept {
+        std::uint64_t deadline = timer_wheel::no_deadline;
+        wait_deadline_ns_.store(deadline, concurrency::memory_order_seq_cst);
+        if (timer_count_.load(concurrency::memory_order_seq_cst) != 0) {
+            concurrency::scoped_lock lock(timer_mutex_);
+            deadline = timers_.next_event_ns();
+            wait_deadline_ns_.store(deadline, concurrency::memory_order_seq_cst);
+        }
+        if (deadline == timer_wheel::no_deadline) {
+            return timeout;
+        }
+        const std::uint64_t now = timer_wheel::steady_now_ns();
+        const std::uint64_t remaining = deadline > now ? deadline - now : 0;
+        if (timeout) {
+            const std::uint64_t requested =
+                static_cast<std::uint64_t>(timeout->tv_sec) * 1'000'000'000ULL + static_cast<std::uint64_t>(timeout->tv_nsec);
+            if (requested <= remaining) {
+                return timeout;
             }
-            op_result result{};
-            result.user_data = op;
-            result.bytes_transferred = (cqe->res >= 0) ? static_cast<std::size_t>(cqe->res) : 0;
-            result.error_code = (cqe->res < 0) ? -cqe->res : 0;
-            op->complete(result, result.error_code == ECANCELED);
-            return 1;
         }
+        storage.tv_sec = static_cast<long long>(remaining / 1'000'000'000ULL);
+        storage.tv_nsec = static_cast<long long>(remaining % 1'000'000'000ULL);
+        return &storage;
+    }
+}
 
-        std::size_t drain_ready_queue() {
-            std::size_t total = 0;
-            concurrency::unique_lock lock(ready_mutex_);
-            while (!ready_queue_.empty()) {
-                completion_op *op = ready_queue_.front();
-                ready_queue_.pop();
-                lock.unlock();
-                op_result r{op, 0, 0}; // NOLINT
-                op->complete(r, false);
-                ++total;
-                lock.lock();
+namespace rainy::foundation::io::implements {
+    thread_local const io_uring_multi_impl *io_uring_multi_impl::runner_owner_ = nullptr;
+    thread_local std::size_t io_uring_multi_impl::runner_index_ = 0;
+
+    io_uring_multi_impl::io_uring_multi_impl(const io_context_options &options) noexcept : options_(options) { // NOLINT
+    }
+
+    io_uring_multi_impl::~io_uring_multi_impl() {
+        destroy();
+    }
+
+    concurrency::thrd_result io_uring_multi_impl::init(const int concurrency_hint) noexcept {
+        options_.concurrency_hint = concurrency_hint;
+        io_context_options ring_options = options_;
+        ring_options.ring_count = 1;
+        const std::size_t count = options_.ring_count == 0 ? 1 : options_.ring_count;
+        try {
+            rings_.reserve(count);
+        } catch (...) {
+            return concurrency::thrd_result::nomem;
+        }
+        for (std::size_t i = 0; i < count; ++i) {
+            std::unique_ptr<io_uring_impl> ring{new (std::nothrow) io_uring_impl(ring_options)};
+            if (!ring) {
+                destroy();
+                return concurrency::thrd_result::nomem;
             }
-            return total;
+            ring->share_state(&work_count_, &stopped_);
+            if (const auto res = ring->init(ring_options); res != concurrency::thrd_result::success) {
+                destroy();
+                return res;
+            }
+            rings_.push_back(utility::move(ring));
         }
+        return concurrency::thrd_result::success;
+    }
 
-        std::size_t drain_ready_queue_one() noexcept {
-            concurrency::unique_lock lock(ready_mutex_);
-            if (ready_queue_.empty()) {
-                return 0;
-            }
-            completion_op *op = ready_queue_.front();
-            ready_queue_.pop();
-            lock.unlock();
-            op_result r{op, 0, 0}; // NOLINT
-            op->complete(r, false);
-            return 1;
+    void io_uring_multi_impl::destroy() noexcept {
+        for (const auto &ring: rings_) {
+            ring->destroy();
+        }
+        rings_.clear();
+    }
+
+    std::size_t io_uring_multi_impl::run() {
+        return claim_ring().run();
+    }
+
+    std::size_t io_uring_multi_impl::run_one() {
+        return claim_ring().run_one();
+    }
+
+    std::size_t io_uring_multi_impl::run_one_for(const std::uint64_t timeout_ns) {
+        return claim_ring().run_one_for(timeout_ns);
+    }
+
+    std::size_t io_uring_multi_impl::poll() {
+        return claim_ring().poll();
+    }
+
+    std::size_t io_uring_multi_impl::poll_one() {
+        return claim_ring().poll_one();
+    }
+
+    void io_uring_multi_impl::stop() noexcept {
+        if (!stopped_.exchange(true, concurrency::memory_order_acq_rel)) {
+            wakeup_all();
+        }
+    }
+
+    void io_uring_multi_impl::restart() noexcept {
+        stopped_.store(false, concurrency::memory_order_release);
+    }
+
+    bool io_uring_multi_impl::stopped() const noexcept {
+        return stopped_.load(concurrency::memory_order_acquire);
+    }
+
+    void io_uring_multi_impl::on_work_started() noexcept {
+        work_count_.fetch_add(1, concurrency::memory_order_relaxed);
+    }
+
+    void io_uring_multi_impl::on_work_finished() noexcept {
+        if (work_count_.fetch_sub(1, concurrency::memory_order_acq_rel) == 1) {
+            wakeup_all();
+        }
+    }
+
+    void io_uring_multi_impl::post_immediate_completion(completion_op *op, const bool is_continuation) noexcept {
+        if (io_uring_impl *own = runner_ring()) {
+            own->post_immediate_completion(op, is_continuation);
+            return;
+        }
+        const std::size_t index = next_post_.fetch_add(1, concurrency::memory_order_relaxed) % rings_.size();
+        rings_[index]->post_immediate_completion(op, is_continuation);
+    }
+
+    void io_uring_multi_impl::post_to(const std::size_t ring, completion_op *op) noexcept {
+        io_uring_impl &target = *rings_[ring % rings_.size()];
+        io_uring_impl *own = runner_ring();
+        if (own == &target) {
+            own->post_immediate_completion(op, false);
+            return;
+        }
+        // 运行线程拥有自己环的 SQ，可以经由 MSG_RING 直接把 op 放进目标环的 CQ
+        if (own && own->running_in_this_thread() && own->send_to(target, op)) {
+            return;
+        }
+        target.post_immediate_completion(op, false);
+    }
+
+    concurrency::thrd_result io_uring_multi_impl::associate_handle(completion_op *op, const std::uintptr_t fd, void *extra) noexcept {
+        return local_ring().associate_handle(op, fd, extra);
+    }
+
+    bool io_uring_multi_impl::running_in_this_thread() const noexcept {
+        const io_uring_impl *own = runner_ring();
+        return own && own->running_in_this_thread();
+    }
+
+    int io_uring_multi_impl::concurrency_hint() const noexcept {
+        return options_.concurrency_hint;
+    }
+
+    io_context_options io_uring_multi_impl::applied_options() const noexcept {
+        io_context_options applied = rings_.empty() ? options_ : rings_.front()->applied_options();
+        applied.ring_count = static_cast<unsigned int>(rings_.size());
+        return applied;
+    }
+
+    std::size_t io_uring_multi_impl::flush() noexcept {
+        return local_ring().flush();
+    }
+
+    submission_stats io_uring_multi_impl::get_submission_stats() const noexcept {
+        submission_stats total;
+        for (const auto &ring: rings_) {
+            const submission_stats stats = ring->get_submission_stats();
+            total.flushes += stats.flushes;
+            total.submitted += stats.submitted;
+            total.max_batch = stats.max_batch > total.max_batch ? stats.max_batch : total.max_batch;
         }
+        total.last_batch = local_ring().get_submission_stats().last_batch;
+        return total;
+    }
 
-        void wakeup() noexcept {
-            io_uring_sqe *sqe = ::io_uring_get_sqe(&ring_);
-            if (!sqe) {
-                return;
+    template <typename Fn>
+    concurrency::thrd_result io_uring_multi_impl::for_each_ring(Fn &&fn) noexcept {
+        for (const auto &ring: rings_) {
+            if (const auto res = fn(*ring); res != concurrency::thrd_result::success) {
+                return res;
             }
-            ::io_uring_prep_nop(sqe);
-            ::io_uring_sqe_set_data(sqe, &non_op);
-            ::io_uring_submit(&ring_);
         }
+        return concurrency::thrd_result::success;
+    }
+
+    concurrency::thrd_result io_uring_multi_impl::setup_provided_buffers(const std::size_t buffer_count,
+                                                                         const std::size_t buffer_size) noexcept {
+        return for_each_ring([&](io_uring_impl &ring) { return ring.setup_provided_buffers(buffer_count, buffer_size); });
+    }
+
+    provided_buffer_pool *io_uring_multi_impl::provided_buffers() noexcept {
+        return local_ring().provided_buffers();
+    }
+
+    concurrency::thrd_result io_uring_multi_impl::register_files(const std::size_t capacity) noexcept {
+        return for_each_ring([&](io_uring_impl &ring) { return ring.register_files(capacity); });
+    }
+
+    concurrency::thrd_result io_uring_multi_impl::register_buffers(const std::size_t buffer_count,
+                                                                   const std::size_t buffer_size) noexcept {
+        return for_each_ring([&](io_uring_impl &ring) { return ring.register_buffers(buffer_count, buffer_size); });
+    }
+
+    fixed_buffer_pool *io_uring_multi_impl::fixed_buffers() noexcept {
+        return local_ring().fixed_buffers();
+    }
+
+    bool io_uring_multi_impl::native_timers() const noexcept {
+        return true;
+    }
+
+    concurrency::thrd_result io_uring_multi_impl::schedule_timer(timer_entry &entry, const std::uint64_t deadline_ns,
+                                                                 timer_op *op) noexcept {
+        // 定时器首次调度时固定在发起线程的环上，之后的等待与取消都交给同一个环
+        io_context_impl_base *owner = entry.owner ? entry.owner : &local_ring();
+        return owner->schedule_timer(entry, deadline_ns, op);
+    }
+
+    std::size_t io_uring_multi_impl::cancel_timer(timer_entry &entry, const std::size_t max_count) noexcept {
+        return entry.owner ? entry.owner->cancel_timer(entry, max_count) : 0;
+    }
+
+    io_uring_impl *io_uring_multi_impl::runner_ring() const noexcept {
+        if (runner_owner_ != this || runner_index_ >= rings_.size()) {
+            return nullptr;
+        }
+        return rings_[runner_index_].get();
+    }
+
+    io_uring_impl &io_uring_multi_impl::claim_ring() noexcept {
+        if (io_uring_impl *own = runner_ring()) {
+            return *own;
+        }
+        runner_owner_ = this;
+        runner_index_ = next_runner_.fetch_add(1, concurrency::memory_order_relaxed) % rings_.size();
+        return *rings_[runner_index_];
+    }
 
-        concurrency::mutex ready_mutex_;
-        std::queue<completion_op *> ready_queue_;
-        io_uring ring_{};
-        bool ring_initialized_{false};
-        int concurrency_hint_{0};
-        int event_fd_{-1};
-        static thread_local bool in_event_loop_;
-    };
+    io_uring_impl &io_uring_multi_impl::local_ring() const noexcept {
+        io_uring_impl *own = runner_ring();
+        return own ? *own : *rings_.front();
+    }
 
-    thread_local bool io_uring_impl::in_event_loop_ = false;
+    void io_uring_multi_impl::wakeup_all() noexcept {
+        for (const auto &ring: rings_) {
+            ring->wakeup();
+        }
+    }
 }
 
 namespace rainy::foundation::io::implements {
-    memory::nebula_ptr<io_context_impl_base> create_io_context_impl(int concurrency_hint) {
-        auto impl = memory::make_nebula<io_uring_impl>(concurrency_hint);
-        impl->init(concurrency_hint);
+    memory::nebula_ptr<io_context_impl_base> create_io_context_impl(const io_context_options &options) {
+        if (options.ring_count > 1) {
+            // 任何一个环创建失败都退回单环，applied_options().ring_count 随之为 1
+            if (auto impl = memory::make_nebula<io_uring_multi_impl>(options);
+                impl->init(options.concurrency_hint) == concurrency::thrd_result::success) {
+                return impl;
+            }
+        }
+        auto impl = memory::make_nebula<io_uring_impl>(options);
+        impl->init(options);
         return impl;
     }
+
+    memory::nebula_ptr<io_context_impl_base> create_io_context_impl(int concurrency_hint) {
+        io_context_options options;
+        options.concurrency_hint = concurrency_hint;
+        return create_io_context_impl(options);
+    }
 }
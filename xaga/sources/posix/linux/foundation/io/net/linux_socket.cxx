@@ -16,16 +16,18 @@
 
 // NOLINTBEGIN
 #include <cerrno>
+#include <cstring>
 #include <fcntl.h>
 #include <liburing.h>
 #include <netinet/in.h>
+#include <new>
 #include <sys/ioctl.h>
 #include <sys/poll.h>
 #include <sys/socket.h>
 #include <unistd.h>
 // NOLINTEND
 
-#include <rainy/foundation/io/executor/implements/io_context.hpp>
+#include <rainy/foundation/io/executor/implements/io_uring.hpp>
 #include <rainy/foundation/io/net/implements/sock.hpp>
 
 namespace rainy::foundation::io::net::implements {
@@ -36,12 +38,11 @@ namespace rainy::foundation::io::net::implements {
     struct linux_socket_proxy : io_context::executor_type {
         io_uring_sqe *get_sqe_from_op(io::implements::completion_op *op, io_context::executor_type executor, const int fd) { // NOLINT
             this->associate_handle(op, static_cast<std::uintptr_t>(fd), nullptr);
-            if (!op->io_handle) {
-                return nullptr;
-            }
-            return ::io_uring_get_sqe(static_cast<io_uring *>(op->io_handle));
+            auto *ring = io::implements::io_uring_impl::from_op(op);
+            return ring ? ring->get_sqe() : nullptr;
         }
 
+        using executor_type::associate_handle;
         using executor_type::post_immediate_completion;
     };
 
@@ -50,11 +51,95 @@ namespace rainy::foundation::io::net::implements {
     }
 
     static void submit_ring(const io::implements::completion_op *op) noexcept {
-        if (op->io_handle) {
-            ::io_uring_submit(static_cast<io_uring *>(op->io_handle));
+        if (auto *ring = io::implements::io_uring_impl::from_op(op)) {
+            ring->submit_sqe();
         }
     }
 
+    /**
+     * @brief 零拷贝发送与聚集发送共用的中间 op
+     *
+     * SEND_ZC / SENDMSG_ZC 先投递带 IORING_CQE_F_MORE 的发送结果，内核不再引用用户页面后再投递通知事件，
+     * 调用方的 op 以发送结果完成，但要等到通知到达；普通 sendmsg 没有通知，首个事件即完成。
+     * msghdr 与 iovec 存放在这里，直到内核读取之前都保持有效。
+     */
+    struct send_relay_op final : io::implements::completion_op {
+        static constexpr std::size_t max_segments = io::implements::buffer_sequence_array<const_buffer>::max_segments;
+
+        explicit send_relay_op(completion_op *target) noexcept : completion_op(&do_complete), target(target) {
+            io_handle = target->io_handle;
+        }
+
+        void gather(const const_buffer *buffers, std::size_t count) noexcept {
+            count = count < max_segments ? count : max_segments;
+            for (std::size_t i = 0; i < count; ++i) {
+                iov[i].iov_base = const_cast<void *>(buffers[i].data());
+                iov[i].iov_len = buffers[i].size();
+            }
+            msg.msg_iov = iov;
+            msg.msg_iovlen = count;
+        }
+
+        static void do_complete(completion_op *self, const io::implements::op_result &res, bool /*cancelled*/) {
+            auto *op = static_cast<send_relay_op *>(self);
+            if ((res.flags & io::implements::op_result_notification) == 0) {
+                op->result = res;
+                if (res.flags & io::implements::op_result_more) {
+                    return; // 缓冲区仍被内核引用，等待通知
+                }
+            }
+            io::implements::op_result result = op->result;
+            result.user_data = op->target;
+            result.flags = io::implements::op_result_none;
+            completion_op *target = op->target;
+            delete op;
+            target->complete(result, result.error_code == ECANCELED);
+        }
+
+        completion_op *target;
+        io::implements::op_result result{};
+        ::msghdr msg{};
+        ::iovec iov[max_segments]{};
+    };
+
+    /**
+     * @brief recvmsg 与 accept 使用的中间 op
+     *
+     * 内核在操作完成时才回写 msghdr 的 msg_namelen / msg_flags 与 accept 的 addrlen，而 SQE 下标在被消费后即可复用，
+     * 因此这些状态不能放在 sqe_scratch 中，而是随本对象存活到 CQE 到达，再把结果原样转交给调用方的 op。
+     */
+    struct receive_relay_op final : io::implements::completion_op {
+        static constexpr std::size_t max_segments = io::implements::buffer_sequence_array<mutable_buffer>::max_segments;
+
+        explicit receive_relay_op(completion_op *target) noexcept : completion_op(&do_complete), target(target) {
+            io_handle = target->io_handle;
+        }
+
+        void gather(const mutable_buffer *buffers, std::size_t count) noexcept {
+            count = count < max_segments ? count : max_segments;
+            for (std::size_t i = 0; i < count; ++i) {
+                iov[i].iov_base = buffers[i].data();
+                iov[i].iov_len = buffers[i].size();
+            }
+            msg.msg_iov = iov;
+            msg.msg_iovlen = count;
+        }
+
+        static void do_complete(completion_op *self, const io::implements::op_result &res, bool /*cancelled*/) {
+            auto *op = static_cast<receive_relay_op *>(self);
+            io::implements::op_result result = res;
+            result.user_data = op->target;
+            completion_op *target = op->target;
+            delete op;
+            target->complete(result, result.error_code == ECANCELED);
+        }
+
+        completion_op *target;
+        ::msghdr msg{};
+        ::iovec iov[max_segments]{};
+        ::socklen_t addrlen{0};
+    };
+
     class linux_socket_impl final : public socket_impl_base {
     public:
         linux_socket_impl() = default;
@@ -91,6 +176,7 @@ namespace rainy::foundation::io::net::implements {
         }
 
         native_socket_t release() noexcept override {
+            slot_.reset();
             const native_socket_t fd = fd_;
             fd_ = -1;
             return fd;
@@ -100,6 +186,7 @@ namespace rainy::foundation::io::net::implements {
             if (fd_ < 0) {
                 return {};
             }
+            slot_.reset(); // 槽位持有套接字的引用，不先释放则 close 不会真正关闭连接
             const int ret = ::close(fd_);
             fd_ = -1;
             return ret == 0 ? std::error_code{} : posix_error();
@@ -277,38 +364,117 @@ namespace rainy::foundation::io::net::implements {
         }
 
         void async_connect(const raw_endpoint &ep, io_context::executor_type executor, completion_op *op) noexcept override {
+            start_connect(ep, 0, executor, op);
+        }
+
+        void async_connect_for(const raw_endpoint &ep, const std::uint64_t timeout_ns, io_context::executor_type executor,
+                               completion_op *op) noexcept override {
+            start_connect(ep, timeout_ns, executor, op);
+        }
+
+        void async_send(const void *buf, const std::size_t len, const message_flags_t flags, io_context::executor_type executor,
+                        completion_op *op) noexcept override {
+            start_send(buf, len, flags, 0, false, executor, op);
+        }
+
+        void async_send_for(const void *buf, const std::size_t len, const message_flags_t flags, const std::uint64_t timeout_ns,
+                            io_context::executor_type executor, completion_op *op) noexcept override {
+            start_send(buf, len, flags, timeout_ns, false, executor, op);
+        }
+
+        void async_receive(void *buf, const std::size_t len, const message_flags_t flags, io_context::executor_type executor,
+                           completion_op *op) noexcept override {
+            start_receive(buf, len, flags, 0, executor, op);
+        }
+
+        void async_receive_for(void *buf, const std::size_t len, const message_flags_t flags, const std::uint64_t timeout_ns,
+                               io_context::executor_type executor, completion_op *op) noexcept override {
+            start_receive(buf, len, flags, timeout_ns, executor, op);
+        }
+
+        void async_sendv(const const_buffer *buffers, const std::size_t count, const message_flags_t flags,
+                         const std::uint64_t timeout_ns, io_context::executor_type executor, completion_op *op) noexcept override {
+            if (count <= 1) {
+                const const_buffer first = count != 0 ? buffers[0] : const_buffer{};
+                start_send(first.data(), first.size(), flags, timeout_ns, false, executor, op);
+                return;
+            }
             auto *sqe = get_sqe_from_op(op, executor, fd_);
             if (!sqe) {
                 linux_socket_proxy{executor}.post_immediate_completion(op, false);
                 return;
             }
-            ::io_uring_prep_connect(sqe, fd_, reinterpret_cast<const ::sockaddr *>(ep.data), static_cast<::socklen_t>(ep.size));
+            auto *ring = io::implements::io_uring_impl::from_op(op);
+            auto &scratch = ring->scratch_for(sqe);
+            scratch.gather(buffers, count);
+            ::io_uring_prep_sendmsg(sqe, fd_, &scratch.msg, flags);
+            slot_.apply(ring, sqe, fd_);
             ::io_uring_sqe_set_data(sqe, op);
+            if (timeout_ns != 0) {
+                ring->link_timeout(sqe, timeout_ns);
+            }
             submit_ring(op);
         }
 
-        void async_send(const void *buf, const std::size_t len, const message_flags_t flags, io_context::executor_type executor,
-                        completion_op *op) noexcept override {
+        void async_receivev(const mutable_buffer *buffers, const std::size_t count, const message_flags_t flags,
+                            const std::uint64_t timeout_ns, io_context::executor_type executor, completion_op *op) noexcept override {
+            if (count <= 1) {
+                const mutable_buffer first = count != 0 ? buffers[0] : mutable_buffer{};
+                start_receive(first.data(), first.size(), flags, timeout_ns, executor, op);
+                return;
+            }
             auto *sqe = get_sqe_from_op(op, executor, fd_);
             if (!sqe) {
                 linux_socket_proxy{executor}.post_immediate_completion(op, false);
                 return;
             }
-            ::io_uring_prep_send(sqe, fd_, buf, len, flags);
-            ::io_uring_sqe_set_data(sqe, op);
+            auto *ring = io::implements::io_uring_impl::from_op(op);
+            auto *relay = new (std::nothrow) receive_relay_op(op);
+            if (!relay) {
+                ::io_uring_prep_nop(sqe);
+                ::io_uring_sqe_set_data(sqe, nullptr);
+                start_receive(buffers[0].data(), buffers[0].size(), flags, timeout_ns, executor, op);
+                return;
+            }
+            relay->gather(buffers, count);
+            ::io_uring_prep_recvmsg(sqe, fd_, &relay->msg, flags);
+            slot_.apply(ring, sqe, fd_);
+            ::io_uring_sqe_set_data(sqe, relay);
+            if (timeout_ns != 0) {
+                ring->link_timeout(sqe, timeout_ns);
+            }
             submit_ring(op);
         }
 
-        void async_receive(void *buf, const std::size_t len, const message_flags_t flags, io_context::executor_type executor,
-                           completion_op *op) noexcept override {
+        void async_send_zero_copy(const const_buffer *buffers, const std::size_t count, const message_flags_t flags,
+                                  io_context::executor_type executor, completion_op *op) noexcept override {
+            if (count <= 1) {
+                const const_buffer first = count != 0 ? buffers[0] : const_buffer{};
+                start_send(first.data(), first.size(), flags, 0, true, executor, op);
+                return;
+            }
             auto *sqe = get_sqe_from_op(op, executor, fd_);
             if (!sqe) {
                 linux_socket_proxy{executor}.post_immediate_completion(op, false);
                 return;
             }
-            ::io_uring_prep_recv(sqe, fd_, buf, len, flags);
-            ::io_uring_sqe_set_data(sqe, op);
-            submit_ring(op);
+            auto *ring = io::implements::io_uring_impl::from_op(op);
+            auto *relay = new (std::nothrow) send_relay_op(op);
+            if (!relay) {
+                ::io_uring_prep_nop(sqe);
+                ::io_uring_sqe_set_data(sqe, nullptr);
+                start_send(buffers[0].data(), buffers[0].size(), flags, 0, true, executor, op);
+                return;
+            }
+            relay->gather(buffers, count);
+            if (zero_copy_capable(ring)) {
+                ::io_uring_prep_sendmsg_zc(sqe, fd_, &relay->msg, flags);
+            } else {
+                ::io_uring_prep_sendmsg(sqe, fd_, &relay->msg, flags);
+            }
+            slot_.apply(ring, sqe, fd_);
+            ::io_uring_sqe_set_data(sqe, relay);
+            ring->submit_sqe();
         }
 
         void async_send_to(const void *buf, const std::size_t len, const message_flags_t flags, const raw_endpoint &dest,
@@ -318,16 +484,14 @@ namespace rainy::foundation::io::net::implements {
                 linux_socket_proxy{executor}.post_immediate_completion(op, false);
                 return;
             }
-            static thread_local ::iovec iov{};
-            static thread_local ::msghdr msg{};
-            iov.iov_base = const_cast<void *>(buf);
-            iov.iov_len = len;
-            msg = {};
-            msg.msg_name = const_cast<void *>(static_cast<const void *>(dest.data));
-            msg.msg_namelen = static_cast<::socklen_t>(dest.size);
-            msg.msg_iov = &iov;
-            msg.msg_iovlen = 1;
-            ::io_uring_prep_sendmsg(sqe, fd_, &msg, flags);
+            // dest 通常是调用方的局部变量，而 SQE 要到本轮循环末尾才提交，因此连同地址一起复制到 sqe 专属的分段表
+            auto &scratch = io::implements::io_uring_impl::from_op(op)->scratch_for(sqe);
+            const std::size_t namelen = dest.size < sizeof(scratch.name) ? dest.size : sizeof(scratch.name);
+            std::memcpy(&scratch.name, dest.data, namelen);
+            scratch.gather_one(const_cast<void *>(buf), len);
+            scratch.msg.msg_name = &scratch.name;
+            scratch.msg.msg_namelen = static_cast<::socklen_t>(namelen);
+            ::io_uring_prep_sendmsg(sqe, fd_, &scratch.msg, flags);
             ::io_uring_sqe_set_data(sqe, op);
             submit_ring(op);
         }
@@ -339,17 +503,19 @@ namespace rainy::foundation::io::net::implements {
                linux_socket_proxy{executor}.post_immediate_completion(op, false);
                 return;
             }
-            thread_local ::iovec iov{};
-            thread_local ::msghdr msg{};
-            iov.iov_base = buf;
-            iov.iov_len = len;
-            msg = {};
-            msg.msg_name = sender.data;
-            msg.msg_namelen = static_cast<::socklen_t>(sizeof(sender.data));
-            msg.msg_iov = &iov;
-            msg.msg_iovlen = 1;
-            ::io_uring_prep_recvmsg(sqe, fd_, &msg, flags);
-            ::io_uring_sqe_set_data(sqe, op);
+            auto *relay = new (std::nothrow) receive_relay_op(op);
+            if (!relay) {
+                ::io_uring_prep_nop(sqe);
+                ::io_uring_sqe_set_data(sqe, nullptr);
+                linux_socket_proxy{executor}.post_immediate_completion(op, false);
+                return;
+            }
+            const mutable_buffer buffer{buf, len};
+            relay->gather(&buffer, 1);
+            relay->msg.msg_name = sender.data;
+            relay->msg.msg_namelen = static_cast<::socklen_t>(sizeof(sender.data));
+            ::io_uring_prep_recvmsg(sqe, fd_, &relay->msg, flags);
+            ::io_uring_sqe_set_data(sqe, relay);
             submit_ring(op);
         }
 
@@ -359,10 +525,22 @@ namespace rainy::foundation::io::net::implements {
                 linux_socket_proxy{executor}.post_immediate_completion(op, false);
                 return;
             }
-            thread_local ::socklen_t addrlen = peer_ep ? static_cast<::socklen_t>(sizeof(peer_ep->data)) : 0;
-            ::io_uring_prep_accept(sqe, fd_, peer_ep ? reinterpret_cast<::sockaddr *>(peer_ep->data) : nullptr, &addrlen,
-                                   SOCK_CLOEXEC);
-            ::io_uring_sqe_set_data(sqe, op);
+            if (!peer_ep) {
+                ::io_uring_prep_accept(sqe, fd_, nullptr, nullptr, SOCK_CLOEXEC);
+                ::io_uring_sqe_set_data(sqe, op);
+                submit_ring(op);
+                return;
+            }
+            auto *relay = new (std::nothrow) receive_relay_op(op);
+            if (!relay) {
+                ::io_uring_prep_nop(sqe);
+                ::io_uring_sqe_set_data(sqe, nullptr);
+                linux_socket_proxy{executor}.post_immediate_completion(op, false);
+                return;
+            }
+            relay->addrlen = static_cast<::socklen_t>(sizeof(peer_ep->data));
+            ::io_uring_prep_accept(sqe, fd_, reinterpret_cast<::sockaddr *>(peer_ep->data), &relay->addrlen, SOCK_CLOEXEC);
+            ::io_uring_sqe_set_data(sqe, relay);
             submit_ring(op);
         }
 
@@ -385,11 +563,130 @@ namespace rainy::foundation::io::net::implements {
                     break;
             }
             ::io_uring_prep_poll_add(sqe, fd_, poll_mask);
+            slot_.apply(io::implements::io_uring_impl::from_op(op), sqe, fd_);
+            ::io_uring_sqe_set_data(sqe, op);
+            submit_ring(op);
+        }
+
+        void async_accept_multishot(io_context::executor_type executor, completion_op *op) noexcept override {
+            auto *sqe = get_sqe_from_op(op, executor, fd_);
+            if (!sqe) {
+                op->complete(io::implements::op_result{op, 0, EBUSY}, false);
+                return;
+            }
+            // 多发模式下各次完成共享地址缓冲区，因此不取对端地址，需要时由调用方 remote_endpoint() 查询
+            ::io_uring_prep_multishot_accept(sqe, fd_, nullptr, nullptr, SOCK_CLOEXEC);
             ::io_uring_sqe_set_data(sqe, op);
             submit_ring(op);
         }
 
+        void async_receive_multishot(const message_flags_t flags, io_context::executor_type executor,
+                                     completion_op *op) noexcept override {
+            linux_socket_proxy{executor}.associate_handle(op, static_cast<std::uintptr_t>(fd_), nullptr);
+            auto *ring = io::implements::io_uring_impl::from_op(op);
+            auto *buffers = ring ? ring->buffer_ring() : nullptr;
+            if (!buffers) {
+                op->complete(io::implements::op_result{op, 0, ENOBUFS}, false);
+                return;
+            }
+            auto *sqe = ring->get_sqe();
+            if (!sqe) {
+                op->complete(io::implements::op_result{op, 0, EBUSY}, false);
+                return;
+            }
+            ::io_uring_prep_recv_multishot(sqe, fd_, nullptr, 0, flags);
+            ::io_uring_sqe_set_flags(sqe, IOSQE_BUFFER_SELECT);
+            sqe->buf_group = static_cast<std::uint16_t>(buffers->group_id());
+            slot_.apply(ring, sqe, fd_);
+            ::io_uring_sqe_set_data(sqe, op);
+            ring->submit_sqe();
+        }
+
     private:
+        void start_connect(const raw_endpoint &ep, const std::uint64_t timeout_ns, const io_context::executor_type &executor,
+                           completion_op *op) noexcept {
+            auto *sqe = get_sqe_from_op(op, executor, fd_);
+            if (!sqe) {
+                linux_socket_proxy{executor}.post_immediate_completion(op, false);
+                return;
+            }
+            auto *ring = io::implements::io_uring_impl::from_op(op);
+            ::io_uring_prep_connect(sqe, fd_, reinterpret_cast<const ::sockaddr *>(ep.data), static_cast<::socklen_t>(ep.size));
+            slot_.apply(ring, sqe, fd_);
+            ::io_uring_sqe_set_data(sqe, op);
+            if (timeout_ns != 0) {
+                ring->link_timeout(sqe, timeout_ns);
+            }
+            submit_ring(op);
+        }
+
+        void start_send(const void *buf, const std::size_t len, const message_flags_t flags, const std::uint64_t timeout_ns,
+                        const bool zero_copy, const io_context::executor_type &executor, completion_op *op) noexcept {
+            auto *sqe = get_sqe_from_op(op, executor, fd_);
+            if (!sqe) {
+                linux_socket_proxy{executor}.post_immediate_completion(op, false);
+                return;
+            }
+            auto *ring = io::implements::io_uring_impl::from_op(op);
+            send_relay_op *relay = nullptr;
+            if (zero_copy_capable(ring) && (zero_copy || (zero_copy_threshold_ != 0 && len >= zero_copy_threshold_))) {
+                relay = new (std::nothrow) send_relay_op(op); // 分配失败时退回复制发送
+            }
+            if (relay) {
+                // SEND_ZC 可以直接引用固定缓冲区，并且保留 send 标志
+                if (const int index = ring->fixed_buffer_index(buf, len); index >= 0) {
+                    ::io_uring_prep_send_zc_fixed(sqe, fd_, buf, len, flags, 0, static_cast<unsigned int>(index));
+                } else {
+                    ::io_uring_prep_send_zc(sqe, fd_, buf, len, flags, 0);
+                }
+            } else if (const int index = fixed_buffer_index(ring, buf, len, flags); index >= 0) {
+                // 固定缓冲区只能走 write_fixed，它不带 send 标志，因此仅在无标志的流套接字上使用
+                ::io_uring_prep_write_fixed(sqe, fd_, buf, static_cast<unsigned int>(len), 0, index);
+            } else {
+                ::io_uring_prep_send(sqe, fd_, buf, len, flags);
+            }
+            slot_.apply(ring, sqe, fd_);
+            ::io_uring_sqe_set_data(sqe, relay ? static_cast<completion_op *>(relay) : op);
+            if (timeout_ns != 0) {
+                ring->link_timeout(sqe, timeout_ns);
+            }
+            submit_ring(op);
+        }
+
+        void start_receive(void *buf, const std::size_t len, const message_flags_t flags, const std::uint64_t timeout_ns,
+                           const io_context::executor_type &executor, completion_op *op) noexcept {
+            auto *sqe = get_sqe_from_op(op, executor, fd_);
+            if (!sqe) {
+                linux_socket_proxy{executor}.post_immediate_completion(op, false);
+                return;
+            }
+            auto *ring = io::implements::io_uring_impl::from_op(op);
+            if (const int index = fixed_buffer_index(ring, buf, len, flags); index >= 0) {
+                ::io_uring_prep_read_fixed(sqe, fd_, buf, static_cast<unsigned int>(len), 0, index);
+            } else {
+                ::io_uring_prep_recv(sqe, fd_, buf, len, flags);
+            }
+            slot_.apply(ring, sqe, fd_);
+            ::io_uring_sqe_set_data(sqe, op);
+            if (timeout_ns != 0) {
+                ring->link_timeout(sqe, timeout_ns);
+            }
+            submit_ring(op);
+        }
+
+        // SEND_ZC 只对 TCP / UDP 有意义，AF_UNIX 等会以 EOPNOTSUPP 拒绝
+        RAINY_NODISCARD bool zero_copy_capable(const io::implements::io_uring_impl *ring) const noexcept {
+            return ring && ring->supports_zero_copy_send() && (af_ == AF_INET || af_ == AF_INET6);
+        }
+
+        RAINY_NODISCARD int fixed_buffer_index(const io::implements::io_uring_impl *ring, const void *buf, const std::size_t len,
+                                               const message_flags_t flags) const noexcept {
+            if (!ring || flags != 0 || type_ != SOCK_STREAM) {
+                return -1;
+            }
+            return ring->fixed_buffer_index(buf, len);
+        }
+
         std::error_code apply_nonblock(const bool mode) noexcept { // NOLINT
             int flags = ::fcntl(fd_, F_GETFL, 0);
             if (flags < 0) {
@@ -404,6 +701,7 @@ namespace rainy::foundation::io::net::implements {
         int af_{0};
         int type_{0};
         int proto_{0};
+        io::implements::io_uring_file_slot slot_;
     };
 
     memory::nebula_ptr<socket_impl_base> create_socket_impl() {
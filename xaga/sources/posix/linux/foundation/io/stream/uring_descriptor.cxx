@@ -13,15 +13,17 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  */
-#include <rainy/foundation/io/executor/implements/io_context.hpp>
+#include <rainy/foundation/io/executor/implements/io_uring.hpp>
 #include <rainy/foundation/concurrency/executor.hpp>
 #include <rainy/foundation/io/stream/implements/descriptor.hpp>
 
+#include <array>
 #include <cerrno>
 #include <cstring>
 #include <fcntl.h>
 #include <liburing.h>
 #include <sys/ioctl.h>
+#include <sys/uio.h>
 #include <unistd.h>
 
 namespace rainy::foundation::io::stream::implements {
@@ -48,10 +50,8 @@ namespace rainy::foundation::io::stream::implements {
 
         io_uring_sqe *get_sqe(io::implements::completion_op *op, io_context::executor_type executor, int fd) noexcept {
             this->associate_handle(op, static_cast<std::uintptr_t>(fd), nullptr);
-            if (!op->io_handle) {
-                return nullptr;
-            }
-            return ::io_uring_get_sqe(static_cast<io_uring *>(op->io_handle));
+            auto *ring = io::implements::io_uring_impl::from_op(op);
+            return ring ? ring->get_sqe() : nullptr;
         }
     };
 
@@ -60,8 +60,8 @@ namespace rainy::foundation::io::stream::implements {
     }
 
     static void submit_ring(io::implements::completion_op *op) noexcept {
-        if (op->io_handle) {
-            ::io_uring_submit(static_cast<io_uring *>(op->io_handle));
+        if (auto *ring = io::implements::io_uring_impl::from_op(op)) {
+            ring->submit_sqe();
         }
     }
 
@@ -212,6 +212,66 @@ namespace rainy::foundation::io::stream::implements {
             }
         }
 
+        void async_readv(const mutable_buffer *buffers, std::size_t count, executor_type executor,
+                         completion_op *op) noexcept override {
+            if (count <= 1 || fd_ < 0) {
+                descriptor_impl_base::async_readv(buffers, count, executor, op);
+                return;
+            }
+            auto *sqe = get_sqe(op, executor, fd_);
+            if (!sqe) {
+                linux_stream_proxy{executor}.post_immediate_completion(op, false);
+                return;
+            }
+            wants_read_ = true;
+            auto &scratch = io::implements::io_uring_impl::from_op(op)->scratch_for(sqe);
+            count = scratch.gather(buffers, count);
+            ::io_uring_prep_readv(sqe, fd_, scratch.iov, static_cast<unsigned>(count), 0);
+            ::io_uring_sqe_set_data(sqe, op);
+            submit_ring(op);
+        }
+
+        void async_writev(const const_buffer *buffers, std::size_t count, executor_type executor,
+                          completion_op *op) noexcept override {
+            if (count <= 1 || fd_ < 0) {
+                descriptor_impl_base::async_writev(buffers, count, executor, op);
+                return;
+            }
+            if (is_same_fd(fd_, STDOUT_FILENO) || is_same_fd(fd_, STDERR_FILENO)) {
+                // 与 async_write_some 相同，标准输出走线程池；iovec 随任务按值复制
+                wants_write_ = true;
+                std::array<::iovec, io::implements::io_uring_impl::max_iovecs> iov{};
+                count = count < iov.size() ? count : iov.size();
+                for (std::size_t i = 0; i < count; ++i) {
+                    iov[i].iov_base = const_cast<void *>(buffers[i].data());
+                    iov[i].iov_len = buffers[i].size();
+                }
+                get_executor().submit([fd = fd_, iov, count, op]() mutable {
+                    op_result result{};
+                    result.user_data = op;
+                    const ::ssize_t n = ::writev(fd, iov.data(), static_cast<int>(count));
+                    if (n < 0) {
+                        result.error_code = errno;
+                    } else {
+                        result.bytes_transferred = static_cast<std::size_t>(n);
+                    }
+                    op->complete(result, false);
+                });
+                return;
+            }
+            auto *sqe = get_sqe(op, executor, fd_);
+            if (!sqe) {
+                linux_stream_proxy{executor}.post_immediate_completion(op, false);
+                return;
+            }
+            wants_write_ = true;
+            auto &scratch = io::implements::io_uring_impl::from_op(op)->scratch_for(sqe);
+            count = scratch.gather(buffers, count);
+            ::io_uring_prep_writev(sqe, fd_, scratch.iov, static_cast<unsigned>(count), 0);
+            ::io_uring_sqe_set_data(sqe, op);
+            submit_ring(op);
+        }
+
         bool wants_read() const noexcept override {
             return wants_read_;
         }
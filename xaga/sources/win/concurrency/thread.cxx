@@ -15,6 +15,7 @@
  */
 #include <rainy/foundation/concurrency/pal.hpp>
 #include <rainy/foundation/diagnostics/contract.hpp>
+#include <iterator>
 #include <windows.h>
 
 namespace rainy::foundation::concurrency::implements {
@@ -188,4 +189,56 @@ namespace rainy::foundation::concurrency::implements {
             }
         }
     }
+
+    thrd_result thread_set_affinity(schd_thread_t thread_handle, const std::size_t *cpus, const std::size_t count) noexcept {
+        if (!thread_handle.handle || !cpus || count == 0) {
+            errno = EINVAL;
+            return thrd_result::error;
+        }
+        // 只处理当前处理器组内的前 64 个逻辑处理器
+        DWORD_PTR mask = 0;
+        for (std::size_t i = 0; i < count; ++i) {
+            if (cpus[i] >= sizeof(DWORD_PTR) * 8) {
+                errno = EINVAL;
+                return thrd_result::error;
+            }
+            mask |= static_cast<DWORD_PTR>(1) << cpus[i];
+        }
+        if (SetThreadAffinityMask(reinterpret_cast<HANDLE>(thread_handle.handle), mask) == 0) {
+            errno = GetLastError() == ERROR_ACCESS_DENIED ? EACCES : EINVAL;
+            return thrd_result::error;
+        }
+        return thrd_result::success;
+    }
+
+    thrd_result thread_set_name(schd_thread_t thread_handle, const char *name) noexcept {
+        if (!thread_handle.handle || !name) {
+            errno = EINVAL;
+            return thrd_result::error;
+        }
+        wchar_t wide[64]{};
+        if (MultiByteToWideChar(CP_UTF8, 0, name, -1, wide, static_cast<int>(std::size(wide))) == 0) {
+            // 名称过长时截断
+            wide[std::size(wide) - 1] = L'\0';
+        }
+        if (FAILED(SetThreadDescription(reinterpret_cast<HANDLE>(thread_handle.handle), wide))) {
+            errno = EINVAL;
+            return thrd_result::error;
+        }
+        return thrd_result::success;
+    }
+
+    thrd_result thread_set_priority(schd_thread_t thread_handle, const int level) noexcept {
+        if (!thread_handle.handle || level < -2 || level > 2) {
+            errno = EINVAL;
+            return thrd_result::error;
+        }
+        static constexpr int priority_table[] = {THREAD_PRIORITY_LOWEST, THREAD_PRIORITY_BELOW_NORMAL, THREAD_PRIORITY_NORMAL,
+                                                 THREAD_PRIORITY_ABOVE_NORMAL, THREAD_PRIORITY_HIGHEST};
+        if (!SetThreadPriority(reinterpret_cast<HANDLE>(thread_handle.handle), priority_table[level + 2])) {
+            errno = GetLastError() == ERROR_ACCESS_DENIED ? EACCES : EINVAL;
+            return thrd_result::error;
+        }
+        return thrd_result::success;
+    }
 }
@@ -221,6 +221,14 @@ namespace rainy::foundation::io::filesystem::implements {
             return {};
         }
 
+        std::error_code sync(const bool data_only) noexcept override {
+            (void) data_only; // Windows 没有只刷数据的等价物
+            if (!::FlushFileBuffers(handle_)) {
+                return last_error();
+            }
+            return {};
+        }
+
         std::uintptr_t native_handle() const noexcept override {
             return reinterpret_cast<std::uintptr_t>(handle_);
         }
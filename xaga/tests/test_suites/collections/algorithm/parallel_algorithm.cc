@@ -0,0 +1,98 @@
+#include <catch2/catch_test_macros.hpp>
+#include <list>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#include <rainy/collections/algorithm/modify_algorithm_paralell.hpp>
+
+namespace execution = rainy::collections::algorithm::execution;
+namespace ops = rainy::collections::algorithm::container_operater;
+using namespace rainy::foundation::concurrency;
+
+SCENARIO("fork_join_group runs nested forks and propagates errors", "[fork_join]") {
+    GIVEN("a small pooled pool") {
+        pooled_actor_pool pool(4);
+
+        WHEN("parallel_for sums a range with a tiny grain") {
+            atomic<long long> sum{0};
+            parallel_for(pool, 0, 10000, 7, [&](const std::size_t b, const std::size_t e) {
+                long long local = 0;
+                for (std::size_t i = b; i < e; ++i) {
+                    local += static_cast<long long>(i);
+                }
+                sum.fetch_add(local, memory_order_relaxed);
+            });
+            THEN("every index is visited exactly once") {
+                REQUIRE(sum.load() == 49995000LL);
+            }
+        }
+
+        WHEN("a forked child throws") {
+            fork_join_group group(pool);
+            group.fork([] { throw std::runtime_error("child"); });
+            group.fork([] {});
+            THEN("join rethrows on the calling thread") {
+                REQUIRE_THROWS_AS(group.join(), std::runtime_error);
+            }
+        }
+    }
+}
+
+SCENARIO("parallel algorithms match their sequential results", "[fork_join][algorithm]") {
+    GIVEN("a large input and a small grain") {
+        constexpr std::size_t count = 100000;
+        std::vector<long long> input(count);
+        std::iota(input.begin(), input.end(), 1);
+        const execution::parallel_policy policy = execution::with_grain(execution::par, 1000);
+
+        THEN("copy, fill and transform write every element") {
+            std::vector<long long> out(count);
+            REQUIRE(ops::copy(policy, input.begin(), input.end(), out.begin()) == out.end());
+            REQUIRE(out == input);
+            ops::fill(policy, out.begin(), out.end(), 7LL);
+            REQUIRE(std::all_of(out.begin(), out.end(), [](const long long v) { return v == 7; }));
+            ops::transform(policy, input.begin(), input.end(), out.begin(), [](const long long v) { return v * 2; });
+            REQUIRE(out[count - 1] == static_cast<long long>(count) * 2);
+            ops::for_each(policy, out.begin(), out.end(), [](long long &v) { v += 1; });
+            REQUIRE(out[0] == 3);
+        }
+
+        THEN("reduce and transform_reduce agree with accumulate") {
+            const long long expected = std::accumulate(input.begin(), input.end(), 0LL);
+            REQUIRE(ops::reduce(policy, input.begin(), input.end(), 0LL) == expected);
+            REQUIRE(ops::transform_reduce(policy, input.begin(), input.end(), 0LL, std::plus<>{},
+                                          [](const long long v) { return v * 2; }) == expected * 2);
+        }
+
+        THEN("inclusive_scan matches partial_sum, including in place") {
+            std::vector<long long> expected(count);
+            std::partial_sum(input.begin(), input.end(), expected.begin());
+            std::vector<long long> out(count);
+            ops::inclusive_scan(policy, input.begin(), input.end(), out.begin());
+            REQUIRE(out == expected);
+            ops::inclusive_scan(policy, input.begin(), input.end(), input.begin());
+            REQUIRE(input == expected);
+        }
+
+        THEN("sort orders a shuffled copy") {
+            std::vector<long long> shuffled = input;
+            std::shuffle(shuffled.begin(), shuffled.end(), std::mt19937{42});
+            ops::sort(policy, shuffled.begin(), shuffled.end());
+            REQUIRE(shuffled == input);
+            ops::sort(policy, shuffled.begin(), shuffled.end(), std::greater<>{});
+            REQUIRE(std::is_sorted(shuffled.begin(), shuffled.end(), std::greater<>{}));
+        }
+    }
+
+    GIVEN("a non random-access range") {
+        std::list<int> values{3, 1, 2};
+        THEN("algorithms fall back to the sequential path") {
+            REQUIRE(ops::reduce(execution::par, values.begin(), values.end()) == 6);
+            std::vector<int> out(3);
+            ops::copy(execution::par, values.begin(), values.end(), out.begin());
+            REQUIRE(out == std::vector<int>{3, 1, 2});
+        }
+    }
+}
@@ -0,0 +1,306 @@
+/*
+ * Copyright 2026 rainy-juzixiao
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <atomic>
+#include <catch2/catch_test_macros.hpp>
+#include <cstdint>
+#include <memory>
+#include <numeric>
+#include <rainy/collections/concurrency/mpmc_queue.hpp>
+#include <rainy/collections/concurrency/spsc_queue.hpp>
+#include <string>
+#include <thread>
+#include <vector>
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-do-while,cppcoreguidelines-pro-bounds-avoid-unchecked-container-access)
+
+using rainy::collections::concurrency::mpmc_queue;
+using rainy::collections::concurrency::spsc_queue;
+
+SCENARIO("spsc_queue bounded operations", "[spsc_queue]") {
+    GIVEN("a queue with a runtime capacity that is not a power of two") {
+        spsc_queue<std::string> queue(5);
+
+        THEN("the capacity is rounded up and the queue is empty") {
+            REQUIRE(queue.capacity() == 8);
+            REQUIRE(queue.empty());
+            std::string out;
+            REQUIRE_FALSE(queue.try_pop(out));
+        }
+
+        WHEN("filling the queue") {
+            for (int i = 0; i < 8; ++i) {
+                REQUIRE(queue.try_push(std::to_string(i)));
+            }
+
+            THEN("further pushes fail and pops return elements in order") {
+                REQUIRE_FALSE(queue.try_push("overflow"));
+                REQUIRE(queue.size_approx() == 8);
+                std::string out;
+                for (int i = 0; i < 8; ++i) {
+                    REQUIRE(queue.try_pop(out));
+                    REQUIRE(out == std::to_string(i));
+                }
+                REQUIRE(queue.empty());
+            }
+        }
+    }
+
+    GIVEN("a queue with a static capacity") {
+        spsc_queue<int, 16> queue;
+        std::vector<int> input(40);
+        std::iota(input.begin(), input.end(), 0);
+
+        THEN("batch operations are bounded by the free space") {
+            REQUIRE(queue.capacity() == 16);
+            REQUIRE(queue.push_n(input.begin(), input.size()) == 16);
+            std::vector<int> output(10);
+            REQUIRE(queue.pop_n(output.begin(), output.size()) == 10);
+            REQUIRE(output.front() == 0);
+            REQUIRE(output.back() == 9);
+            // 环绕写入
+            REQUIRE(queue.push_n(input.begin() + 16, 24) == 10);
+            output.assign(32, -1);
+            REQUIRE(queue.pop_n(output.begin(), output.size()) == 16);
+            for (int i = 0; i < 16; ++i) {
+                REQUIRE(output[i] == i + 10);
+            }
+            REQUIRE(queue.pop_n(output.begin(), output.size()) == 0);
+        }
+    }
+
+    GIVEN("elements left in the queue on destruction") {
+        auto tracker = std::make_shared<int>(0);
+
+        THEN("they are destroyed with the queue") {
+            {
+                spsc_queue<std::shared_ptr<int>> queue(4);
+                REQUIRE(queue.try_push(tracker));
+                REQUIRE(queue.try_emplace(tracker));
+                REQUIRE(tracker.use_count() == 3);
+            }
+            REQUIRE(tracker.use_count() == 1);
+        }
+    }
+}
+
+SCENARIO("spsc_queue blocking handoff", "[spsc_queue]") {
+    GIVEN("a producer and a consumer sharing a small queue") {
+        constexpr std::uint64_t count = 100000;
+        spsc_queue<std::uint64_t, 64> queue;
+
+        THEN("every element arrives exactly once and in order") {
+            std::thread producer([&] {
+                std::vector<std::uint64_t> batch(16);
+                for (std::uint64_t i = 0; i < count; i += batch.size()) {
+                    std::iota(batch.begin(), batch.end(), i);
+                    queue.push_n_wait(batch.begin(), batch.size());
+                }
+            });
+            std::uint64_t expected = 0;
+            std::vector<std::uint64_t> buffer(24);
+            bool ordered = true;
+            while (expected < count) {
+                const auto popped = queue.pop_n_wait(buffer.begin(), buffer.size());
+                for (std::size_t i = 0; i < popped; ++i) {
+                    ordered = ordered && buffer[i] == expected;
+                    ++expected;
+                }
+            }
+            producer.join();
+            REQUIRE(ordered);
+            REQUIRE(queue.empty());
+        }
+
+        THEN("single element blocking push and pop interleave") {
+            std::thread producer([&] {
+                for (std::uint64_t i = 0; i < count; ++i) {
+                    queue.push(i);
+                }
+            });
+            std::uint64_t sum = 0;
+            std::uint64_t value = 0;
+            for (std::uint64_t i = 0; i < count; ++i) {
+                queue.pop(value);
+                sum += value;
+            }
+            producer.join();
+            REQUIRE(sum == count * (count - 1) / 2);
+        }
+    }
+}
+
+SCENARIO("mpmc_queue bounded operations", "[mpmc_queue]") {
+    GIVEN("a queue with a runtime capacity") {
+        mpmc_queue<std::string> queue(3);
+
+        THEN("it behaves as a bounded fifo") {
+            REQUIRE(queue.capacity() == 4);
+            for (int i = 0; i < 4; ++i) {
+                REQUIRE(queue.try_emplace(static_cast<std::size_t>(i + 1), 'a'));
+            }
+            REQUIRE_FALSE(queue.try_push("overflow"));
+            std::string out;
+            for (int i = 0; i < 4; ++i) {
+                REQUIRE(queue.try_pop(out));
+                REQUIRE(out == std::string(static_cast<std::size_t>(i + 1), 'a'));
+            }
+            REQUIRE_FALSE(queue.try_pop(out));
+        }
+    }
+
+    GIVEN("a queue with a static capacity") {
+        mpmc_queue<int, 8> queue;
+        std::vector<int> input(20);
+        std::iota(input.begin(), input.end(), 0);
+
+        THEN("batches claim as many consecutive slots as are ready") {
+            REQUIRE(queue.push_n(input.begin(), 5) == 5);
+            REQUIRE(queue.push_n(input.begin() + 5, 15) == 3);
+            REQUIRE(queue.push_n(input.begin(), 1) == 0);
+            std::vector<int> output(6);
+            REQUIRE(queue.pop_n(output.begin(), output.size()) == 6);
+            REQUIRE(output.back() == 5);
+            REQUIRE(queue.push_n(input.begin() + 8, 12) == 6);
+            output.assign(16, -1);
+            REQUIRE(queue.pop_n(output.begin(), output.size()) == 8);
+            for (int i = 0; i < 8; ++i) {
+                REQUIRE(output[i] == i + 6);
+            }
+            REQUIRE(queue.empty());
+        }
+    }
+
+    GIVEN("elements left in the queue on destruction") {
+        auto tracker = std::make_shared<int>(0);
+
+        THEN("they are destroyed with the queue") {
+            {
+                mpmc_queue<std::shared_ptr<int>, 4> queue;
+                std::vector<std::shared_ptr<int>> values(3, tracker);
+                REQUIRE(queue.push_n(values.begin(), values.size()) == 3);
+                values.clear();
+                REQUIRE(tracker.use_count() == 4);
+            }
+            REQUIRE(tracker.use_count() == 1);
+        }
+    }
+}
+
+SCENARIO("mpmc_queue under contention", "[mpmc_queue]") {
+    GIVEN("several producers and consumers sharing a small queue") {
+        constexpr std::uint64_t producers = 4;
+        constexpr std::uint64_t consumers = 4;
+        constexpr std::uint64_t per_producer = 20000;
+        mpmc_queue<std::uint64_t> queue(32);
+        std::atomic<std::uint64_t> sum{0};
+        std::atomic<std::uint64_t> received{0};
+
+        THEN("every element is consumed exactly once") {
+            std::vector<std::thread> threads;
+            for (std::uint64_t p = 0; p < producers; ++p) {
+                threads.emplace_back([&, p] {
+                    std::vector<std::uint64_t> batch(8);
+                    for (std::uint64_t i = 0; i < per_producer; i += batch.size()) {
+                        for (std::size_t j = 0; j < batch.size(); ++j) {
+                            batch[j] = p * per_producer + i + j + 1;
+                        }
+                        if (i % 16 == 0) {
+                            queue.push_n_wait(batch.begin(), batch.size());
+                        } else {
+                            for (const auto value: batch) {
+                                queue.push(value);
+                            }
+                        }
+                    }
+                });
+            }
+            for (std::uint64_t c = 0; c < consumers; ++c) {
+                threads.emplace_back([&] {
+                    std::vector<std::uint64_t> buffer(6);
+                    constexpr std::uint64_t total = producers * per_producer;
+                    while (received.load() < total) {
+                        const auto popped = queue.pop_n(buffer.begin(), buffer.size());
+                        std::uint64_t local = 0;
+                        for (std::size_t i = 0; i < popped; ++i) {
+                            local += buffer[i];
+                        }
+                        sum.fetch_add(local);
+                        received.fetch_add(popped);
+                        if (popped == 0) {
+                            std::this_thread::yield();
+                        }
+                    }
+                });
+            }
+            for (auto &thread: threads) {
+                thread.join();
+            }
+            constexpr std::uint64_t total = producers * per_producer;
+            REQUIRE(received.load() == total);
+            REQUIRE(sum.load() == total * (total + 1) / 2);
+            REQUIRE(queue.empty());
+        }
+
+        THEN("blocking consumers are woken by producers") {
+            std::vector<std::thread> threads;
+            for (std::uint64_t c = 0; c < consumers; ++c) {
+                threads.emplace_back([&] {
+                    std::uint64_t value = 0;
+                    for (std::uint64_t i = 0; i < per_producer; ++i) {
+                        queue.pop(value);
+                        sum.fetch_add(value);
+                    }
+                });
+            }
+            for (std::uint64_t p = 0; p < producers; ++p) {
+                threads.emplace_back([&, p] {
+                    for (std::uint64_t i = 1; i <= per_producer; ++i) {
+                        queue.push(p * per_producer + i);
+                    }
+                });
+            }
+            for (auto &thread: threads) {
+                thread.join();
+            }
+            constexpr std::uint64_t total = producers * per_producer;
+            REQUIRE(sum.load() == total * (total + 1) / 2);
+            REQUIRE(queue.empty());
+        }
+    }
+
+    GIVEN("a queue small enough that producers keep running into it being full") {
+        constexpr std::uint64_t count = 50000;
+        mpmc_queue<std::uint64_t, 2> queue;
+
+        THEN("blocked producers are woken by consumers") {
+            std::thread producer([&] {
+                for (std::uint64_t i = 1; i <= count; ++i) {
+                    queue.push(i);
+                }
+            });
+            std::uint64_t sum = 0;
+            std::uint64_t value = 0;
+            for (std::uint64_t i = 0; i < count; ++i) {
+                queue.pop(value);
+                sum += value;
+            }
+            producer.join();
+            REQUIRE(sum == count * (count + 1) / 2);
+        }
+    }
+}
+
+// NOLINTEND(cppcoreguidelines-avoid-do-while,cppcoreguidelines-pro-bounds-avoid-unchecked-container-access)
@@ -0,0 +1,201 @@
+/*
+ * Copyright 2026 rainy-juzixiao
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <atomic>
+#include <catch2/catch_test_macros.hpp>
+#include <rainy/collections/concurrency/concurrent_hash_map.hpp>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace rainy::collections::concurrency;
+
+SCENARIO("concurrent_hash_map basic operations", "[concurrent_hash_map]") {
+    GIVEN("an empty map with string keys") {
+        concurrent_hash_map<std::string, int> map(4, 2);
+
+        THEN("it is empty") {
+            REQUIRE(map.empty());
+            REQUIRE(map.shard_count() == 4);
+            REQUIRE_FALSE(map.find("missing").has_value());
+        }
+
+        WHEN("inserting, overwriting and erasing") {
+            REQUIRE(map.insert_or_assign("alpha", 1));
+            REQUIRE(map.insert_or_assign(std::string("beta"), 2));
+            REQUIRE_FALSE(map.insert_or_assign("alpha", 10));
+
+            THEN("lookups observe the latest value") {
+                REQUIRE(map.size() == 2);
+                REQUIRE(*map.find("alpha") == 10);
+                REQUIRE(map.contains("beta"));
+                REQUIRE(map.erase("alpha") == 1);
+                REQUIRE(map.erase("alpha") == 0);
+                REQUIRE_FALSE(map.contains("alpha"));
+                REQUIRE(map.size() == 1);
+            }
+        }
+
+        WHEN("using compute_if_absent") {
+            int calls = 0;
+            const auto factory = [&calls] {
+                ++calls;
+                return 42;
+            };
+
+            THEN("the factory runs only for a missing key") {
+                REQUIRE(map.compute_if_absent("answer", factory) == 42);
+                REQUIRE(map.compute_if_absent("answer", factory) == 42);
+                REQUIRE(calls == 1);
+            }
+        }
+    }
+
+    GIVEN("a map that grows far beyond its initial buckets") {
+        concurrent_hash_map<int, int> map(2, 2);
+        for (int i = 0; i < 20000; ++i) {
+            map.insert_or_assign(i, i * 2);
+        }
+
+        THEN("incremental migration keeps every element reachable") {
+            REQUIRE(map.size() == 20000);
+            for (int i = 0; i < 20000; ++i) {
+                const auto found = map.find(i);
+                REQUIRE(found.has_value());
+                REQUIRE(*found == i * 2);
+            }
+            REQUIRE(map.bucket_count(0) > 2);
+        }
+
+        THEN("for_each visits each element exactly once, shard by shard") {
+            std::set<int> keys;
+            std::size_t visited = 0;
+            for (std::size_t shard = 0; shard < map.shard_count(); ++shard) {
+                map.for_each_in_shard(shard, [&](const auto &value) {
+                    REQUIRE(map.shard_index(value.first) == shard);
+                    keys.insert(value.first);
+                    ++visited;
+                });
+            }
+            REQUIRE(visited == 20000);
+            REQUIRE(keys.size() == 20000);
+        }
+
+        WHEN("clearing the map") {
+            map.clear();
+
+            THEN("it is empty and reusable") {
+                REQUIRE(map.empty());
+                REQUIRE_FALSE(map.contains(7));
+                map.insert_or_assign(7, 7);
+                REQUIRE(*map.find(7) == 7);
+            }
+        }
+    }
+}
+
+template <typename Map>
+static void run_readers_and_writers(Map &map) {
+    constexpr int key_space = 4096;
+    constexpr int writer_count = 4;
+    constexpr int reader_count = 4;
+    std::atomic<bool> stop{false};
+    std::atomic<std::size_t> inconsistent{0};
+    std::vector<std::thread> threads;
+    for (int w = 0; w < writer_count; ++w) {
+        threads.emplace_back([&map, w] {
+            for (int round = 0; round < 20; ++round) {
+                for (int key = w; key < key_space; key += writer_count) {
+                    // 值恒为键的倍数，读方据此检查是否读到了被回收或撕裂的节点
+                    map.insert_or_assign(key, key * (round + 1));
+                    if (round % 3 == 2 && key % 5 == 0) {
+                        map.erase(key);
+                    }
+                }
+            }
+        });
+    }
+    for (int r = 0; r < reader_count; ++r) {
+        threads.emplace_back([&map, &stop, &inconsistent, r] {
+            int key = r;
+            while (!stop.load(std::memory_order_relaxed)) {
+                map.visit(key, [&](const auto &value) {
+                    if (value.first != key || (key != 0 && value.second % key != 0)) {
+                        inconsistent.fetch_add(1, std::memory_order_relaxed);
+                    }
+                });
+                key = (key + 7) % key_space;
+            }
+        });
+    }
+    for (int w = 0; w < writer_count; ++w) {
+        threads[static_cast<std::size_t>(w)].join();
+    }
+    stop.store(true);
+    for (std::size_t index = writer_count; index < threads.size(); ++index) {
+        threads[index].join();
+    }
+    REQUIRE(inconsistent.load() == 0);
+    for (int key = 0; key < key_space; ++key) {
+        const auto found = map.find(key);
+        REQUIRE(found.has_value());
+        REQUIRE(*found == key * 20);
+    }
+}
+
+SCENARIO("concurrent_hash_map under concurrent readers and writers", "[concurrent_hash_map][concurrency]") {
+    GIVEN("a map with hazard pointer reclamation and few initial buckets") {
+        concurrent_hash_map<int, int> map(8, 2);
+
+        THEN("readers never observe reclaimed or torn nodes") {
+            run_readers_and_writers(map);
+        }
+    }
+
+    GIVEN("a map with epoch based reclamation") {
+        concurrent_hash_map<int, int, rainy::utility::hash<int>, rainy::foundation::functional::equal<int>,
+                            rainy::foundation::memory::epoch_reclamation>
+            map(8, 2);
+
+        THEN("readers never observe reclaimed or torn nodes") {
+            run_readers_and_writers(map);
+        }
+    }
+
+    GIVEN("many threads racing on compute_if_absent") {
+        concurrent_hash_map<int, int> map;
+        std::atomic<int> calls{0};
+        std::vector<std::thread> threads;
+        for (int t = 0; t < 8; ++t) {
+            threads.emplace_back([&] {
+                for (int key = 0; key < 1000; ++key) {
+                    REQUIRE(map.compute_if_absent(key, [&] {
+                        calls.fetch_add(1);
+                        return key + 1;
+                    }) == key + 1);
+                }
+            });
+        }
+        for (auto &thread: threads) {
+            thread.join();
+        }
+
+        THEN("each value was computed exactly once") {
+            REQUIRE(calls.load() == 1000);
+            REQUIRE(map.size() == 1000);
+        }
+    }
+}
@@ -357,3 +357,51 @@ SCENARIO("edge cases for forward_list", "[forward_list]") {
         }
     }
 }
+
+SCENARIO("forward_list with epoch-based reclamation", "[forward_list][concurrency]") {
+
+    GIVEN("A forward_list using epoch_reclamation shared among threads") {
+        forward_list<int, rainy::foundation::memory::allocator<int>, rainy::foundation::memory::epoch_reclamation> list;
+        constexpr int num_writers = 4;
+        constexpr int num_readers = 4;
+        constexpr int num_ops_per_thread = 2000;
+
+        WHEN("writers push and pop while readers traverse inside an epoch guard") {
+            std::atomic<bool> stop{false};
+            std::vector<std::thread> readers;
+            for (int t = 0; t < num_readers; ++t) {
+                readers.emplace_back([&list, &stop]() {
+                    long sum = 0;
+                    while (!stop.load(std::memory_order_acquire)) {
+                        rainy::foundation::memory::epoch_guard guard;
+                        for (const int v: list) {
+                            sum += v;
+                        }
+                    }
+                    (void) sum;
+                });
+            }
+            std::vector<std::thread> writers;
+            for (int t = 0; t < num_writers; ++t) {
+                writers.emplace_back([&list, t, num_ops_per_thread]() {
+                    for (int i = 0; i < num_ops_per_thread; ++i) {
+                        list.push_front(t * num_ops_per_thread + i);
+                        list.pop_front();
+                    }
+                });
+            }
+            for (auto &th: writers) {
+                th.join();
+            }
+            stop.store(true, std::memory_order_release);
+            for (auto &th: readers) {
+                th.join();
+            }
+
+            THEN("every pushed element has been popped") {
+                REQUIRE(list.empty());
+                REQUIRE(list.size() == 0);
+            }
+        }
+    }
+}
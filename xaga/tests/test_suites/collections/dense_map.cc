@@ -0,0 +1,205 @@
+/*
+ * Copyright 2026 rainy-juzixiao
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <catch2/catch_test_macros.hpp>
+#include <rainy/collections/dense_map.hpp>
+#include <rainy/collections/dense_set.hpp>
+#include <initializer_list>
+#include <string>
+#include <vector>
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-do-while,cppcoreguidelines-pro-bounds-avoid-unchecked-container-access)
+
+using rainy::collections::dense_map;
+using rainy::collections::dense_set;
+
+namespace {
+    struct counting_equal {
+        static inline int calls = 0;
+
+        bool operator()(const std::string &left, const std::string &right) const {
+            ++calls;
+            return left == right;
+        }
+    };
+
+    /*
+     * 只有低 4 位不同的哈希值：若直接取低位作为桶下标会全部落入少数几个桶
+     */
+    struct high_bits_hash {
+        std::size_t operator()(const int value) const noexcept {
+            return static_cast<std::size_t>(value) << 20u;
+        }
+    };
+}
+
+SCENARIO("dense_map power-of-two buckets and fingerprints", "[dense_map]") {
+    GIVEN("a dense_map with integer keys") {
+        dense_map<int, int> map;
+        for (int i = 0; i < 5000; ++i) {
+            map.emplace(i, i * 3);
+        }
+
+        THEN("bucket count stays a power of two and all keys are found") {
+            const auto buckets = map.bucket_count();
+            REQUIRE((buckets & (buckets - 1)) == 0);
+            REQUIRE(map.load_factor() <= map.max_load_factor());
+            for (int i = 0; i < 5000; ++i) {
+                REQUIRE(map.at(i) == i * 3);
+                REQUIRE(map.bucket(i) < buckets);
+            }
+        }
+
+        WHEN("erasing half of the keys") {
+            for (int i = 0; i < 5000; i += 2) {
+                REQUIRE(map.erase(i) == 1);
+            }
+
+            THEN("the moved tail elements are still reachable through their buckets") {
+                REQUIRE(map.size() == 2500);
+                for (int i = 0; i < 5000; ++i) {
+                    REQUIRE(map.contains(i) == (i % 2 == 1));
+                }
+            }
+        }
+    }
+
+    GIVEN("a hash whose low bits carry no information") {
+        dense_map<int, int, high_bits_hash> map;
+        for (int i = 0; i < 1024; ++i) {
+            map.emplace(i, i);
+        }
+
+        THEN("multiplicative mixing still spreads keys over many buckets") {
+            std::size_t used = 0;
+            std::size_t longest = 0;
+            for (std::size_t index = 0; index < map.bucket_count(); ++index) {
+                const auto length = map.bucket_size(index);
+                used += length != 0;
+                longest = length > longest ? length : longest;
+            }
+            REQUIRE(used > map.bucket_count() / 4);
+            REQUIRE(longest < 16);
+        }
+    }
+
+    GIVEN("string keys and a key_equal that counts its calls") {
+        dense_map<std::string, int, rainy::utility::hash<std::string>, counting_equal> map;
+        for (int i = 0; i < 2000; ++i) {
+            map.emplace("key-" + std::to_string(i), i);
+        }
+
+        THEN("a lookup compares at most a handful of keys") {
+            counting_equal::calls = 0;
+            for (int i = 0; i < 2000; ++i) {
+                REQUIRE(map.find("key-" + std::to_string(i))->second == i);
+            }
+            // 指纹相同才会比较键，命中时几乎只调用一次
+            REQUIRE(counting_equal::calls < 2100);
+            counting_equal::calls = 0;
+            REQUIRE(map.find("missing") == map.end());
+            REQUIRE(counting_equal::calls == 0);
+        }
+    }
+}
+
+SCENARIO("dense_map reserve rehashes once", "[dense_map]") {
+    GIVEN("a dense_map reserved for a known number of elements") {
+        dense_map<int, std::string> map;
+        map.reserve(10000);
+        const auto buckets = map.bucket_count();
+
+        WHEN("inserting up to the reserved size") {
+            for (int i = 0; i < 10000; ++i) {
+                map.try_emplace(i, std::to_string(i));
+            }
+
+            THEN("no further rehash happened") {
+                REQUIRE(map.bucket_count() == buckets);
+                REQUIRE(map.size() == 10000);
+                REQUIRE(map.at(9999) == "9999");
+            }
+        }
+
+        WHEN("reserving a smaller size afterwards") {
+            map.reserve(10);
+
+            THEN("the bucket array is not shrunk") {
+                REQUIRE(map.bucket_count() == buckets);
+            }
+        }
+    }
+
+    GIVEN("a range inserted at once") {
+        std::vector<rainy::utility::pair<const int, int>> values;
+        for (int i = 0; i < 3000; ++i) {
+            values.emplace_back(i, -i);
+        }
+        dense_map<int, int> map;
+        map.insert(values.begin(), values.end());
+
+        THEN("every element is present") {
+            REQUIRE(map.size() == 3000);
+            REQUIRE(map.at(2999) == -2999);
+        }
+    }
+
+    GIVEN("a default constructed dense_set of integers") {
+        dense_set<int> set;
+
+        THEN("it starts out empty") {
+            REQUIRE(set.empty());
+            REQUIRE_FALSE(set.contains(static_cast<int>(dense_set<int>::minimum_capacity)));
+        }
+    }
+
+    GIVEN("an empty initializer list") {
+        const std::initializer_list<rainy::utility::pair<const int, int>> no_pairs{};
+        const std::initializer_list<int> no_values{};
+        dense_map<int, int> map(no_pairs);
+        dense_set<int> set(no_values);
+
+        THEN("the containers are usable") {
+            map.insert_or_assign(1, 1);
+            set.insert(1);
+            REQUIRE(map.size() == 1);
+            REQUIRE(set.size() == 1);
+            REQUIRE(set.contains(1));
+        }
+    }
+}
+
+SCENARIO("dense_set fingerprints", "[dense_set]") {
+    GIVEN("a dense_set of strings") {
+        dense_set<std::string> set;
+        for (int i = 0; i < 4000; ++i) {
+            set.insert("value-" + std::to_string(i));
+        }
+
+        THEN("membership, erase and rehash agree") {
+            REQUIRE(set.size() == 4000);
+            REQUIRE_FALSE(set.insert("value-7").second);
+            for (int i = 0; i < 4000; i += 3) {
+                REQUIRE(set.erase("value-" + std::to_string(i)) == 1);
+            }
+            set.rehash(set.bucket_count() * 4);
+            for (int i = 0; i < 4000; ++i) {
+                REQUIRE(set.contains("value-" + std::to_string(i)) == (i % 3 != 0));
+            }
+        }
+    }
+}
+
+// NOLINTEND(cppcoreguidelines-avoid-do-while,cppcoreguidelines-pro-bounds-avoid-unchecked-container-access)
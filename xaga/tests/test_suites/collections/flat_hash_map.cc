@@ -0,0 +1,484 @@
+/*
+ * Copyright 2026 rainy-juzixiao
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <catch2/catch_test_macros.hpp>
+#include <functional>
+#include <memory>
+#include <rainy/collections/flat_hash_map.hpp>
+#include <rainy/collections/flat_hash_set.hpp>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-do-while,cppcoreguidelines-pro-bounds-avoid-unchecked-container-access)
+
+using rainy::collections::flat_hash_map;
+using rainy::collections::flat_hash_set;
+using rainy::collections::node_hash_map;
+using rainy::collections::node_hash_set;
+
+namespace {
+    struct transparent_string_hash {
+        using is_transparent = void;
+
+        std::size_t operator()(const std::string_view value) const noexcept {
+            return std::hash<std::string_view>{}(value);
+        }
+    };
+
+    /*
+     * 所有键落入同一个 H1/H2，强制走完整的探测序列与删除墓碑逻辑
+     */
+    struct colliding_hash {
+        std::size_t operator()(int) const noexcept {
+            return 0;
+        }
+    };
+
+    struct live_counted {
+        static inline int live = 0;
+
+        explicit live_counted(const int v) : value(v) {
+            ++live;
+        }
+
+        live_counted(const live_counted &other) : value(other.value) {
+            ++live;
+        }
+
+        live_counted(live_counted &&other) noexcept : value(other.value) {
+            ++live;
+        }
+
+        live_counted &operator=(const live_counted &) = default;
+
+        ~live_counted() {
+            --live;
+        }
+
+        int value;
+    };
+
+    /*
+     * 有状态且移动赋值时不传播的分配器，不同实例互不相等；outstanding 记录经本实例分配尚未归还的元素数
+     */
+    template <typename Ty>
+    struct tracking_allocator {
+        using value_type = Ty;
+        using propagate_on_container_move_assignment = std::false_type;
+        using is_always_equal = std::false_type;
+
+        explicit tracking_allocator(std::shared_ptr<long> counter) noexcept : outstanding(std::move(counter)) {
+        }
+
+        template <typename Other>
+        tracking_allocator(const tracking_allocator<Other> &other) noexcept : outstanding(other.outstanding) { // NOLINT
+        }
+
+        Ty *allocate(const std::size_t n) {
+            *outstanding += static_cast<long>(n);
+            return std::allocator<Ty>{}.allocate(n);
+        }
+
+        void deallocate(Ty *p, const std::size_t n) noexcept {
+            *outstanding -= static_cast<long>(n);
+            std::allocator<Ty>{}.deallocate(p, n);
+        }
+
+        template <typename Other>
+        bool operator==(const tracking_allocator<Other> &other) const noexcept {
+            return outstanding == other.outstanding;
+        }
+
+        template <typename Other>
+        bool operator!=(const tracking_allocator<Other> &other) const noexcept {
+            return !(*this == other);
+        }
+
+        std::shared_ptr<long> outstanding;
+    };
+}
+
+SCENARIO("flat_hash_map basic operations", "[flat_hash_map]") {
+    GIVEN("an empty flat_hash_map") {
+        flat_hash_map<int, std::string> map;
+
+        THEN("it does not allocate and lookups miss") {
+            REQUIRE(map.empty());
+            REQUIRE(map.capacity() == 0);
+            REQUIRE(map.find(1) == map.end());
+            REQUIRE(map.begin() == map.end());
+            REQUIRE_FALSE(map.contains(42));
+            REQUIRE(map.erase(42) == 0);
+        }
+
+        WHEN("inserting elements") {
+            REQUIRE(map.insert({1, "one"}).second);
+            REQUIRE(map.emplace(2, "two").second);
+            REQUIRE(map.try_emplace(3, "three").second);
+            map[4] = "four";
+
+            THEN("all elements are accessible") {
+                REQUIRE(map.size() == 4);
+                REQUIRE(map.at(1) == "one");
+                REQUIRE(map[2] == "two");
+                REQUIRE(map.find(3)->second == "three");
+                REQUIRE(map.count(4) == 1);
+            }
+
+            THEN("duplicate insertion keeps the original value") {
+                auto result = map.insert({1, "uno"});
+                REQUIRE_FALSE(result.second);
+                REQUIRE(result.first->second == "one");
+                REQUIRE_FALSE(map.try_emplace(2, "dos").second);
+                REQUIRE(map[2] == "two");
+                REQUIRE(map.size() == 4);
+            }
+
+            THEN("insert_or_assign overwrites") {
+                REQUIRE_FALSE(map.insert_or_assign(1, "uno").second);
+                REQUIRE(map.insert_or_assign(5, "five").second);
+                REQUIRE(map[1] == "uno");
+                REQUIRE(map.size() == 5);
+            }
+
+            THEN("at throws for missing keys") {
+                REQUIRE_THROWS_AS(map.at(100), rainy::foundation::exceptions::logic::out_of_range);
+            }
+        }
+    }
+}
+
+SCENARIO("flat_hash_map growth and erase", "[flat_hash_map]") {
+    GIVEN("a flat_hash_map filled with many elements") {
+        flat_hash_map<int, int> map;
+        constexpr int count = 10000;
+        for (int i = 0; i < count; ++i) {
+            map.emplace(i, i * 2);
+        }
+
+        THEN("every element is found and iteration visits each once") {
+            REQUIRE(map.size() == count);
+            REQUIRE(map.load_factor() <= map.max_load_factor());
+            for (int i = 0; i < count; ++i) {
+                REQUIRE(map.find(i)->second == i * 2);
+            }
+            long long sum = 0;
+            std::size_t visited = 0;
+            for (const auto &[key, value]: map) {
+                sum += key;
+                ++visited;
+                REQUIRE(value == key * 2);
+            }
+            REQUIRE(visited == count);
+            REQUIRE(sum == static_cast<long long>(count) * (count - 1) / 2);
+        }
+
+        WHEN("erasing every odd key") {
+            for (int i = 1; i < count; i += 2) {
+                REQUIRE(map.erase(i) == 1);
+            }
+
+            THEN("only even keys remain") {
+                REQUIRE(map.size() == count / 2);
+                for (int i = 0; i < count; ++i) {
+                    REQUIRE(map.contains(i) == (i % 2 == 0));
+                }
+            }
+        }
+
+        WHEN("erasing while iterating") {
+            for (auto it = map.begin(); it != map.end();) {
+                if (it->first % 3 == 0) {
+                    it = map.erase(it);
+                } else {
+                    ++it;
+                }
+            }
+
+            THEN("the predicate holds for all remaining elements") {
+                REQUIRE(map.size() == count - (count + 2) / 3);
+                for (const auto &item: map) {
+                    REQUIRE(item.first % 3 != 0);
+                }
+            }
+        }
+
+        WHEN("clearing and reusing") {
+            const auto capacity = map.capacity();
+            map.clear();
+
+            THEN("capacity is kept and the table is usable again") {
+                REQUIRE(map.empty());
+                REQUIRE(map.capacity() == capacity);
+                REQUIRE(map.begin() == map.end());
+                map[7] = 7;
+                REQUIRE(map.size() == 1);
+                REQUIRE(map[7] == 7);
+            }
+        }
+    }
+
+    GIVEN("a hash that sends every key to the same group") {
+        flat_hash_map<int, int, colliding_hash> map;
+        for (int i = 0; i < 200; ++i) {
+            map.emplace(i, i);
+        }
+
+        THEN("probing still finds everything through erase and reinsert cycles") {
+            for (int round = 0; round < 5; ++round) {
+                for (int i = 0; i < 200; i += 2) {
+                    REQUIRE(map.erase(i) == 1);
+                }
+                for (int i = 0; i < 200; i += 2) {
+                    REQUIRE(map.emplace(i, i + round).second);
+                }
+            }
+            REQUIRE(map.size() == 200);
+            for (int i = 0; i < 200; ++i) {
+                REQUIRE(map.contains(i));
+            }
+        }
+    }
+
+    GIVEN("a table kept at constant size under churn") {
+        flat_hash_map<int, int> map;
+        map.reserve(64);
+        const auto capacity = map.capacity();
+
+        THEN("tombstones are recycled without unbounded growth") {
+            for (int i = 0; i < 100000; ++i) {
+                map.emplace(i, i);
+                if (i >= 32) {
+                    REQUIRE(map.erase(i - 32) == 1);
+                }
+            }
+            REQUIRE(map.size() == 32);
+            REQUIRE(map.capacity() <= capacity * 2 + 1);
+        }
+    }
+}
+
+SCENARIO("flat_hash_map copy, move and comparison", "[flat_hash_map]") {
+    GIVEN("a populated flat_hash_map with string keys") {
+        flat_hash_map<std::string, int> map;
+        for (int i = 0; i < 100; ++i) {
+            map.emplace("key" + std::to_string(i), i);
+        }
+
+        WHEN("copied") {
+            auto copy = map;
+
+            THEN("the copy is equal and independent") {
+                REQUIRE(copy == map);
+                copy["key0"] = -1;
+                REQUIRE(copy != map);
+                REQUIRE(map["key0"] == 0);
+            }
+        }
+
+        WHEN("moved") {
+            auto moved = std::move(map);
+
+            THEN("the target owns the elements and the source is empty but usable") {
+                REQUIRE(moved.size() == 100);
+                REQUIRE(moved.at("key42") == 42);
+                REQUIRE(map.empty()); // NOLINT(bugprone-use-after-move)
+                map["again"] = 1;
+                REQUIRE(map.size() == 1);
+            }
+        }
+
+        WHEN("swapped") {
+            flat_hash_map<std::string, int> other{{"x", 1}};
+            swap(map, other);
+
+            THEN("contents are exchanged") {
+                REQUIRE(map.size() == 1);
+                REQUIRE(other.size() == 100);
+            }
+        }
+    }
+}
+
+SCENARIO("flat_hash_map move assignment with a non-propagating allocator", "[flat_hash_map]") {
+    GIVEN("two maps whose allocators compare unequal") {
+        using value_type = rainy::utility::pair<const int, std::string>;
+        using map_type = flat_hash_map<int, std::string, rainy::utility::hash<int>, rainy::foundation::functional::equal<int>,
+                                       tracking_allocator<value_type>>;
+        auto left_arena = std::make_shared<long>(0);
+        auto right_arena = std::make_shared<long>(0);
+
+        WHEN("one is move-assigned from the other") {
+            {
+                map_type target{tracking_allocator<value_type>{left_arena}};
+                target[-1] = "old";
+                map_type source{tracking_allocator<value_type>{right_arena}};
+                for (int i = 0; i < 50; ++i) {
+                    source.emplace(i, std::to_string(i));
+                }
+                target = std::move(source);
+
+                THEN("the elements are moved into storage from the target's allocator") {
+                    REQUIRE(target.size() == 50);
+                    REQUIRE(target.at(7) == "7");
+                    REQUIRE_FALSE(target.contains(-1));
+                    REQUIRE(target.get_allocator() == tracking_allocator<value_type>{left_arena});
+                    REQUIRE(*left_arena > 0);
+                }
+            }
+
+            THEN("each allocator gets back exactly what it handed out") {
+                REQUIRE(*left_arena == 0);
+                REQUIRE(*right_arena == 0);
+            }
+        }
+    }
+}
+
+SCENARIO("flat_hash_map heterogeneous lookup", "[flat_hash_map]") {
+    GIVEN("a map with transparent hash and key_equal") {
+        flat_hash_map<std::string, int, transparent_string_hash, std::equal_to<>> map;
+        map.emplace("alpha", 1);
+        map.emplace("beta", 2);
+
+        THEN("string_view and C strings are accepted without building a std::string") {
+            constexpr std::string_view key = "alpha";
+            REQUIRE(map.find(key)->second == 1);
+            REQUIRE(map.contains("beta"));
+            REQUIRE(map.count(std::string_view{"gamma"}) == 0);
+            REQUIRE(map.at(std::string_view{"beta"}) == 2);
+            REQUIRE(map.erase(std::string_view{"beta"}) == 1);
+            REQUIRE(map.size() == 1);
+        }
+    }
+}
+
+SCENARIO("flat_hash_map element lifetime", "[flat_hash_map]") {
+    GIVEN("values that count their live instances") {
+        const int before = live_counted::live;
+        {
+            flat_hash_map<int, live_counted> map;
+            for (int i = 0; i < 1000; ++i) {
+                map.try_emplace(i, i);
+            }
+            for (int i = 0; i < 500; ++i) {
+                map.erase(i);
+            }
+            REQUIRE(live_counted::live == before + 500);
+            auto copy = map;
+            REQUIRE(live_counted::live == before + 1000);
+        }
+        THEN("every constructed value is destroyed") {
+            REQUIRE(live_counted::live == before);
+        }
+    }
+}
+
+SCENARIO("node_hash_map keeps element addresses stable", "[flat_hash_map]") {
+    GIVEN("a node_hash_map and pointers to its elements") {
+        node_hash_map<int, std::string> map;
+        map.emplace(0, "zero");
+        const std::string *address = &map[0];
+
+        WHEN("the table grows many times") {
+            for (int i = 1; i < 5000; ++i) {
+                map.emplace(i, std::to_string(i));
+            }
+
+            THEN("the original element has not moved") {
+                REQUIRE(&map[0] == address);
+                REQUIRE(*address == "zero");
+                REQUIRE(map.size() == 5000);
+                REQUIRE(map.at(4999) == "4999");
+            }
+        }
+    }
+}
+
+SCENARIO("flat_hash_set and node_hash_set", "[flat_hash_set]") {
+    GIVEN("a flat_hash_set of strings") {
+        flat_hash_set<std::string> set{"a", "b", "c"};
+
+        THEN("it behaves as a set") {
+            REQUIRE(set.size() == 3);
+            REQUIRE_FALSE(set.insert("a").second);
+            REQUIRE(set.emplace("d").second);
+            REQUIRE(set.contains("d"));
+            REQUIRE(set.erase("a") == 1);
+            REQUIRE_FALSE(set.contains("a"));
+            std::vector<std::string> values(set.begin(), set.end());
+            REQUIRE(values.size() == 3);
+        }
+    }
+
+    GIVEN("a node_hash_set of ints") {
+        node_hash_set<int> set;
+        set.insert(-1);
+        const int *address = &*set.find(-1);
+        for (int i = 0; i < 3000; ++i) {
+            set.insert(i);
+        }
+
+        THEN("elements stay in place across rehashes") {
+            REQUIRE(&*set.find(-1) == address);
+            REQUIRE(set.size() == 3001);
+            auto copy = set;
+            REQUIRE(copy == set);
+        }
+    }
+}
+
+SCENARIO("flat_hash_map agrees with std::unordered_map under random operations", "[flat_hash_map]") {
+    GIVEN("a reference std::unordered_map") {
+        flat_hash_map<unsigned, unsigned> map;
+        std::unordered_map<unsigned, unsigned> reference;
+        unsigned state = 12345;
+        const auto next = [&state] {
+            state = state * 1103515245u + 12345u;
+            return (state >> 8) % 4096;
+        };
+        for (int i = 0; i < 50000; ++i) {
+            const unsigned key = next();
+            switch (next() % 3) {
+                case 0:
+                    map.insert_or_assign(key, i);
+                    reference[key] = i;
+                    break;
+                case 1:
+                    REQUIRE(map.erase(key) == reference.erase(key));
+                    break;
+                default: {
+                    const auto it = map.find(key);
+                    const auto ref = reference.find(key);
+                    REQUIRE((it == map.end()) == (ref == reference.end()));
+                    if (ref != reference.end()) {
+                        REQUIRE(it->second == ref->second);
+                    }
+                }
+            }
+        }
+        THEN("both containers hold the same contents") {
+            REQUIRE(map.size() == reference.size());
+            for (const auto &[key, value]: reference) {
+                REQUIRE(map.at(key) == value);
+            }
+        }
+    }
+}
+
+// NOLINTEND(cppcoreguidelines-avoid-do-while,cppcoreguidelines-pro-bounds-avoid-unchecked-container-access)
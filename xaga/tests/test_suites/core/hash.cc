@@ -0,0 +1,143 @@
+/*
+ * Copyright 2026 rainy-juzixiao
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <rainy/core/core.hpp>
+#include <rainy/text/hashed_string.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <string_view>
+#include <unordered_set>
+#include <vector>
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-do-while,cppcoreguidelines-pro-bounds-avoid-unchecked-container-access)
+
+using rainy::utility::implements::rapidhash_bytes;
+using rainy::utility::implements::rapidhash_chars;
+
+namespace {
+    constexpr std::size_t hashed_literal = rainy::foundation::text::hashed_string{"rainy-toolkit/api/v1/users/42"}.hash_code();
+    static_assert(hashed_literal != 0, "rapidhash must be usable in constant expressions");
+
+    std::string make_key(std::mt19937_64 &engine, const std::size_t length) {
+        std::string key(length, '\0');
+        for (auto &ch: key) {
+            ch = static_cast<char>(engine());
+        }
+        return key;
+    }
+}
+
+SCENARIO("rapidhash constexpr and runtime paths agree", "[hash]") {
+    GIVEN("strings covering every length branch") {
+        std::mt19937_64 engine(7);
+
+        THEN("byte and char readers produce the same value") {
+            for (std::size_t length = 0; length <= 300; ++length) {
+                const std::string key = make_key(engine, length);
+                REQUIRE(rapidhash_bytes(key.data(), key.size()) == rapidhash_chars(key.data(), key.size()));
+            }
+        }
+    }
+
+    GIVEN("a hashed_string built at compile time") {
+        const std::string runtime_key = "rainy-toolkit/api/v1/users/42";
+
+        THEN("it equals utility::hash of the same text") {
+            REQUIRE(hashed_literal == rainy::utility::hash<std::string>{}(runtime_key));
+            REQUIRE(hashed_literal == rainy::utility::hash<std::string_view>{}(std::string_view{runtime_key}));
+        }
+    }
+
+    GIVEN("wide strings") {
+        const std::wstring key = L"rainy-toolkit/identifier/0123456789";
+
+        THEN("multi-byte characters are read in little-endian byte order") {
+            REQUIRE(rapidhash_chars(key.data(), key.size()) == rapidhash_bytes(key.data(), key.size() * sizeof(wchar_t)));
+        }
+    }
+}
+
+SCENARIO("rapidhash avalanche on url sized keys", "[hash]") {
+    GIVEN("random keys between 20 and 200 bytes") {
+        std::mt19937_64 engine(42);
+        constexpr std::size_t trials = 64;
+        std::vector<std::uint64_t> flips(64, 0);
+        std::size_t samples = 0;
+        for (std::size_t length: {20u, 37u, 64u, 100u, 150u, 200u}) {
+            for (std::size_t trial = 0; trial < trials; ++trial) {
+                std::string key = make_key(engine, length);
+                const std::uint64_t base = rapidhash_bytes(key.data(), key.size());
+                // 每次只翻转一个输入位，统计各输出位被翻转的次数
+                for (std::size_t bit = 0; bit < length * 8; bit += 3) {
+                    key[bit / 8] = static_cast<char>(key[bit / 8] ^ (1u << (bit % 8)));
+                    const std::uint64_t diff = base ^ rapidhash_bytes(key.data(), key.size());
+                    key[bit / 8] = static_cast<char>(key[bit / 8] ^ (1u << (bit % 8)));
+                    for (std::size_t out = 0; out < 64; ++out) {
+                        flips[out] += (diff >> out) & 1u;
+                    }
+                    ++samples;
+                }
+            }
+        }
+
+        THEN("each output bit flips with probability close to one half") {
+            for (std::size_t out = 0; out < 64; ++out) {
+                const double ratio = static_cast<double>(flips[out]) / static_cast<double>(samples);
+                REQUIRE(ratio > 0.48);
+                REQUIRE(ratio < 0.52);
+            }
+        }
+    }
+}
+
+SCENARIO("rapidhash distinguishes similar keys", "[hash]") {
+    GIVEN("sequential identifiers sharing a long prefix") {
+        std::unordered_set<std::uint64_t> seen;
+        for (int i = 0; i < 100000; ++i) {
+            const std::string key = "https://example.com/resources/items/" + std::to_string(i);
+            seen.insert(rapidhash_bytes(key.data(), key.size()));
+        }
+
+        THEN("no two identifiers collide") {
+            REQUIRE(seen.size() == 100000);
+        }
+    }
+
+    GIVEN("keys that differ only in length or trailing zero bytes") {
+        const char zeros[32]{};
+        std::unordered_set<std::uint64_t> seen;
+        for (std::size_t length = 0; length <= 32; ++length) {
+            seen.insert(rapidhash_bytes(zeros, length));
+        }
+
+        THEN("every length hashes differently") {
+            REQUIRE(seen.size() == 33);
+        }
+    }
+
+    GIVEN("the same key under different seeds") {
+        const std::string key = "user-0123456789abcdef";
+
+        THEN("the seed changes the result") {
+            REQUIRE(rapidhash_bytes(key.data(), key.size(), 1) != rapidhash_bytes(key.data(), key.size(), 2));
+            REQUIRE(rapidhash_chars(key.data(), key.size(), 1) == rapidhash_bytes(key.data(), key.size(), 1));
+        }
+    }
+}
+
+// NOLINTEND(cppcoreguidelines-avoid-do-while,cppcoreguidelines-pro-bounds-avoid-unchecked-container-access)
@@ -3,6 +3,7 @@
 #include <rainy/foundation/concurrency/mutex.hpp>
 #include <rainy/foundation/concurrency/condition_variable.hpp>
 #include <thread>
+#include <vector>
 
 using namespace rainy::foundation::concurrency;
 using namespace std::chrono_literals;
@@ -76,4 +77,80 @@ SCENARIO("Wait and notify_all functionality", "[condition_variable]") {
             }
         }
     }
-}
\ No newline at end of file
+}
+SCENARIO("Producers and consumers hand off items through condition_variable", "[condition_variable][thread]") {
+    GIVEN("a queue counter guarded by a mutex and several producers and consumers") {
+        condition_variable cv;
+        mutex mtx;
+        int queued = 0;
+        int consumed = 0;
+        bool done = false;
+        constexpr int producers = 4;
+        constexpr int items_per_producer = 5000;
+
+        WHEN("every producer signals once per item") {
+            std::vector<std::thread> consumers;
+            for (int i = 0; i < 4; ++i) {
+                consumers.emplace_back([&] {
+                    unique_lock<mutex> lock(mtx);
+                    while (true) {
+                        cv.wait(lock, [&] { return queued != 0 || done; });
+                        if (queued == 0) {
+                            break;
+                        }
+                        --queued;
+                        ++consumed;
+                    }
+                });
+            }
+            std::vector<std::thread> workers;
+            for (int i = 0; i < producers; ++i) {
+                workers.emplace_back([&] {
+                    for (int n = 0; n < items_per_producer; ++n) {
+                        {
+                            unique_lock<mutex> lock(mtx);
+                            ++queued;
+                        }
+                        cv.notify_one();
+                    }
+                });
+            }
+            for (auto &t: workers) {
+                t.join();
+            }
+            {
+                unique_lock<mutex> lock(mtx);
+                done = true;
+            }
+            cv.notify_all();
+            for (auto &t: consumers) {
+                t.join();
+            }
+
+            THEN("no item and no wakeup is lost") {
+                REQUIRE(consumed == producers * items_per_producer);
+                REQUIRE(queued == 0);
+            }
+        }
+    }
+}
+
+SCENARIO("wait_for times out and reacquires the mutex", "[condition_variable][timeout]") {
+    GIVEN("a condition variable that is never notified") {
+        condition_variable cv;
+        mutex mtx;
+
+        WHEN("waiting for 20ms") {
+            unique_lock<mutex> lock(mtx);
+            const auto start = std::chrono::steady_clock::now();
+            const cv_status status = cv.wait_for(lock, 20ms);
+            const auto elapsed = std::chrono::steady_clock::now() - start;
+
+            THEN("it reports timeout and still owns the lock") {
+                REQUIRE(status == cv_status::timeout);
+                REQUIRE(elapsed >= 15ms);
+                REQUIRE(lock.owns_lock());
+            }
+        }
+    }
+}
@@ -0,0 +1,101 @@
+#include <catch2/catch_test_macros.hpp>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include <rainy/async/schedule_on.hpp>
+#include <rainy/async/when_all.hpp>
+#include <rainy/foundation/concurrency/pool.hpp>
+
+using namespace rainy::async;
+using namespace rainy::foundation::concurrency;
+
+namespace {
+    /*
+     * 与库自身抛出的 runtime_error 区分开，确认传播出来的正是子协程的异常
+     */
+    struct child_error : std::runtime_error {
+        using std::runtime_error::runtime_error;
+    };
+
+    coroutine_task<int> value_on(task_scheduler &scheduler, const int value) {
+        co_await schedule_on(scheduler);
+        co_return value;
+    }
+
+    coroutine_task<> touch_on(task_scheduler &scheduler, atomic<int> &counter) {
+        co_await schedule_on(scheduler);
+        counter.fetch_add(1, memory_order_relaxed);
+    }
+
+    coroutine_task<int> throw_on(task_scheduler &scheduler) {
+        co_await schedule_on(scheduler);
+        throw child_error("child");
+    }
+
+    coroutine_task<int> slow_on(task_scheduler &scheduler, const int value) {
+        co_await schedule_on(scheduler);
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        co_return value;
+    }
+}
+
+SCENARIO("schedule_on resumes a coroutine on a pool worker", "[coroutine][schedule_on]") {
+    GIVEN("a pooled pool") {
+        pooled_actor_pool pool(2);
+        const auto caller = std::this_thread::get_id();
+
+        THEN("the continuation runs on another thread") {
+            const auto worker = sync_wait([&]() -> coroutine_task<std::thread::id> {
+                co_await schedule_on(pool);
+                co_return std::this_thread::get_id();
+            }());
+            REQUIRE(worker != caller);
+        }
+    }
+}
+
+SCENARIO("when_all and when_any combine child coroutines", "[coroutine][when_all][when_any]") {
+    GIVEN("a pooled pool") {
+        pooled_actor_pool pool(4);
+        atomic<int> counter{0};
+
+        WHEN("heterogeneous children are joined") {
+            auto [a, b, c] = sync_wait(when_all(value_on(pool, 1), touch_on(pool, counter), value_on(pool, 3)));
+            THEN("results keep their positions and void becomes monostate") {
+                REQUIRE(a == 1);
+                REQUIRE(c == 3);
+                REQUIRE(counter.load() == 1);
+                (void) b;
+            }
+        }
+
+        WHEN("a vector of children is joined") {
+            std::vector<coroutine_task<int>> tasks;
+            for (int i = 0; i < 64; ++i) {
+                tasks.push_back(value_on(pool, i));
+            }
+            const auto results = sync_wait(when_all(std::move(tasks)));
+            THEN("results are in input order") {
+                REQUIRE(results.size() == 64);
+                for (int i = 0; i < 64; ++i) {
+                    REQUIRE(results[i] == i);
+                }
+            }
+        }
+
+        WHEN("one child throws") {
+            THEN("when_all rethrows it") {
+                REQUIRE_THROWS_AS(sync_wait(when_all(value_on(pool, 1), throw_on(pool))), child_error);
+            }
+        }
+
+        WHEN("racing a slow and a fast child") {
+            const auto first = sync_wait(when_any(slow_on(pool, 5), value_on(pool, 7)));
+            THEN("the fast one wins") {
+                REQUIRE(first.index == 1);
+                REQUIRE(first.value == 7);
+            }
+        }
+    }
+}
@@ -393,6 +393,28 @@ SCENARIO_METHOD(PinnedActorPoolFixture, "handles concurrent submissions correctl
     }
 }
 
+SCENARIO("pinned_actor_pool only pins threads to the cpus it is given", "[pinned_actor_pool][affinity]") {
+    GIVEN("a pool built without a cpu set") {
+        pinned_actor_pool pool(2);
+
+        THEN("no thread is pinned, so none can fail") {
+            REQUIRE(pool.unpinned_count() == 0);
+        }
+    }
+
+    GIVEN("a pool asked to pin to a cpu that cannot exist") {
+        pinned_actor_pool pool(2, {static_cast<std::size_t>(1) << 20});
+
+        THEN("the failed bindings are recorded and the pool still runs tasks") {
+            REQUIRE(pool.unpinned_count() == 2);
+            std::atomic<int> counter{0};
+            pool.submit([&] { counter.fetch_add(1, std::memory_order_relaxed); });
+            pool.wait_all();
+            REQUIRE(counter.load() == 1);
+        }
+    }
+}
+
 struct PriorityActorPoolFixture {
     priority_actor_pool pool;
     executor ex;
@@ -904,3 +926,82 @@ SCENARIO("async and async_isolated execute functions correctly", "[async]") {
         }
     }
 }
+
+SCENARIO("submit_bulk distributes a batch across actors", "[actor_pool][bulk]") {
+    GIVEN("a pooled actor pool") {
+        pooled_actor_pool pool(4, 8);
+        constexpr int N = 5000;
+        std::atomic<int> done{0};
+
+        WHEN("a batch is submitted through the span form") {
+            std::vector<rainy::foundation::functional::move_only_delegate<void()>> tasks;
+            tasks.reserve(N);
+            for (int i = 0; i < N; ++i) {
+                tasks.emplace_back([&] { done.fetch_add(1, std::memory_order_relaxed); });
+            }
+            pool.submit_bulk(rainy::collections::views::array_view<rainy::foundation::functional::move_only_delegate<void()>>{tasks});
+            pool.wait_all();
+            THEN("every task runs exactly once") {
+                REQUIRE(done.load() == N);
+            }
+        }
+
+        WHEN("a batch is produced by a generator") {
+            pool.submit_n(N, [&](std::size_t) { return [&] { done.fetch_add(1, std::memory_order_relaxed); }; });
+            pool.wait_all();
+            THEN("every generated task runs exactly once") {
+                REQUIRE(done.load() == N);
+            }
+        }
+    }
+
+    GIVEN("a dedicated actor pool") {
+        const auto pool = std::make_unique<dedicated_actor_pool>(2);
+        std::vector<int> seen;
+        std::mutex mtx;
+
+        WHEN("a range of callables is submitted") {
+            std::vector<std::function<void()>> source;
+            for (int i = 0; i < 100; ++i) {
+                source.emplace_back([&, i] {
+                    std::lock_guard<std::mutex> lk(mtx);
+                    seen.push_back(i);
+                });
+            }
+            pool->submit_bulk(source.begin(), source.end());
+            pool->wait_all();
+            THEN("all of them run") {
+                REQUIRE(seen.size() == 100);
+            }
+        }
+    }
+}
+
+SCENARIO("tasks queued behind a long task are picked up by idle threads", "[actor_pool][inject]") {
+    GIVEN("a pooled actor pool whose first actor is busy") {
+        pooled_actor_pool pool(2);
+        std::atomic<bool> blocker_started{false};
+        const auto begin = std::chrono::steady_clock::now();
+        std::atomic<std::int64_t> quick_delay_ms{-1};
+
+        WHEN("a quick task is submitted to the same actor") {
+            pool.submit_to(0, [&] {
+                blocker_started.store(true);
+                std::this_thread::sleep_for(std::chrono::milliseconds(800));
+            });
+            while (!blocker_started.load()) {
+                std::this_thread::yield();
+            }
+            pool.submit_to(0, [&] {
+                quick_delay_ms.store(
+                    std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - begin).count());
+            });
+            pool.wait_all();
+
+            THEN("the spare thread runs it without waiting for the long task") {
+                REQUIRE(quick_delay_ms.load() >= 0);
+                REQUIRE(quick_delay_ms.load() < 400);
+            }
+        }
+    }
+}
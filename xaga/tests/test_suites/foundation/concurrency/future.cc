@@ -1065,6 +1065,50 @@ SCENARIO("broken promise triggers exception", "[future][broken]") {
     }
 }
 
+SCENARIO("A single then() racing with set_value fires exactly once", "[monad_future][then][concurrency]") {
+    GIVEN("many promises resolved on another thread while a then() chain is attached") {
+        constexpr int rounds = 2000;
+        int mismatches = 0;
+        for (int i = 0; i < rounds; ++i) {
+            promise<int> p;
+            auto f = p.get_monad_future();
+            std::thread producer([&p, i] { p.set_value(i); });
+            auto chained = f.then([](int v) { return v * 2; }).then([](int v) { return v + 1; });
+            producer.join();
+            if (chained.get() != i * 2 + 1) {
+                ++mismatches;
+            }
+        }
+        THEN("every chain observes its own value") {
+            CHECK(mismatches == 0);
+        }
+    }
+}
+
+SCENARIO("Inline and overflow continuations are all drained on resolution", "[shared_future][then]") {
+    GIVEN("a shared_monad_future with several then() registered before resolution") {
+        promise<int> p;
+        auto sf = p.get_monad_future().share();
+        std::vector<monad_future<int>> chained;
+        for (int i = 0; i < 4; ++i) {
+            chained.push_back(sf.then([i](const int v) { return v + i; }));
+        }
+
+        WHEN("the promise is resolved and a late then() is registered") {
+            p.set_value(10);
+            chained.push_back(sf.then([](const int v) { return v * 10; }));
+
+            THEN("each continuation produces its own result") {
+                CHECK(chained[0].get() == 10);
+                CHECK(chained[1].get() == 11);
+                CHECK(chained[2].get() == 12);
+                CHECK(chained[3].get() == 13);
+                CHECK(chained[4].get() == 100);
+            }
+        }
+    }
+}
+
 #ifndef RAINY_USING_MSVC
 #pragma warning(pop)
 #endif
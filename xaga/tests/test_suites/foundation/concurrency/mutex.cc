@@ -160,6 +160,27 @@ TEMPLATE_TEST_CASE("Lock types unified BDD tests", "[lock][bdd]", mutex, recursi
     }
 }
 
+SCENARIO("plain_mtx can be relocked by its owner", "[lock][bdd][pal]") {
+    GIVEN("a mutex created with only plain_mtx") {
+        implements::mtx_t mtx{};
+        REQUIRE(implements::mtx_create(&mtx, implements::mutex_types::plain_mtx) == thrd_result::success);
+
+        WHEN("the owning thread locks it a second time") {
+            REQUIRE(implements::mtx_lock(&mtx) == thrd_result::success);
+            const thrd_result second = implements::mtx_lock(&mtx);
+
+            THEN("the lock nests and is released after matching unlocks") {
+                REQUIRE(second == thrd_result::success);
+                REQUIRE(implements::mtx_unlock(&mtx) == thrd_result::success);
+                REQUIRE(implements::mtx_current_owns(&mtx));
+                REQUIRE(implements::mtx_unlock(&mtx) == thrd_result::success);
+                REQUIRE_FALSE(implements::mtx_current_owns(&mtx));
+            }
+        }
+        REQUIRE(implements::mtx_destroy(&mtx) == thrd_result::success);
+    }
+}
+
 SCENARIO("create_synchronized_task executes callable under mutex", "[create_synchronized_task][bdd]") {
     GIVEN("a mutex and shared counter") {
         mutex m;
@@ -0,0 +1,90 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#include <thread>
+#include <vector>
+
+#include <rainy/foundation/concurrency/basic/parking.hpp>
+
+using namespace rainy::foundation::concurrency;
+
+SCENARIO("event_count registration and notification", "[parking][event_count]") {
+    GIVEN("an event_count without waiters") {
+        event_count events;
+
+        THEN("notify is a no-op") {
+            events.notify_one();
+            events.notify_all();
+            REQUIRE(events.waiters() == 0);
+        }
+
+        WHEN("a waiter prepares and then cancels") {
+            const auto key = events.prepare_wait();
+            REQUIRE(events.waiters() == 1);
+            events.cancel_wait();
+            THEN("it is no longer registered") {
+                REQUIRE(events.waiters() == 0);
+                (void) key;
+            }
+        }
+
+        WHEN("a notification lands between prepare and commit") {
+            const auto key = events.prepare_wait();
+            events.notify_one();
+            events.commit_wait(key);
+            THEN("commit returns immediately") {
+                REQUIRE(events.waiters() == 0);
+            }
+        }
+    }
+}
+
+SCENARIO("idle_parker wakes parked workers", "[parking][idle_parker]") {
+    GIVEN("worker threads that park when no work is available") {
+        constexpr int task_count = 10000;
+        constexpr int worker_count = 4;
+        const std::size_t budget = GENERATE(std::size_t{0}, idle_parker::default_spin_budget);
+        idle_parker parker(budget);
+        atomic<int> pending{0};
+        atomic<int> done{0};
+        atomic<bool> stop{false};
+
+        std::vector<std::thread> workers;
+        for (int i = 0; i < worker_count; ++i) {
+            workers.emplace_back([&] {
+                while (true) {
+                    int available = pending.load(memory_order_acquire);
+                    while (available > 0 && !pending.compare_exchange_weak(available, available - 1, memory_order_acq_rel,
+                                                                           memory_order_acquire)) {
+                    }
+                    if (available > 0) {
+                        done.fetch_add(1, memory_order_relaxed);
+                        continue;
+                    }
+                    if (stop.load(memory_order_acquire)) {
+                        break;
+                    }
+                    parker.idle([&] { return stop.load(memory_order_acquire) || pending.load(memory_order_acquire) > 0; });
+                }
+            });
+        }
+
+        WHEN("tasks are published one at a time with notify_one") {
+            for (int i = 0; i < task_count; ++i) {
+                pending.fetch_add(1, memory_order_release);
+                parker.notify_one();
+            }
+            while (done.load(memory_order_acquire) < task_count) {
+                std::this_thread::yield();
+            }
+            stop.store(true, memory_order_release);
+            parker.notify_all();
+            for (auto &worker: workers) {
+                worker.join();
+            }
+            THEN("every task is consumed and no worker stays parked") {
+                REQUIRE(done.load() == task_count);
+                REQUIRE(parker.parked() == 0);
+            }
+        }
+    }
+}
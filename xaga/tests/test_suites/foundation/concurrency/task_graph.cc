@@ -0,0 +1,167 @@
+#include <catch2/catch_test_macros.hpp>
+#include <stdexcept>
+#include <vector>
+
+#include <rainy/foundation/concurrency/basic/task_graph.hpp>
+#include <rainy/foundation/concurrency/pool.hpp>
+
+using namespace rainy::foundation::concurrency;
+
+namespace {
+    // 前 accepted 次 submit 转交给内部 pool，之后抛出异常
+    class failing_scheduler final : public task_scheduler {
+    public:
+        failing_scheduler(task_scheduler &inner, const int accepted) : inner_(&inner), accepted_(accepted) {
+        }
+
+        void submit(rainy::foundation::functional::move_only_delegate<void()> task) override {
+            if (accepted_-- <= 0) {
+                throw std::runtime_error("submit");
+            }
+            inner_->submit(std::move(task));
+        }
+
+        void submit_local(rainy::foundation::functional::move_only_delegate<void()> task) override {
+            inner_->submit_local(std::move(task));
+        }
+
+        void submit_to(const std::size_t actor_id, rainy::foundation::functional::move_only_delegate<void()> task) override {
+            inner_->submit_to(actor_id, std::move(task));
+        }
+
+        bool stopped() const noexcept override {
+            return inner_->stopped();
+        }
+
+        void stop() override {
+            inner_->stop();
+        }
+
+        void join() override {
+            inner_->join();
+        }
+
+    private:
+        task_scheduler *inner_;
+        int accepted_;
+    };
+}
+
+SCENARIO("task_graph respects declared dependencies", "[task_graph]") {
+    GIVEN("a diamond a -> {b, c} -> d") {
+        pooled_actor_pool pool(4);
+        task_graph graph;
+        atomic<int> clock{0};
+        std::vector<int> stamp(4, -1);
+        auto node = [&](const int index) {
+            return graph.emplace([&, index] { stamp[index] = clock.fetch_add(1, memory_order_acq_rel); });
+        };
+        const auto a = node(0);
+        const auto b = node(1);
+        const auto c = node(2);
+        const auto d = node(3);
+        graph.precede(a, b);
+        graph.precede(a, c);
+        graph.precede(b, d);
+        graph.precede(c, d);
+
+        WHEN("it is run several times") {
+            for (int round = 0; round < 50; ++round) {
+                clock.store(0);
+                graph.run(pool);
+                REQUIRE(stamp[0] == 0);
+                REQUIRE(stamp[3] == 3);
+                REQUIRE(stamp[1] > stamp[0]);
+                REQUIRE(stamp[2] > stamp[0]);
+            }
+            THEN("the graph keeps its shape between runs") {
+                REQUIRE(graph.size() == 4);
+            }
+        }
+    }
+
+    GIVEN("a wide layered graph") {
+        constexpr int width = 100;
+        constexpr int layers = 20;
+        dedicated_actor_pool pool(3);
+        task_graph graph;
+        atomic<int> executed{0};
+        std::vector<task_graph::node_id> previous;
+        for (int layer = 0; layer < layers; ++layer) {
+            std::vector<task_graph::node_id> current;
+            for (int i = 0; i < width; ++i) {
+                current.push_back(graph.emplace([&executed] { executed.fetch_add(1, memory_order_relaxed); }));
+                if (!previous.empty()) {
+                    graph.precede(previous[i], current.back());
+                    graph.precede(previous[(i + 1) % width], current.back());
+                }
+            }
+            previous = std::move(current);
+        }
+
+        WHEN("it runs on a dedicated pool") {
+            graph.run(pool);
+            graph.run(pool);
+            THEN("every node runs once per run") {
+                REQUIRE(executed.load() == 2 * width * layers);
+            }
+        }
+    }
+
+    GIVEN("a chain whose first node throws") {
+        pooled_actor_pool pool(2);
+        task_graph graph;
+        bool tail_ran = false;
+        const auto head = graph.emplace([] { throw std::runtime_error("head"); });
+        const auto tail = graph.emplace([&tail_ran] { tail_ran = true; });
+        graph.precede(head, tail);
+
+        THEN("run rethrows and later nodes are skipped") {
+            REQUIRE_THROWS_AS(graph.run(pool), std::runtime_error);
+            REQUIRE_FALSE(tail_ran);
+        }
+    }
+
+    GIVEN("a graph run from a task on a single-thread pinned pool") {
+        pinned_actor_pool pool(1);
+        task_graph graph;
+        atomic<int> executed{0};
+        const auto head = graph.emplace([&executed] { executed.fetch_add(1, memory_order_relaxed); });
+        for (int i = 0; i < 8; ++i) {
+            graph.precede(head, graph.emplace([&executed] { executed.fetch_add(1, memory_order_relaxed); }));
+        }
+
+        WHEN("the task waits for the graph") {
+            atomic<bool> done{false};
+            pool.submit([&] {
+                graph.run(pool);
+                done.store(true, memory_order_release);
+            });
+            pool.wait_all();
+            THEN("the waiting worker runs the nodes itself instead of deadlocking") {
+                REQUIRE(done.load(memory_order_acquire));
+                REQUIRE(executed.load() == 9);
+            }
+        }
+    }
+
+    GIVEN("a scheduler that fails to accept the second root") {
+        pooled_actor_pool pool(2);
+        task_graph graph;
+        atomic<int> executed{0};
+        const auto first = graph.emplace([&executed] { executed.fetch_add(1, memory_order_relaxed); });
+        const auto second = graph.emplace([&executed] { executed.fetch_add(1, memory_order_relaxed); });
+        const auto join = graph.emplace([&executed] { executed.fetch_add(1, memory_order_relaxed); });
+        graph.precede(first, join);
+        graph.precede(second, join);
+
+        THEN("dispatch throws after the submitted part finishes and the graph can run again") {
+            failing_scheduler failing(pool, 1);
+            REQUIRE_THROWS_AS(graph.dispatch(failing), std::runtime_error);
+            REQUIRE(executed.load() <= 1);
+            executed.store(0);
+            graph.run(pool);
+            REQUIRE(executed.load() == 3);
+        }
+    }
+}
@@ -0,0 +1,59 @@
+#include <catch2/catch_test_macros.hpp>
+#include <vector>
+
+#include <rainy/foundation/concurrency/basic/topology.hpp>
+#include <rainy/foundation/concurrency/pool.hpp>
+
+using namespace rainy::foundation::concurrency;
+
+SCENARIO("cpu_topology parses kernel cpulist strings", "[topology][parse]") {
+    GIVEN("ranges and single cpus mixed together") {
+        THEN("they expand in ascending order") {
+            REQUIRE(cpu_topology::parse_cpu_list("0-3,8,10-11\n") == std::vector<std::size_t>{0, 1, 2, 3, 8, 10, 11});
+        }
+    }
+
+    GIVEN("unordered, duplicated or malformed pieces") {
+        THEN("duplicates are merged and malformed pieces are skipped") {
+            REQUIRE(cpu_topology::parse_cpu_list(" 2 , 0,2") == std::vector<std::size_t>{0, 2});
+            REQUIRE(cpu_topology::parse_cpu_list("x,5-3,7") == std::vector<std::size_t>{7});
+            REQUIRE(cpu_topology::parse_cpu_list("").empty());
+        }
+    }
+}
+
+SCENARIO("cpu_topology maps cpus to nodes", "[topology][node]") {
+    GIVEN("a two-node topology given out of order") {
+        const cpu_topology topology{{numa_node{1, {4, 5, 6, 7}}, numa_node{0, {0, 1, 2, 3}}}};
+
+        THEN("nodes are sorted and cpus expand node by node") {
+            REQUIRE(topology.node_count() == 2);
+            REQUIRE(topology.nodes().front().id == 0);
+            REQUIRE(topology.cpus() == std::vector<std::size_t>{0, 1, 2, 3, 4, 5, 6, 7});
+        }
+
+        THEN("node_of finds the owning node") {
+            REQUIRE(topology.node_of(2) == 0);
+            REQUIRE(topology.node_of(6) == 1);
+            REQUIRE(topology.node_of(42) == cpu_topology::unknown_node);
+        }
+    }
+
+    GIVEN("the current machine") {
+        const cpu_topology &topology = cpu_topology::current();
+        THEN("at least one node with cpus is reported") {
+            REQUIRE(topology.node_count() >= 1);
+            REQUIRE_FALSE(topology.cpus().empty());
+        }
+    }
+}
+
+SCENARIO("locality_order visits same-node peers first", "[topology][locality]") {
+    GIVEN("four members split across two nodes") {
+        const std::vector<std::size_t> nodes{0, 1, 0, 1};
+        THEN("peers on the same node come before remote ones, rotating from self") {
+            REQUIRE(implements::locality_order(0, nodes) == std::vector<std::size_t>{2, 1, 3});
+            REQUIRE(implements::locality_order(3, nodes) == std::vector<std::size_t>{1, 0, 2});
+        }
+    }
+}
@@ -0,0 +1,170 @@
+#include <catch2/catch_test_macros.hpp>
+#include <thread>
+#include <vector>
+
+#include <rainy/foundation/concurrency/basic/work_stealing_deque.hpp>
+
+using namespace rainy::foundation::concurrency;
+
+SCENARIO("work_stealing_deque ordering for owner and thieves", "[work_stealing_deque][order]") {
+    GIVEN("a deque with three tasks pushed by the owner") {
+        work_stealing_deque deque;
+        std::vector<int> trace;
+        for (int i = 1; i <= 3; ++i) {
+            deque.push([&trace, i] { trace.push_back(i); });
+        }
+
+        THEN("size reflects the pushed tasks") {
+            REQUIRE(deque.size() == 3);
+            REQUIRE_FALSE(deque.empty());
+        }
+
+        WHEN("the owner pops everything") {
+            while (auto task = deque.pop()) {
+                (*task)();
+            }
+            THEN("tasks come back in LIFO order") {
+                REQUIRE(trace == std::vector<int>{3, 2, 1});
+                REQUIRE(deque.empty());
+            }
+        }
+
+        WHEN("a thief steals once") {
+            auto task = deque.steal();
+            REQUIRE(task.has_value());
+            (*task)();
+            THEN("the oldest task is taken from the top") {
+                REQUIRE(trace == std::vector<int>{1});
+                REQUIRE(deque.size() == 2);
+            }
+        }
+    }
+
+    GIVEN("tasks injected from another thread") {
+        work_stealing_deque deque;
+        std::vector<int> trace;
+        std::thread producer([&] {
+            for (int i = 1; i <= 3; ++i) {
+                deque.inject([&trace, i] { trace.push_back(i); });
+            }
+        });
+        producer.join();
+
+        THEN("they are counted before the owner drains them") {
+            REQUIRE(deque.size() == 3);
+        }
+
+        WHEN("the owner pops everything") {
+            while (auto task = deque.pop()) {
+                (*task)();
+            }
+            THEN("injected tasks keep their submission order") {
+                REQUIRE(trace == std::vector<int>{1, 2, 3});
+            }
+        }
+
+        WHEN("another owner takes over the injected tasks") {
+            work_stealing_deque other;
+            REQUIRE(deque.steal_injected(other) == 3);
+            THEN("they move across in submission order") {
+                REQUIRE(deque.empty());
+                REQUIRE(other.stealable_size() == 3);
+                while (auto task = other.pop()) {
+                    (*task)();
+                }
+                REQUIRE(trace == std::vector<int>{1, 2, 3});
+                REQUIRE(deque.steal_injected(other) == 0);
+            }
+        }
+    }
+}
+
+SCENARIO("work_stealing_deque growth and batch stealing", "[work_stealing_deque][steal_half]") {
+    GIVEN("a deque created with a small capacity") {
+        work_stealing_deque deque(4);
+        int sum = 0;
+        for (int i = 0; i < 100; ++i) {
+            deque.push([&sum, i] { sum += i; });
+        }
+
+        THEN("the ring grows to hold every task") {
+            REQUIRE(deque.capacity() >= 100);
+            REQUIRE(deque.size() == 100);
+        }
+
+        WHEN("another deque steals half of it") {
+            work_stealing_deque thief;
+            const std::size_t moved = deque.steal_half(thief);
+            THEN("the batch is bounded and nothing is lost") {
+                REQUIRE(moved == work_stealing_deque::max_steal_batch);
+                REQUIRE(thief.size() == moved);
+                REQUIRE(deque.size() == 100 - moved);
+                while (auto task = thief.pop()) {
+                    (*task)();
+                }
+                while (auto task = deque.pop()) {
+                    (*task)();
+                }
+                REQUIRE(sum == 4950);
+            }
+        }
+    }
+
+    GIVEN("a deque holding three tasks") {
+        work_stealing_deque deque;
+        for (int i = 0; i < 3; ++i) {
+            deque.push([] {});
+        }
+        WHEN("stealing half into an empty deque") {
+            work_stealing_deque thief;
+            THEN("two tasks are moved") {
+                REQUIRE(deque.steal_half(thief) == 2);
+                REQUIRE(deque.size() == 1);
+            }
+        }
+    }
+}
+
+SCENARIO("work_stealing_deque under concurrent stealing", "[work_stealing_deque][concurrent]") {
+    GIVEN("an owner pushing and popping while thieves steal") {
+        constexpr int task_count = 20000;
+        work_stealing_deque deque(8);
+        atomic<int> executed{0};
+        atomic<bool> done{false};
+
+        auto thief = [&](const bool batch) {
+            work_stealing_deque local;
+            while (!done.load(memory_order_acquire) || !deque.empty()) {
+                if (batch) {
+                    deque.steal_half(local);
+                } else if (auto task = deque.steal()) {
+                    (*task)();
+                }
+                while (auto task = local.pop()) {
+                    (*task)();
+                }
+            }
+        };
+        std::thread single(thief, false);
+        std::thread batched(thief, true);
+
+        for (int i = 0; i < task_count; ++i) {
+            deque.push([&executed] { executed.fetch_add(1, memory_order_relaxed); });
+            if (i % 4 == 0) {
+                if (auto task = deque.pop()) {
+                    (*task)();
+                }
+            }
+        }
+        while (auto task = deque.pop()) {
+            (*task)();
+        }
+        done.store(true, memory_order_release);
+        single.join();
+        batched.join();
+
+        THEN("every task runs exactly once") {
+            REQUIRE(executed.load() == task_count);
+        }
+    }
+}
@@ -0,0 +1,80 @@
+#include <catch2/catch_test_macros.hpp>
+#include <system_error>
+
+#include <rainy/async/coro.hpp>
+#include <rainy/foundation/io/executor/use_awaitable.hpp>
+#include <rainy/foundation/io/timer.hpp>
+
+using namespace rainy::foundation::io;
+using rainy::async::coroutine_task;
+using namespace std::chrono_literals;
+
+namespace {
+    coroutine_task<int> wait_twice(steady_timer &timer) {
+        co_await timer.async_wait(use_awaitable);
+        timer.expires_after(1ms);
+        co_await timer.async_wait(use_awaitable);
+        co_return 2;
+    }
+
+    coroutine_task<bool> hop(io_context &ctx) {
+        co_await schedule_on(ctx);
+        co_return ctx.get_executor().running_in_this_thread();
+    }
+
+    coroutine_task<> wait_once(steady_timer &timer) {
+        co_await timer.async_wait(use_awaitable);
+    }
+}
+
+SCENARIO("use_awaitable resumes a coroutine when the operation completes", "[use_awaitable][timer]") {
+    GIVEN("a coroutine awaiting a timer twice") {
+        io_context ctx;
+        steady_timer timer(ctx, 5ms);
+        auto task = wait_twice(timer);
+
+        WHEN("the coroutine is started and the context runs") {
+            task.resume();
+            ctx.run();
+            THEN("both waits completed in straight-line order") {
+                REQUIRE(task.is_ready());
+                REQUIRE(task.promise().result() == 2);
+            }
+        }
+    }
+
+    GIVEN("a coroutine awaiting a timer that is cancelled") {
+        io_context ctx;
+        steady_timer timer(ctx, 10s);
+        auto task = wait_once(timer);
+        task.resume();
+
+        WHEN("the wait is cancelled") {
+            REQUIRE(timer.cancel() == 1);
+            ctx.run();
+            THEN("co_await throws operation_canceled") {
+                REQUIRE(task.is_ready());
+                try {
+                    task.promise().result();
+                    FAIL("expected system_error");
+                } catch (const std::system_error &e) {
+                    REQUIRE(e.code() == std::make_error_code(std::errc::operation_canceled));
+                }
+            }
+        }
+    }
+}
+
+SCENARIO("schedule_on moves a coroutine onto an io_context", "[use_awaitable][schedule_on]") {
+    GIVEN("a coroutine that hops onto the context") {
+        io_context ctx;
+        auto task = hop(ctx);
+        task.resume();
+        THEN("it only continues once the context runs") {
+            REQUIRE_FALSE(task.is_ready());
+            ctx.run();
+            REQUIRE(task.is_ready());
+            REQUIRE(task.promise().result());
+        }
+    }
+}
@@ -598,3 +598,181 @@ SCENARIO_METHOD(RandomAccessFileFixture,
         teardown();
     }
 }
+
+SCENARIO_METHOD(RandomAccessFileFixture,
+                "random_access_file async writes issued inside the event loop are submitted in one batch",
+                "[random_access_file][async][batch]") {
+
+    GIVEN("a new file opened for writing") {
+        setup();
+        random_access_file file(ctx, test_file_path,
+                                open_mode::write_only | open_mode::create);
+        file.resize(16);
+
+        WHEN("four async writes are started from a handler running in the loop") {
+            int completed = 0;
+            foundation::text::string parts[4] = {"AAAA", "BBBB", "CCCC", "DDDD"};
+
+            ctx.get_executor().post([&] {
+                for (int i = 0; i < 4; ++i) {
+                    file.async_write_some_at(static_cast<std::uint64_t>(i) * 4, io::buffer(parts[i]),
+                        [&](std::error_code ec, std::size_t n) {
+                            if (!ec && n == 4) {
+                                ++completed;
+                            }
+                        });
+                }
+            }, std::allocator<void>{});
+
+            ctx.run();
+
+            THEN("every write completes and the content is correct") {
+                REQUIRE(completed == 4);
+                file.close();
+                REQUIRE(read_file_content() == "AAAABBBBCCCCDDDD");
+            }
+
+#if RAINY_USING_LINUX
+            THEN("the writes share a single flush") {
+                const auto stats = ctx.submission_stats();
+                REQUIRE(stats.flushes >= 1);
+                REQUIRE(stats.submitted >= 4);
+                REQUIRE(stats.max_batch >= 4);
+            }
+#endif
+        }
+
+        WHEN("flush() is called with nothing queued") {
+            THEN("it submits nothing") {
+                REQUIRE(ctx.flush() == 0);
+            }
+        }
+
+        teardown();
+    }
+}
+
+SCENARIO_METHOD(RandomAccessFileFixture,
+                "random_access_file async writes from a fixed buffer on a registered file",
+                "[random_access_file][async][fixed]") {
+
+    GIVEN("an io_context with a registered file table and fixed buffer pool") {
+        setup();
+        const bool registered = !ctx.register_files(4) && !ctx.register_buffers(2, 4096);
+
+        if (registered) {
+            random_access_file file(ctx, test_file_path, open_mode::read_write | open_mode::create);
+
+            WHEN("data staged in a fixed buffer is written and read back") {
+                fixed_buffer out = ctx.acquire_fixed_buffer();
+                fixed_buffer in = ctx.acquire_fixed_buffer();
+                REQUIRE(out);
+                REQUIRE(in);
+                std::memcpy(out.data(), "fixed-io", 8);
+
+                std::size_t written = 0;
+                std::size_t read = 0;
+                file.async_write_some_at(0, io::buffer(out.data(), 8), [&](std::error_code ec, std::size_t n) {
+                    REQUIRE_FALSE(ec);
+                    written = n;
+                    file.async_read_some_at(0, io::buffer(in.data(), 8), [&](std::error_code ec2, std::size_t m) {
+                        REQUIRE_FALSE(ec2);
+                        read = m;
+                    });
+                });
+                ctx.run();
+
+                THEN("both operations transfer the whole payload") {
+                    REQUIRE(written == 8);
+                    REQUIRE(read == 8);
+                    REQUIRE(std::memcmp(in.data(), "fixed-io", 8) == 0);
+                }
+            }
+        }
+
+        teardown();
+    }
+}
+
+SCENARIO_METHOD(RandomAccessFileFixture,
+                "random_access_file write followed by a data sync",
+                "[random_access_file][async][sync]") {
+
+    GIVEN("a writable file") {
+        setup();
+        random_access_file file(ctx, test_file_path, open_mode::read_write | open_mode::create);
+
+        WHEN("async_write_some_at_and_sync writes a payload") {
+            foundation::text::string data = "durable";
+            bool done = false;
+            std::error_code async_ec;
+            std::size_t transferred = 0;
+            file.async_write_some_at_and_sync(0, io::buffer(data), [&](std::error_code ec, std::size_t n) {
+                async_ec = ec;
+                transferred = n;
+                done = true;
+            });
+            ctx.run();
+
+            THEN("the handler runs once with the bytes written and the data is on disk") {
+                REQUIRE(done);
+                REQUIRE_FALSE(async_ec);
+                REQUIRE(transferred == data.size());
+                REQUIRE(read_file_content() == data);
+            }
+        }
+
+        WHEN("sync() is called on the open file") {
+            THEN("both full and data-only syncs succeed") {
+                REQUIRE_FALSE(file.sync());
+                REQUIRE_FALSE(file.sync(true));
+            }
+        }
+
+        teardown();
+    }
+}
+
+#if RAINY_USING_LINUX
+// 其它后端的默认实现只处理第一段
+SCENARIO_METHOD(RandomAccessFileFixture,
+                "random_access_file gathers and scatters buffer sequences in one operation",
+                "[random_access_file][async][vectored]") {
+
+    GIVEN("a writable file") {
+        setup();
+        random_access_file file(ctx, test_file_path, open_mode::read_write | open_mode::create);
+
+        WHEN("a header and a payload are written as one sequence and read back into two buffers") {
+            const char header[] = "HDR:";
+            const char payload[] = "payload";
+            std::vector<const_buffer> out{io::buffer(header, 4), io::buffer(payload, 7)};
+            char head_in[4]{};
+            char body_in[7]{};
+            std::vector<mutable_buffer> in{io::buffer(head_in), io::buffer(body_in)};
+
+            std::size_t written = 0;
+            std::size_t read = 0;
+            file.async_write_some_at(0, out, [&](std::error_code ec, std::size_t n) {
+                REQUIRE_FALSE(ec);
+                written = n;
+                file.async_read_some_at(0, in, [&](std::error_code ec2, std::size_t m) {
+                    REQUIRE_FALSE(ec2);
+                    read = m;
+                });
+            });
+            ctx.run();
+
+            THEN("both segments land contiguously in the file and split back in order") {
+                REQUIRE(written == 11);
+                REQUIRE(read == 11);
+                REQUIRE(read_file_content() == "HDR:payload");
+                REQUIRE(std::memcmp(head_in, "HDR:", 4) == 0);
+                REQUIRE(std::memcmp(body_in, "payload", 7) == 0);
+            }
+        }
+
+        teardown();
+    }
+}
+#endif
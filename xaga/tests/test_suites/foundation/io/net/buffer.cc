@@ -852,3 +852,46 @@ SCENARIO("dynamic_buffer factory returns correctly initialised wrappers", "[buff
         }
     }
 }
+
+SCENARIO("buffer_sequence_array flattens buffer sequences for gather I/O", "[buffer][sequence]") {
+    using segment_array = foundation::io::implements::buffer_sequence_array<const_buffer>;
+
+    GIVEN("a sequence of const_buffers with an empty segment") {
+        const char head[] = "HEAD";
+        const char body[] = "body-bytes";
+        std::vector<const_buffer> sequence{buffer(head, 4), const_buffer{}, buffer(body, 10)};
+        const segment_array segments(sequence);
+
+        THEN("empty segments are skipped and the rest keep their order") {
+            REQUIRE(segments.size() == 2);
+            REQUIRE(segments.data()[0].data() == head);
+            REQUIRE(segments.data()[1].data() == body);
+            REQUIRE(segments.total_size() == 14);
+        }
+    }
+
+    GIVEN("a single mutable_buffer") {
+        char storage[8]{};
+        const segment_array segments(buffer(storage));
+
+        THEN("it becomes a one-element array") {
+            REQUIRE(segments.size() == 1);
+            REQUIRE(segments.front().data() == storage);
+            REQUIRE(segments.front().size() == sizeof(storage));
+        }
+    }
+
+    GIVEN("more segments than the inline capacity") {
+        char bytes[32]{};
+        std::vector<const_buffer> sequence;
+        for (char &b: bytes) {
+            sequence.emplace_back(&b, 1);
+        }
+        const segment_array segments(sequence);
+
+        THEN("only the first max_segments are taken") {
+            REQUIRE(segments.size() == segment_array::max_segments);
+            REQUIRE(segments.data()[15].data() == &bytes[15]);
+        }
+    }
+}
@@ -702,4 +702,242 @@ SCENARIO("multiple executor copies obtained from the same io_context share state
             }
         }
     }
-}
\ No newline at end of file
+}
+SCENARIO("setup_provided_buffers() creates the pool used by multishot receive once",
+         "[io_context][provided_buffers]") {
+
+    GIVEN("a fresh io_context") {
+        io_context ctx;
+
+        WHEN("no pool has been created") {
+            THEN("a default borrowed_buffer is empty and releasing it is harmless") {
+                borrowed_buffer buffer;
+                REQUIRE_FALSE(buffer);
+                REQUIRE(buffer.data() == nullptr);
+                REQUIRE(buffer.empty());
+                buffer.release();
+                REQUIRE_FALSE(buffer);
+            }
+        }
+
+#if RAINY_USING_LINUX
+        WHEN("a pool with a non power-of-two buffer count is requested") {
+            auto ec = ctx.setup_provided_buffers(3, 4096);
+
+            THEN("the request is rejected") {
+                REQUIRE(ec);
+            }
+        }
+
+        WHEN("a valid pool is requested twice") {
+            auto first = ctx.setup_provided_buffers(16, 4096);
+            auto second = ctx.setup_provided_buffers(16, 4096);
+
+            THEN("the first call succeeds and the second reports the pool as busy") {
+                REQUIRE_FALSE(first);
+                REQUIRE(second == std::make_error_code(std::errc::device_or_resource_busy));
+            }
+        }
+#else
+        WHEN("the backend has no provided buffer support") {
+            auto ec = ctx.setup_provided_buffers(16, 4096);
+
+            THEN("operation_not_supported is reported") {
+                REQUIRE(ec == std::make_error_code(std::errc::operation_not_supported));
+            }
+        }
+#endif
+    }
+}
+
+SCENARIO("register_files() and register_buffers() set up the fixed resources once",
+         "[io_context][fixed]") {
+
+    GIVEN("a fresh io_context") {
+        io_context ctx;
+
+        WHEN("no fixed buffer pool has been registered") {
+            THEN("acquire_fixed_buffer() hands out an empty buffer") {
+                fixed_buffer buffer = ctx.acquire_fixed_buffer();
+                REQUIRE_FALSE(buffer);
+                REQUIRE(buffer.data() == nullptr);
+                REQUIRE(buffer.size() == 0);
+            }
+        }
+
+#if RAINY_USING_LINUX
+        WHEN("a pool of two buffers is registered") {
+            auto ec = ctx.register_buffers(2, 4096);
+
+            THEN("buffers can be borrowed until the pool runs dry and are reusable after release") {
+                REQUIRE_FALSE(ec);
+                fixed_buffer first = ctx.acquire_fixed_buffer();
+                fixed_buffer second = ctx.acquire_fixed_buffer();
+                REQUIRE(first);
+                REQUIRE(second);
+                REQUIRE(first.size() == 4096);
+                REQUIRE(first.data() != second.data());
+                REQUIRE_FALSE(ctx.acquire_fixed_buffer());
+                first.release();
+                REQUIRE(ctx.acquire_fixed_buffer());
+            }
+
+            THEN("a second registration reports the pool as busy") {
+                REQUIRE(ctx.register_buffers(2, 4096) == std::make_error_code(std::errc::device_or_resource_busy));
+            }
+        }
+
+        WHEN("a file table is registered twice") {
+            auto first = ctx.register_files(16);
+            auto second = ctx.register_files(16);
+
+            THEN("the first call succeeds and the second reports the table as busy") {
+                REQUIRE_FALSE(first);
+                REQUIRE(second == std::make_error_code(std::errc::device_or_resource_busy));
+            }
+        }
+#else
+        WHEN("the backend has no fixed resource support") {
+            THEN("operation_not_supported is reported") {
+                REQUIRE(ctx.register_files(16) == std::make_error_code(std::errc::operation_not_supported));
+                REQUIRE(ctx.register_buffers(2, 4096) == std::make_error_code(std::errc::operation_not_supported));
+            }
+        }
+#endif
+    }
+}
+
+SCENARIO("io_context constructed from options falls back to what the kernel accepts",
+         "[io_context][options]") {
+
+    GIVEN("options requesting an explicit depth, a larger CQ and single issuer with deferred task running") {
+        io_context::options_type options;
+        options.queue_depth = 128;
+        options.completion_queue_depth = 1024;
+        options.single_issuer = true;
+        options.defer_taskrun = true;
+        io_context ctx(options);
+
+        WHEN("handlers are posted from another thread while run() is blocked") {
+            auto ex = ctx.get_executor();
+            ex.on_work_started();
+            std::atomic<int> executed{0};
+
+            std::thread runner([&] { ctx.run(); });
+            std::this_thread::sleep_for(20ms);
+            std::thread poster([&] {
+                for (int i = 0; i < 8; ++i) {
+                    ex.post([&] { ++executed; }, std::allocator<void>{});
+                }
+                ex.post([&] { ex.on_work_finished(); }, std::allocator<void>{});
+            });
+            poster.join();
+            runner.join();
+
+            THEN("every handler runs whichever flags were applied") {
+                REQUIRE(executed.load() == 8);
+            }
+        }
+
+        THEN("the applied options never claim more than was requested") {
+            const auto applied = ctx.applied_options();
+            REQUIRE_FALSE(applied.submission_polling);
+            REQUIRE_FALSE(applied.cooperative_taskrun);
+            if (applied.defer_taskrun) {
+                REQUIRE(applied.single_issuer);
+            }
+#if RAINY_USING_LINUX
+            REQUIRE(applied.queue_depth == 128);
+            REQUIRE(applied.completion_queue_depth >= applied.queue_depth);
+#endif
+        }
+    }
+}
+
+SCENARIO("handlers posted concurrently from many threads all run in per-thread order",
+         "[io_context][post][concurrency]") {
+
+    GIVEN("an io_context kept alive while producers post") {
+        io_context ctx;
+        auto ex = ctx.get_executor();
+        constexpr int producers = 4;
+        constexpr int per_producer = 10000;
+        std::vector<int> last_seen(producers, -1);
+        std::atomic<bool> ordered{true};
+        std::atomic<int> executed{0};
+
+        WHEN("each producer posts a numbered sequence while run() drains") {
+            ex.on_work_started();
+            std::thread runner([&] { ctx.run(); });
+            std::vector<std::thread> threads;
+            for (int p = 0; p < producers; ++p) {
+                threads.emplace_back([&, p] {
+                    for (int i = 0; i < per_producer; ++i) {
+                        ex.post([&, p, i] {
+                            if (last_seen[p] + 1 != i) {
+                                ordered = false;
+                            }
+                            last_seen[p] = i;
+                            ++executed;
+                        }, std::allocator<void>{});
+                    }
+                });
+            }
+            for (auto &t: threads) {
+                t.join();
+            }
+            ex.post([&] { ex.on_work_finished(); }, std::allocator<void>{});
+            runner.join();
+
+            THEN("nothing is lost and each producer's handlers run in posting order") {
+                REQUIRE(executed.load() == producers * per_producer);
+                REQUIRE(ordered.load());
+            }
+        }
+    }
+}
+
+SCENARIO("a multi-ring io_context runs each ring on its own thread",
+         "[io_context][multi_ring]") {
+
+    GIVEN("an io_context with four rings and four runner threads") {
+        io_context::options_type options;
+        options.ring_count = 4;
+        io_context ctx(options);
+        const std::size_t rings = ctx.applied_options().ring_count;
+        auto ex = ctx.get_executor();
+        ex.on_work_started();
+
+        std::vector<std::thread::id> owners(rings);
+        std::atomic<std::size_t> hops{0};
+
+        WHEN("work is posted to every ring and each ring forwards to the next") {
+            std::vector<std::thread> runners;
+            for (std::size_t i = 0; i < rings; ++i) {
+                runners.emplace_back([&] { ctx.run(); });
+            }
+            for (std::size_t i = 0; i < rings; ++i) {
+                ctx.post_to_ring(i, [&, i] {
+                    owners[i] = std::this_thread::get_id();
+                    ctx.post_to_ring((i + 1) % rings, [&] {
+                        if (++hops == rings) {
+                            ex.on_work_finished();
+                        }
+                    });
+                });
+            }
+            for (auto &t: runners) {
+                t.join();
+            }
+
+            THEN("every forwarded handler ran and rings were served by distinct threads") {
+                REQUIRE(hops.load() == rings);
+                for (std::size_t i = 0; i < rings; ++i) {
+                    for (std::size_t j = i + 1; j < rings; ++j) {
+                        REQUIRE(owners[i] != owners[j]);
+                    }
+                }
+            }
+        }
+    }
+}
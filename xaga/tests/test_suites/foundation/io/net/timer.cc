@@ -15,6 +15,7 @@
  */
 #include <rainy/foundation/io/timer.hpp>
 #include <atomic>
+#include <memory>
 #include <catch2/catch_test_macros.hpp>
 #include <catch2/matchers/catch_matchers.hpp>
 
@@ -441,6 +442,44 @@ SCENARIO("multiple timers sharing one io_context all fire correctly", "[timer][m
     }
 }
 
+SCENARIO("many timers can be armed, cancelled and re-armed on one io_context", "[timer][multi][cancel]") {
+    GIVEN("a thousand steady_timers armed with expiries spread over a minute") {
+        io_context ctx;
+        std::vector<std::unique_ptr<steady_timer>> timers;
+        std::atomic<int> cancel_count{0};
+        std::atomic<int> success_count{0};
+        for (int i = 0; i < 1000; ++i) {
+            timers.push_back(std::make_unique<steady_timer>(ctx, std::chrono::milliseconds(1000 + i * 60)));
+            timers.back()->async_wait([&](std::error_code ec) {
+                if (ec == std::make_error_code(std::errc::operation_canceled)) {
+                    ++cancel_count;
+                } else if (!ec) {
+                    ++success_count;
+                }
+            });
+        }
+        WHEN("every timer is cancelled and every tenth one is re-armed to expire soon") {
+            std::size_t cancelled = 0;
+            for (std::size_t i = 0; i < timers.size(); ++i) {
+                cancelled += timers[i]->expires_after(std::chrono::milliseconds(i % 10 == 0 ? 5 + static_cast<int>(i % 30) : 60000));
+                if (i % 10 == 0) {
+                    timers[i]->async_wait([&](std::error_code ec) {
+                        if (!ec) {
+                            ++success_count;
+                        }
+                    });
+                }
+            }
+            ctx.run();
+            THEN("all original waits were cancelled and only the re-armed ones fired") {
+                REQUIRE(cancelled == 1000);
+                REQUIRE(cancel_count.load() == 1000);
+                REQUIRE(success_count.load() == 100);
+            }
+        }
+    }
+}
+
 SCENARIO("a timer can be rescheduled and awaited again after firing", "[timer][reschedule]") {
     GIVEN("a steady_timer that has already fired once") {
         io_context ctx;
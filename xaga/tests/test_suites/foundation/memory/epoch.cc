@@ -0,0 +1,181 @@
+/*
+ * Copyright 2026 rainy-juzixiao
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <atomic>
+#include <catch2/catch_test_macros.hpp>
+#include <rainy/foundation/memory/epoch.hpp>
+#include <thread>
+#include <vector>
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-do-while)
+
+using namespace rainy::foundation::memory;
+
+namespace {
+    std::atomic<int> epoch_live_objects{0};
+
+    struct epoch_tracked {
+        epoch_tracked() {
+            epoch_live_objects.fetch_add(1);
+        }
+
+        ~epoch_tracked() {
+            epoch_live_objects.fetch_sub(1);
+        }
+
+        int value{0};
+        std::atomic<epoch_tracked *> next{nullptr};
+    };
+
+    std::size_t epoch_reclaim_rounds(const int rounds) {
+        std::size_t reclaimed = 0;
+        for (int i = 0; i < rounds; ++i) {
+            reclaimed += epoch_domain<epoch_tracked>::global().reclaim();
+        }
+        return reclaimed;
+    }
+}
+
+TEST_CASE("Epoch RetireWithoutGuard") {
+    const int before = epoch_live_objects.load();
+    epoch_domain<epoch_tracked>::global().retire(new epoch_tracked);
+    REQUIRE(epoch_live_objects.load() == before + 1);
+    REQUIRE(epoch_reclaim_rounds(3) >= 1);
+    REQUIRE(epoch_live_objects.load() == before);
+}
+
+TEST_CASE("Epoch GuardPreventsReclaim") {
+    const int before = epoch_live_objects.load();
+    {
+        auto guard = epoch_domain<epoch_tracked>::global().acquire();
+        REQUIRE(guard.is_pinned());
+        rainy_const ptr = guard.protect(new epoch_tracked);
+        epoch_domain<epoch_tracked>::global().retire(ptr);
+        epoch_reclaim_rounds(4);
+        // 仍处于临界区，全局纪元最多只能再推进一次
+        REQUIRE(epoch_live_objects.load() == before + 1);
+    }
+    REQUIRE(epoch_reclaim_rounds(3) >= 1);
+    REQUIRE(epoch_live_objects.load() == before);
+}
+
+TEST_CASE("Epoch NestedAndMovedGuards") {
+    const int before = epoch_live_objects.load();
+    {
+        epoch_guard outer;
+        {
+            epoch_guard inner;
+            epoch_guard moved(std::move(inner));
+            REQUIRE_FALSE(inner.is_pinned());
+            REQUIRE(moved.is_pinned());
+            epoch_domain<epoch_tracked>::global().retire(new epoch_tracked);
+        }
+        // 内层守卫退出后外层仍在临界区
+        epoch_reclaim_rounds(4);
+        REQUIRE(epoch_live_objects.load() == before + 1);
+        outer = epoch_guard{};
+        REQUIRE(outer.is_pinned());
+    }
+    epoch_reclaim_rounds(3);
+    REQUIRE(epoch_live_objects.load() == before);
+}
+
+TEST_CASE("Epoch RepinLetsEpochAdvance") {
+    const int before = epoch_live_objects.load();
+    epoch_guard guard;
+    epoch_domain<epoch_tracked>::global().retire(new epoch_tracked);
+    for (int i = 0; i < 4; ++i) {
+        guard.repin();
+        epoch_domain<epoch_tracked>::global().reclaim();
+    }
+    REQUIRE(epoch_live_objects.load() == before);
+}
+
+TEST_CASE("Epoch Statistics") {
+    rainy_const initial_stats = epoch_domain<epoch_tracked>::global().get_stats();
+    epoch_domain<epoch_tracked>::global().retire(new epoch_tracked);
+    epoch_domain<epoch_tracked>::global().retire(new epoch_tracked);
+    rainy_const after_retire_stats = epoch_domain<epoch_tracked>::global().get_stats();
+    REQUIRE(after_retire_stats.objects_retired == initial_stats.objects_retired + 2);
+    epoch_reclaim_rounds(3);
+    rainy_const after_reclaim_stats = epoch_domain<epoch_tracked>::global().get_stats();
+    REQUIRE(after_reclaim_stats.scan_count >= initial_stats.scan_count + 3);
+    REQUIRE(after_reclaim_stats.objects_reclaimed >= initial_stats.objects_reclaimed + 2);
+    REQUIRE(after_reclaim_stats.global_epoch > initial_stats.global_epoch);
+}
+
+TEST_CASE("Epoch AutomaticReclamation") {
+    rainy_const initial_stats = epoch_domain<epoch_tracked>::global().get_stats();
+    for (int i = 0; i < 1000; ++i) {
+        epoch_domain<epoch_tracked>::global().retire(new epoch_tracked);
+    }
+    rainy_const after_stats = epoch_domain<epoch_tracked>::global().get_stats();
+    REQUIRE(after_stats.scan_count > initial_stats.scan_count);
+    REQUIRE(after_stats.objects_reclaimed > initial_stats.objects_reclaimed);
+}
+
+TEST_CASE("Epoch ConcurrentStackReaders") {
+    constexpr int NUM_WRITERS = 4;
+    constexpr int NUM_READERS = 4;
+    constexpr int OPS_PER_WRITER = 5000;
+    std::atomic<epoch_tracked *> head{nullptr};
+    std::atomic<bool> stop{false};
+    std::vector<std::thread> threads;
+    for (int i = 0; i < NUM_READERS; ++i) {
+        threads.emplace_back([&] {
+            long sum = 0;
+            while (!stop.load(std::memory_order_acquire)) {
+                epoch_guard guard;
+                for (epoch_tracked *curr = guard.protect(head.load(std::memory_order_acquire)); curr;
+                     curr = curr->next.load(std::memory_order_acquire)) {
+                    sum += curr->value;
+                }
+            }
+            (void) sum;
+        });
+    }
+    for (int i = 0; i < NUM_WRITERS; ++i) {
+        threads.emplace_back([&, i] {
+            for (int j = 0; j < OPS_PER_WRITER; ++j) {
+                auto *node = new epoch_tracked;
+                node->value = i * OPS_PER_WRITER + j;
+                epoch_tracked *old_head = head.load(std::memory_order_relaxed);
+                do {
+                    node->next.store(old_head, std::memory_order_relaxed);
+                } while (!head.compare_exchange_weak(old_head, node, std::memory_order_release, std::memory_order_relaxed));
+                epoch_guard guard;
+                epoch_tracked *first = head.load(std::memory_order_acquire);
+                while (first && !head.compare_exchange_weak(first, first->next.load(std::memory_order_acquire),
+                                                            std::memory_order_acq_rel, std::memory_order_acquire)) {
+                }
+                if (first) {
+                    epoch_domain<epoch_tracked>::global().retire(first);
+                }
+            }
+        });
+    }
+    for (int i = NUM_READERS; i < NUM_READERS + NUM_WRITERS; ++i) {
+        threads[i].join();
+    }
+    stop.store(true, std::memory_order_release);
+    for (int i = 0; i < NUM_READERS; ++i) {
+        threads[i].join();
+    }
+    REQUIRE(head.load() == nullptr);
+    rainy_const stats = epoch_domain<epoch_tracked>::global().get_stats();
+    REQUIRE(stats.objects_retired >= NUM_WRITERS * OPS_PER_WRITER);
+}
+
+// NOLINTEND(cppcoreguidelines-avoid-do-while)